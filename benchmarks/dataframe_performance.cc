@@ -47,14 +47,15 @@ int main(int, char *[]) {
 
     MyDataFrame::set_optimum_thread_level();
 	
-    const auto  first = high_resolution_clock::now();
-    MyDataFrame df;
+    const auto              first = high_resolution_clock::now();
+    MyDataFrame             df;
+    RandGenParams<double>   p { .engine = rand_engine::philox };
 
     df.load_data(
         MyDataFrame::gen_sequence_index(0, SIZE, 1),
-        std::make_pair("normal", gen_normal_dist<double, ALIGNMENT>(SIZE)),
-        std::make_pair("log_normal", gen_lognormal_dist<double, ALIGNMENT>(SIZE)),
-        std::make_pair("exponential", gen_exponential_dist<double, ALIGNMENT>(SIZE)));
+        std::make_pair("normal", gen_normal_dist<double, ALIGNMENT>(SIZE, p)),
+        std::make_pair("log_normal", gen_lognormal_dist<double, ALIGNMENT>(SIZE, p)),
+        std::make_pair("exponential", gen_exponential_dist<double, ALIGNMENT>(SIZE, p)));
 
     const auto  second = high_resolution_clock::now();
 
@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ctime>
 #include <iostream>
 #include <random>
+#include <string>
 
 using namespace hmdf;
 using namespace std::chrono;
@@ -43,7 +44,34 @@ using MyDataFrame = StdDataFrame<long>;
 
 // -----------------------------------------------------------------------------
 
-int main(int, char *[]) {
+static void read_large_file(const char *title, const ReadParams &params)  {
+
+    MyDataFrame df;
+
+    const auto  start = std::chrono::high_resolution_clock::now();
+
+    try  {
+        df.read("Large_File.csv", io_format::csv2, params);
+    }
+    catch (const DataFrameError &ex)  {
+        std::cout << ex.what() << std::endl;
+    }
+
+    const auto  end = std::chrono::high_resolution_clock::now();
+
+    std::cout << title << " Column Length: "
+              << df.get_column<double>("COL6").size() << '\n';
+    std::cout
+    << title << " Reading Took: "
+    << double(duration_cast<microseconds>(end - start).count()) / 1000000.0
+    << " seconds\n";
+}
+
+// -----------------------------------------------------------------------------
+
+// Usage: dataframe_read_large_file [serial | chunked | compare]
+//
+int main(int argc, char *argv[]) {
 
 /*
     const auto      start1 = std::chrono::high_resolution_clock::now();
@@ -82,25 +110,17 @@ int main(int, char *[]) {
 
     // Now the reading
     //
-    MyDataFrame df;
+    const std::string   mode { argc > 1 ? argv[1] : "serial" };
+    ReadParams          chunked_params;
 
-    const auto  start2 = std::chrono::high_resolution_clock::now();
+    chunked_params.chunk_size = 64 * 1024 * 1024;
+    if (mode == "chunked" || mode == "compare")
+        MyDataFrame::set_optimum_thread_level();
 
-    try  {
-        df.read("Large_File.csv", io_format::csv2);
-    }
-    catch (const DataFrameError &ex)  {
-        std::cout << ex.what() << std::endl;
-    }
-
-    const auto  end2 = std::chrono::high_resolution_clock::now();
-
-    std::cout << "Column Length: "
-              << df.get_column<double>("COL6").size() << '\n';
-    std::cout
-    << "Reading Took: "
-    << double(duration_cast<microseconds>(end2 - start2).count()) / 1000000.0
-    << " seconds\n";
+    if (mode == "serial" || mode == "compare")
+        read_large_file("Serial", ReadParams { });
+    if (mode == "chunked" || mode == "compare")
+        read_large_file("Chunked mmap", chunked_params);
 
 /*
     df.write<long, unsigned int, int, unsigned long, double, float>
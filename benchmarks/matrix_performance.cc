@@ -0,0 +1,256 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <DataFrame/Utils/Matrix.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <utility>
+
+using namespace hmdf;
+using namespace std::chrono;
+
+using col_mat_t = Matrix<double, matrix_orient::column_major>;
+using row_mat_t = Matrix<double, matrix_orient::row_major>;
+
+constexpr long  BLOCK = 64;
+
+// -----------------------------------------------------------------------------
+
+static inline double
+elapsed_secs(high_resolution_clock::time_point start)  {
+
+    return (double(duration_cast<microseconds>(
+                high_resolution_clock::now() - start).count()) / 1000000.0);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MA>
+static MA
+random_matrix(long rows, long cols, unsigned int seed)  {
+
+    MA                                  mat { rows, cols };
+    std::mt19937                        gen { seed };
+    std::uniform_real_distribution<>    dist { -1.0, 1.0 };
+
+    for (long r = 0; r < rows; ++r)
+        for (long c = 0; c < cols; ++c)
+            mat(r, c) = dist(gen);
+    return (mat);
+}
+
+// -----------------------------------------------------------------------------
+
+// This is the cache-blocked multiplication Matrix used before the packed-panel
+// kernel. It is kept here as the baseline.
+//
+template<typename MA1, typename MA2>
+static MA1
+blocked_mult(const MA1 &lhs, const MA2 &rhs)  {
+
+    const long  lhs_rows { lhs.rows() };
+    const long  lhs_cols { lhs.cols() };
+    const long  rhs_cols { rhs.cols() };
+    MA1         result { lhs_rows, rhs_cols, 0 };
+
+    auto    col_lbd =
+        [lhs_rows, lhs_cols, &result, &lhs, &rhs]
+        (auto begin, auto end) -> void  {
+            for (long rc = begin; rc < end; rc += BLOCK)
+                for (long lc = 0; lc < lhs_cols; lc += BLOCK)
+                    for (long r = 0; r < lhs_rows; r += BLOCK)  {
+                        const long  r_max = std::min(r + BLOCK, lhs_rows);
+                        const long  rc_max = std::min(rc + BLOCK, end);
+                        const long  lc_max = std::min(lc + BLOCK, lhs_cols);
+
+                        for (long rr = rc; rr < rc_max; ++rr)
+                            for (long cc = lc; cc < lc_max; ++cc)  {
+                                const double    val = rhs(cc, rr);
+
+                                for (long i = r; i < r_max; ++i)
+                                    result(i, rr) += lhs(i, cc) * val;
+                            }
+                    }
+        };
+    auto    row_lbd =
+        [lhs_cols, rhs_cols, &result, &lhs, &rhs]
+        (auto begin, auto end) -> void  {
+            for (long r = begin; r < end; r += BLOCK)
+                for (long c = 0; c < rhs_cols; c += BLOCK)
+                    for (long k = 0; k < lhs_cols; k += BLOCK)  {
+                        const long  r_max = std::min(r + BLOCK, end);
+                        const long  c_max = std::min(c + BLOCK, rhs_cols);
+                        const long  k_max = std::min(k + BLOCK, lhs_cols);
+
+                        for (long rr = r; rr < r_max; ++rr)
+                            for (long kk = k; kk < k_max; ++kk)  {
+                                const double    val = lhs(rr, kk);
+
+                                for (long j = c; j < c_max; ++j)
+                                    result(rr, j) += val * rhs(kk, j);
+                            }
+                    }
+        };
+
+    if (ThreadGranularity::get_thread_level() > 2)  {
+        std::vector<std::future<void>>  futures;
+
+        if constexpr (MA1::orientation() == matrix_orient::column_major)
+            futures = ThreadGranularity::thr_pool_.parallel_loop<double>(
+                          0L, rhs_cols, std::move(col_lbd));
+        else
+            futures = ThreadGranularity::thr_pool_.parallel_loop<double>(
+                          0L, lhs_rows, std::move(row_lbd));
+        for (auto &fut : futures)  fut.get();
+    }
+    else  {
+        if constexpr (MA1::orientation() == matrix_orient::column_major)
+            col_lbd(0L, rhs_cols);
+        else
+            row_lbd(0L, lhs_rows);
+    }
+    return (result);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MA1, typename MA2>
+static void
+bench_mult(const char *name, const MA1 &lhs, const MA2 &rhs)  {
+
+    auto    start = high_resolution_clock::now();
+    auto    base = blocked_mult(lhs, rhs);
+    double  base_secs = elapsed_secs(start);
+
+    start = high_resolution_clock::now();
+
+    auto    packed = lhs * rhs;
+    double  packed_secs = elapsed_secs(start);
+    double  max_diff { 0 };
+
+    for (long r = 0; r < base.rows(); ++r)
+        for (long c = 0; c < base.cols(); ++c)
+            max_diff =
+                std::max(max_diff, std::fabs(base(r, c) - packed(r, c)));
+
+    const double    gflop =
+        2.0 * double(lhs.rows()) * double(lhs.cols()) * double(rhs.cols()) /
+        1.0e9;
+
+    std::cout << "    " << name << ":\n"
+              << "        blocked: " << base_secs << " secs ("
+              << gflop / base_secs << " GFLOPS)\n"
+              << "        packed:  " << packed_secs << " secs ("
+              << gflop / packed_secs << " GFLOPS), max diff "
+              << max_diff << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+
+    const long  thr_num =
+        argc > 1 ? std::atol(argv[1])
+                 : long(std::thread::hardware_concurrency());
+
+    ThreadGranularity::set_thread_level(thr_num);
+    std::cout << "Matrix multiplication (" << thr_num << " threads):"
+              << std::endl;
+
+    {
+        const auto  lhs = random_matrix<col_mat_t>(2000, 2000, 1);
+        const auto  rhs = random_matrix<col_mat_t>(2000, 2000, 2);
+
+        bench_mult("2000x2000 * 2000x2000 column-major", lhs, rhs);
+    }
+    {
+        const auto  lhs = random_matrix<row_mat_t>(2000, 2000, 1);
+        const auto  rhs = random_matrix<row_mat_t>(2000, 2000, 2);
+
+        bench_mult("2000x2000 * 2000x2000 row-major", lhs, rhs);
+    }
+
+    const auto  tall = random_matrix<col_mat_t>(10000, 500, 3);
+
+    {
+        const auto  rhs = random_matrix<col_mat_t>(500, 500, 4);
+
+        bench_mult("10000x500 * 500x500 column-major", tall, rhs);
+
+        // This is the shape of a covariance / Gram matrix
+        //
+        const auto  tall_t = tall.transpose();
+
+        bench_mult("500x10000 * 10000x500 row-major", tall_t, tall);
+    }
+
+    std::cout << "Decompositions (" << thr_num << " threads):" << std::endl;
+    {
+        col_mat_t   U;
+        col_mat_t   S;
+        col_mat_t   V;
+        auto        start = high_resolution_clock::now();
+
+        tall.svd(U, S, V, false);
+        std::cout << "    10000x500 svd:          " << elapsed_secs(start)
+                  << " secs" << std::endl;
+    }
+    {
+        const auto  sq = random_matrix<col_mat_t>(1000, 1000, 5);
+        auto        start = high_resolution_clock::now();
+        const auto  inv = sq.inverse();
+
+        std::cout << "    1000x1000 inverse:      " << elapsed_secs(start)
+                  << " secs" << std::endl;
+
+        col_mat_t   sym { 1000, 1000 };
+        col_mat_t   e_vals;
+        col_mat_t   e_vecs;
+
+        for (long r = 0; r < sym.rows(); ++r)
+            for (long c = 0; c <= r; ++c)
+                sym(r, c) = sym(c, r) = sq(r, c);
+        start = high_resolution_clock::now();
+        sym.eigen_space(e_vals, e_vecs, false);
+        std::cout << "    1000x1000 eigen_space:  " << elapsed_secs(start)
+                  << " secs" << std::endl;
+    }
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
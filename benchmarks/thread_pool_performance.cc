@@ -0,0 +1,179 @@
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <DataFrame/Utils/Threads/ThreadPool.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace hmdf;
+using namespace std::chrono;
+
+constexpr long  FLAT_TASKS = 1000000;
+constexpr long  FIB_N = 34;
+constexpr long  FIB_CUTOFF = 12;
+constexpr long  SORT_SIZE = 10000000;
+
+using sched_policy = ThreadPool::sched_policy;
+
+// -----------------------------------------------------------------------------
+
+static inline double
+elapsed_secs(high_resolution_clock::time_point start)  {
+
+    return (double(duration_cast<microseconds>(
+                high_resolution_clock::now() - start).count()) / 1000000.0);
+}
+
+// -----------------------------------------------------------------------------
+
+// A binary tree of tiny tasks, where every task dispatches its children from
+// a pool thread. This is the nested fan-out pattern.
+//
+static long
+fib_tasks(ThreadPool &pool, long n)  {
+
+    if (n < FIB_CUTOFF)  {
+        long    a = 0;
+        long    b = 1;
+
+        for (long i = 0; i < n; ++i)  {
+            const long  c = a + b;
+
+            a = b;
+            b = c;
+        }
+        return (a);
+    }
+
+    auto        fut = pool.dispatch(false, fib_tasks, std::ref(pool), n - 1);
+    const long  right = fib_tasks(pool, n - 2);
+
+    while (fut.wait_for(seconds(0)) == std::future_status::timeout)
+        pool.run_task();
+    return (fut.get() + right);
+}
+
+// -----------------------------------------------------------------------------
+
+static void
+run_benchmark(sched_policy policy, long thr_num)  {
+
+    ThreadPool  pool (thr_num, policy);
+
+    std::cout << (policy == sched_policy::work_stealing
+                      ? "work_stealing" : "shared_queue")
+              << " (" << thr_num << " threads):" << std::endl;
+
+    // Many independent tasks dispatched from outside the pool
+    //
+    auto                            start = high_resolution_clock::now();
+    std::vector<std::future<long>>  futs;
+
+    futs.reserve(FLAT_TASKS);
+    for (long i = 0; i < FLAT_TASKS; ++i)
+        futs.push_back(pool.dispatch(false, [](long v) -> long  {
+                                                return (v * 2);
+                                            }, i));
+
+    long    flat_sum = 0;
+
+    for (auto &fut : futs)  flat_sum += fut.get();
+
+    const double    flat_secs = elapsed_secs(start);
+
+    std::cout << "    Flat dispatch:   " << flat_secs << " secs ("
+              << double(FLAT_TASKS) / flat_secs
+              << " tasks/sec), checksum " << flat_sum << std::endl;
+
+    // Nested fan-out
+    //
+    start = high_resolution_clock::now();
+
+    const long  fib = fib_tasks(pool, FIB_N);
+
+    std::cout << "    Nested fan-out:  " << elapsed_secs(start)
+              << " secs, result " << fib << std::endl;
+
+    // Nested parallel_sort recursion
+    //
+    std::vector<double>                 data (SORT_SIZE);
+    std::mt19937                        gen { 123 };
+    std::uniform_real_distribution<>    dist { };
+
+    for (auto &val : data)  val = dist(gen);
+    start = high_resolution_clock::now();
+    pool.parallel_sort(data.begin(), data.end());
+    std::cout << "    parallel_sort:   " << elapsed_secs(start) << " secs, "
+              << (std::is_sorted(data.begin(), data.end())
+                      ? "sorted" : "NOT sorted")
+              << std::endl;
+
+    // Cache-line aligned chunks over one big vector
+    //
+    start = high_resolution_clock::now();
+
+    auto    loop_futs =
+        pool.parallel_loop<double>(
+            0L, long(data.size()),
+            [&data](long begin, long end) -> double  {
+                return (std::accumulate(data.begin() + begin,
+                                        data.begin() + end, 0.0));
+            });
+    double  loop_sum = 0;
+
+    for (auto &fut : loop_futs)  loop_sum += fut.get();
+    std::cout << "    parallel_loop:   " << elapsed_secs(start)
+              << " secs, sum " << loop_sum << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+
+    const long  thr_num =
+        argc > 1 ? std::atol(argv[1])
+                 : long(std::thread::hardware_concurrency());
+
+    run_benchmark(sched_policy::shared_queue, thr_num);
+    run_benchmark(sched_policy::work_stealing, thr_num);
+    return (0);
+}
+
+// -----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
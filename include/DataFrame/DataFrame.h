@@ -33,11 +33,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/DataFrameTypes.h>
 #include <DataFrame/Utils/AlignedAllocator.h>
 #include <DataFrame/Utils/FixedSizeString.h>
+#include <DataFrame/Utils/FlatRowTable.h>
 #include <DataFrame/Utils/Matrix.h>
 #include <DataFrame/Utils/Threads/ThreadGranularity.h>
 #include <DataFrame/Utils/Utils.h>
 
 #include <algorithm>
+#include <bit>
 #include <cctype>
 #include <cmath>
 #include <cstdio>
@@ -51,11 +53,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iterator>
 #include <limits>
 #include <map>
+#include <memory>
 #include <random>
 #include <ranges>
 #include <set>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <typeindex>
 #include <type_traits>
@@ -144,6 +149,18 @@ public:  // Load/append/remove interfaces
     static void
     remove_lock ();
 
+    // Reordering rows (sort, get_data_by_idx, ...) gathers each column
+    // into a new buffer, which temporarily needs an extra copy of the
+    // column. Columns bigger than the budget (in bytes) are reordered in
+    // place by following the permutation cycles instead. That needs no
+    // extra memory, but it is slower. By default there is no limit.
+    //
+    static void
+    set_permute_mem_budget (size_type bytes);
+
+    static size_type
+    get_permute_mem_budget ();
+
     // It creates an empty column named name
     //
     // T:
@@ -300,6 +317,28 @@ public:  // Load/append/remove interfaces
                 nan_policy padding = nan_policy::pad_with_nans,
                 bool do_lock = true);
 
+    // It evaluates a lazy column expression (See DataFrameOperators.h) in
+    // one pass and moves the result to the named column.
+    // If the expression has columns of other DataFrames, rows are aligned by
+    // index and rows of this DataFrame not in all of them are NaN.
+    //
+    // E:
+    //   Type of the expression
+    // name:
+    //   Name of the column
+    // expr:
+    //   The column expression
+    // padding:
+    //   If true, it pads the data column with nan, if it is shorter than the
+    //   index column.
+    //
+    template<column_expression E>
+    size_type
+    load_column(const char *name,
+                const E &expr,
+                nan_policy padding = nan_policy::pad_with_nans,
+                bool do_lock = true);
+
     // This method creates a column similar to above, but assumes data is
     // bucket or bar values. That means the data vector contains statistical
     // figure(s) for time buckets and must be aligned with the index column
@@ -1565,6 +1604,10 @@ public:  // Data manipulation
     // NOTE: Sort first calls make_consistent() that may add nan values to
     //       data columns.
     //       nan values make sorting nondeterministic.
+    // NOTE: Columns bigger than ThreadPool::MUL_THR_THHOLD of integral,
+    //       float, double or DateTime type are sorted by a parallel LSD
+    //       radix sort. That sort is stable and puts nan values at the end
+    //       regardless of dir.
     //
     // T:
     //   Type of the named column. You always must specify this type,
@@ -1585,6 +1628,8 @@ public:  // Data manipulation
     // the permutation vector for sorting the given column. A permutation
     // vector is a vector of indices that, when applied to the original column,
     // reorders its elements into a sorted sequence.
+    // NOTE: Same as sort() above, big numeric and DateTime columns are radix
+    //       sorted.
     //
     // T:
     //   Type of the named column. You always must specify this type,
@@ -1919,6 +1964,81 @@ public:  // Data manipulation
                    I_V &&idx_visitor,
                    Ts&& ... args) const;
 
+    // These are the same as groupby1/2/3() above, but the rows are grouped
+    // by hashing instead of sorting the group-by column(s).
+    // Rows are hash-partitioned, each partition is grouped in its own
+    // thread, and the partitions are merged into one group permutation in
+    // O(n). The summarization visitors and the result layout are the same
+    // as groupby1/2/3(). Within each group, rows are visited in their
+    // original order.
+    // This is faster for large, unsorted, high-cardinality keys.
+    // NaN keys never compare equal, so each NaN forms its own group.
+    //
+    // order:
+    //   Whether to keep groups in first-seen or sorted key order. Sorted
+    //   order only sorts the distinct keys, and requires comparable keys.
+    //
+    template<hashable_equal T, typename I_V, typename ... Ts>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
+    hash_groupby1(const char *col_name,
+                  group_order order,
+                  I_V &&idx_visitor,
+                  Ts&& ... args) const;
+
+    template<hashable_equal T1, hashable_equal T2,
+             typename I_V, typename ... Ts>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
+    hash_groupby2(const char *col_name1,
+                  const char *col_name2,
+                  group_order order,
+                  I_V &&idx_visitor,
+                  Ts&& ... args) const;
+
+    template<hashable_equal T1, hashable_equal T2, hashable_equal T3,
+             typename I_V, typename ... Ts>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
+    hash_groupby3(const char *col_name1,
+                  const char *col_name2,
+                  const char *col_name3,
+                  group_order order,
+                  I_V &&idx_visitor,
+                  Ts&& ... args) const;
+
+    // Same as hash_groupby1() above, but executed asynchronously
+    //
+    template<hashable_equal T, typename I_V, typename ... Ts>
+    [[nodiscard]]
+    std::future<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>>
+    hash_groupby1_async(const char *col_name,
+                        group_order order,
+                        I_V &&idx_visitor,
+                        Ts&& ... args) const;
+
+    // Same as hash_groupby2() above, but executed asynchronously
+    //
+    template<hashable_equal T1, hashable_equal T2,
+             typename I_V, typename ... Ts>
+    [[nodiscard]]
+    std::future<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>>
+    hash_groupby2_async(const char *col_name1,
+                        const char *col_name2,
+                        group_order order,
+                        I_V &&idx_visitor,
+                        Ts&& ... args) const;
+
+    // Same as hash_groupby3() above, but executed asynchronously
+    //
+    template<hashable_equal T1, hashable_equal T2, hashable_equal T3,
+             typename I_V, typename ... Ts>
+    [[nodiscard]]
+    std::future<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>>
+    hash_groupby3_async(const char *col_name1,
+                        const char *col_name2,
+                        const char *col_name3,
+                        group_order order,
+                        I_V &&idx_visitor,
+                        Ts&& ... args) const;
+
     // It counts the unique values in the named column.
     // It returns a StdDataFrame of following specs:
     //   1) The index is of type T and contains all unique values in
@@ -2516,8 +2636,8 @@ public:  // Data manipulation
                     Ts&& ... args) const;
 
     // This is very similar to bucketize() but specialized for DataFrame with
-    // a DateTime index column. It bucketizes the data based on specific time
-    // periods.
+    // a DateTime or Timestamp index column. It bucketizes the data based on
+    // specific time periods.
     // You must specify how the index column is bucketized, by providing
     // a visitor.
     // You must specify how each column is bucketized, by providing 3-member
@@ -2546,22 +2666,22 @@ public:  // Data manipulation
     //   Variable argument list of triples as specified above
     //
     template<typename I_V, typename ... Ts>
-    [[nodiscard]] DataFrame<DateTime, H>
+    [[nodiscard]] DataFrame<I, H>
     resample(time_frequency tf,
              size_type interval_num,
              I_V &&idx_visitor,
              Ts && ... args) const
-        requires std::same_as<I, DateTime>;
+        requires DateTime_or_Timestamp<I>;
 
     // Same as resample() above, but executed asynchronously
     //
     template<typename I_V, typename ... Ts>
-    [[nodiscard]] std::future<DataFrame<DateTime, H>>
+    [[nodiscard]] std::future<DataFrame<I, H>>
     resample_async(time_frequency tf,
                    size_type interval_num,
                    I_V &&idx_visitor,
                    Ts && ... args) const
-        requires std::same_as<I, DateTime>;
+        requires DateTime_or_Timestamp<I>;
 
     // It transposes the data in the DataFrame.
     // The transpose() is only defined for DataFrame's that have a single
@@ -2604,10 +2724,15 @@ public:  // Data manipulation
     // join_policy:
     //   Specifies how to join. For example inner join, or left join, etc.
     //   (See join_policy definition)
+    // js:
+    //   Specifies the join algorithm. It only affects the order of the
+    //   result rows (See join_strategy definition)
     //
     template<typename RHS_T, typename ... Ts>
     [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
-    join_by_index(const RHS_T &rhs, join_policy jp) const;
+    join_by_index(const RHS_T &rhs,
+                  join_policy jp,
+                  join_strategy js = join_strategy::sort_merge) const;
 
     // It joins the data between self (lhs) and rhs and returns the joined data
     // in a StdDataFrame, based on specification in join_policy.
@@ -2637,11 +2762,17 @@ public:  // Data manipulation
     // join_policy:
     //   Specifies how to join. For example inner join, or left join, etc.
     //   (See join_policy definition)
+    // js:
+    //   Specifies the join algorithm. It only affects the order of the
+    //   result rows (See join_strategy definition)
     //
     template<typename RHS_T, comparable T, typename ... Ts>
     [[nodiscard]]
     DataFrame<unsigned long, HeteroVector<std::size_t(H::align_value)>>
-    join_by_column(const RHS_T &rhs, const char *name, join_policy jp) const;
+    join_by_column(const RHS_T &rhs,
+                   const char *name,
+                   join_policy jp,
+                   join_strategy js = join_strategy::sort_merge) const;
 
     // This is the most general method to join two DataFrames. It requires the
     // name of two columns, one from self and one from rhs. The columns may or
@@ -2801,6 +2932,8 @@ public:  // Data manipulation
     //   index is further away than tolerance, the rhs columns for that lhs row
     //   are filled with NaN.  A tolerance of 0 (the default) disables the
     //   check and always propagates the nearest value regardless of distance.
+    //   For a Timestamp index, tolerance is a Timestamp holding the distance
+    //   in nanoseconds (e.g. Timestamp(5'000'000'000) for 5 seconds).
     //
     template<typename RHS_T, typename ... Ts>
     [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
@@ -3020,6 +3153,24 @@ public: // Read/access and slicing interfaces
     [[nodiscard]] const ColumnVecType<T> &
     get_column(size_type index, bool do_lock = true) const;
 
+    // It returns a read-only view of a column that has not been loaded yet,
+    // directly on top of the memory-mapped file it was read from. See
+    // io_format::mmap_binary and ReadParams::lazy_load. No data is copied.
+    // The view honors the starting_row and num_rows used to read the file.
+    // It is valid as long as self is alive and is not assigned to.
+    // If the column does not exist or is already loaded, a ColNotFound is
+    // thrown. If T is not the type of the column or the file was written on
+    // a machine with different endianness, a DataFrameError is thrown.
+    //
+    // T:
+    //   Arithmetic type (or Timestamp) of the named column
+    // name:
+    //   Name of the column
+    //
+    template<arithmetic T>
+    [[nodiscard]] VectorConstView<T, align_value>
+    get_mapped_column(const char *name) const;
+
     // Returns true if self has the named column, otherwise false
     // NOTE: Even if the column exists, it may not be of the type you expect.
     //
@@ -3314,6 +3465,9 @@ public: // Read/access and slicing interfaces
     // The signature of sel_fucntor:
     //     bool ()(const IndexType &, const T &)
     //
+    // NOTE: For big columns with more than 2 threads, sel_functor is called
+    //       from multiple threads on different rows at the same time. So it
+    //       must be stateless or thread safe.
     // NOTE: If the selection logic results in empty column(s), the result
     //       empty columns will _not_ be padded with NaN's. You can always
     //       call make_consistent() on the original or result DataFrame to make
@@ -3366,6 +3520,40 @@ public: // Read/access and slicing interfaces
     std::invocable<F, const IndexType &, const T &> &&
     std::same_as<std::invoke_result_t<F, const IndexType &, const T &>, bool>;
 
+    // This is the same as above get_data_by_sel(), for the simple case of
+    // comparing the named column with a constant (e.g. column > 100.0).
+    // A row is selected if "column op value" is true. Since there is no
+    // per-row functor call, for arithmetic columns the comparisons are done
+    // in branch-free blocks the compiler can vectorize. For big columns
+    // with more than 2 threads, the column is divided into chunks that are
+    // compared in parallel.
+    //
+    // T:
+    //   Type of the named column
+    // Ts:
+    //   List all the types of all data columns. A type should be specified in
+    //   the list only once.
+    // name:
+    //   Name of the data column
+    // op:
+    //   Comparison operator
+    // value:
+    //   The constant to compare each element of the column with
+    //
+    template<comparable T, typename ... Ts>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
+    get_data_by_sel(const char *name, compare_op op, const T &value) const;
+
+    // Same as above get_data_by_sel(), but the result is a view
+    //
+    template<comparable T, typename ... Ts>
+    [[nodiscard]] PtrView
+    get_view_by_sel(const char *name, compare_op op, const T &value);
+
+    template<comparable T, typename ... Ts>
+    [[nodiscard]] ConstPtrView
+    get_view_by_sel(const char *name, compare_op op, const T &value) const;
+
     // This does the same function as above get_data_by_sel() but operating
     // on two columns.
     // The signature of sel_fucntor:
@@ -5723,10 +5911,12 @@ public: // Read/access and slicing interfaces
     //
 
     // This selects the rows using the index column at specified time. It
-    // returns another DataFrame with selected data indexed by DateTime.
+    // returns another DataFrame with selected data indexed by the same index
+    // type.
     // Self is unchanged.
     //
-    // NOTE: The index column type must be DateTime or it won’t compile
+    // NOTE: The index column type must be DateTime or Timestamp or it won’t
+    //       compile
     //
     // Ts:
     //   List all the types of all data columns. A type should be specified in
@@ -5741,7 +5931,7 @@ public: // Read/access and slicing interfaces
     //   Specified milli-second
     //
     template<typename ... Ts>
-    [[nodiscard]] DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
     get_data_at_times(DateTime::HourType hr,  // 24 hour notation
                       DateTime::MinuteType mn = 0,
                       DateTime::SecondType sc = 0,
@@ -5769,7 +5959,8 @@ public: // Read/access and slicing interfaces
     // specified time. It returns another DataFrame with selected data indexed
     // by DateTime. The specified times are excluded. Self is unchanged.
     //
-    // NOTE: The index column type must be DateTime or it won’t compile
+    // NOTE: The index column type must be DateTime or Timestamp or it won’t
+    //       compile
     //
     // Ts:
     //   List all the types of all data columns. A type should be specified in
@@ -5784,7 +5975,7 @@ public: // Read/access and slicing interfaces
     //   Specified milli-second
     //
     template<typename ... Ts>
-    [[nodiscard]] DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
     get_data_before_times(DateTime::HourType hr,  // 24 hour notation
                           DateTime::MinuteType mn = 0,
                           DateTime::SecondType sc = 0,
@@ -5812,7 +6003,8 @@ public: // Read/access and slicing interfaces
     // specified time. It returns another DataFrame with selected data indexed
     // by DateTime. The specified times are excluded. Self is unchanged.
     //
-    // NOTE: The index column type must be DateTime or it won’t compile
+    // NOTE: The index column type must be DateTime or Timestamp or it won’t
+    //       compile
     //
     // Ts:
     //   List all the types of all data columns. A type should be specified in
@@ -5827,7 +6019,7 @@ public: // Read/access and slicing interfaces
     //   Specified milli-second
     //
     template<typename ... Ts>
-    [[nodiscard]] DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
     get_data_after_times(DateTime::HourType hr,  // 24 hour notation
                          DateTime::MinuteType mn = 0,
                          DateTime::SecondType sc = 0,
@@ -5853,9 +6045,10 @@ public: // Read/access and slicing interfaces
 
     // This selects the rows using the index column that happen between the
     // specified start and end time. It returns another DataFrame with selected
-    // data indexed by DateTime. Self is unchanged.
+    // data indexed by the same index type. Self is unchanged.
     //
-    // NOTE: The index column type must be DateTime or it won’t compile
+    // NOTE: The index column type must be DateTime or Timestamp or it won’t
+    //       compile
     //
     // Ts:
     //   List all the types of all data columns. A type should be specified in
@@ -5880,7 +6073,7 @@ public: // Read/access and slicing interfaces
     //   How to include/exclude start and end times
     //
     template<typename ... Ts>
-    [[nodiscard]] DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
     get_data_between_times(DateTime::HourType start_hr,  // 24 hour notation
                            DateTime::HourType end_hr,  // 24 hour notation
                            DateTime::MinuteType start_mn = 0,
@@ -5921,9 +6114,10 @@ public: // Read/access and slicing interfaces
 
     // This selects the rows using the index column that happen on the specified
     // days of the week. It returns another DataFrame with selected data
-    // indexed by DateTime. Self is unchanged
+    // indexed by the same index type. Self is unchanged
     //
-    // NOTE: The index column type must be DateTime or it won’t compile
+    // NOTE: The index column type must be DateTime or Timestamp or it won’t
+    //       compile
     //
     // Ts:
     //   List all the types of all data columns. A type should be specified in
@@ -5932,7 +6126,7 @@ public: // Read/access and slicing interfaces
     //   List of specified days
     //
     template<typename ... Ts>
-    [[nodiscard]] DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
     get_data_on_days(const std::vector<DT_WEEKDAY> &days) const;
 
     // Same as get_data_on_days() above, but it returns a view
@@ -5949,9 +6143,10 @@ public: // Read/access and slicing interfaces
 
     // This selects the rows using the index column that happen on the specified
     // days of the month. It returns another DataFrame with selected data
-    // indexed by DateTime. Self is unchanged
+    // indexed by the same index type. Self is unchanged
     //
-    // NOTE: The index column type must be DateTime or it won’t compile
+    // NOTE: The index column type must be DateTime or Timestamp or it won’t
+    //       compile
     //
     // Ts:
     //   List all the types of all data columns. A type should be specified in
@@ -5960,7 +6155,7 @@ public: // Read/access and slicing interfaces
     //   List of specified days
     //
     template<typename ... Ts>
-    [[nodiscard]] DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
     get_data_on_days_in_month(
         const std::vector<DateTime::DatePartType> &days) const;
 
@@ -5979,9 +6174,10 @@ public: // Read/access and slicing interfaces
 
     // This selects the rows using the index column that happen in the
     // specified months. It returns another DataFrame with selected data
-    // indexed by DateTime. Self is unchanged
+    // indexed by the same index type. Self is unchanged
     //
-    // NOTE: The index column type must be DateTime or it won’t compile
+    // NOTE: The index column type must be DateTime or Timestamp or it won’t
+    //       compile
     //
     // Ts:
     //   List all the types of all data columns. A type should be specified in
@@ -5990,7 +6186,7 @@ public: // Read/access and slicing interfaces
     //   List of specified months
     //
     template<typename ... Ts>
-    [[nodiscard]] DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
     get_data_in_months(
         const std::vector<DT_MONTH> &months) const;
 
@@ -6068,28 +6264,25 @@ public:  // Visitors
           std::function<bool(const IndexType &, T1 &, T2 &, T3 &)> &&func);
 
     // This is the most generalized visit function. It visits multiple
-    // columns with the corresponding function objects sequentially.
-    // Each function object is passed every single value of the given
-    // column along with its name and the corresponding index value.
-    // All functions objects must have this signature
-    //     bool (const IndexType &i, const char *name, [const] T &col_value)
-    // If the function object returns false, the DataFrame will stop iterating
-    // at that point on that column.
+    // columns with the corresponding visitors in a single pass.
+    // Each visitor gets the same calls it would get from visit(), but the
+    // visitors run together, one block of rows at a time. So a column is
+    // read from memory once, no matter how many visitors are on it.
+    // Visitors on different columns may run in parallel, if thread level
+    // is > 2 and the columns are long. In that case, visitors that can
+    // combine partial results are run by visit() in parallel chunks instead.
     //
     // NOTE: This method could be used to implement a pivot table.
+    // NOTE: Visitors must be distinct objects and must not share state.
     //
     // Ts:
     //   The list of types for columns in args
     // args:
     //   A variable list of arguments consisting of
-    //       std::pair(<const char *name,
-    //                  &std::function<bool(const IndexType &,
-    //                                      const char *,
-    //                                      [const] T &)>)
-    //   Each pair represents a column name and the functor to run on it.
+    //       std::pair(<const char *name, &visitor>)
+    //   Each pair represents a column name and the visitor to run on it.
     //
-    // NOTE: The second member of pair is a _pointer_ to the function or
-    //       functor object
+    // NOTE: The second member of pair is a _pointer_ to the visitor
     //
     template<typename ... Ts>
     void
@@ -6103,6 +6296,15 @@ public:  // Visitors
     // functor visitor sequentially from beginning to end
     //
     // NOTE: This method could be used to implement a pivot table.
+    // NOTE: Visitors that only buffer one-by-one data (obo_port_visitor,
+    //       e.g. median, quantile, mode, ...) are given the whole column in
+    //       one call instead, as in single_act_visit(). This avoids copying
+    //       the column into the visitor.
+    // NOTE: Visitors that can combine partial results (reduce_visitor, e.g.
+    //       sum, mean, var, min/max, stats, ...) visit long columns in
+    //       parallel chunks, if thread level is > 2. The chunks are fixed
+    //       for a given column length, so the result doesn't depend on the
+    //       number of threads.
     //
     // T:
     //   Type of the named column
@@ -6404,6 +6606,10 @@ public:  // Visitors
     // This is convenient for calculations that need the whole data vector,
     // for example auto-correlation.
     //
+    // NOTE: Visitors that can combine partial results (reduce_visitor) are
+    //       given consecutive chunks of long columns in parallel, as in
+    //       visit().
+    //
     // T:
     //   Type of the named column
     // V:
@@ -6856,7 +7062,8 @@ public:  // Utilities and miscellaneous
     // be fed directly to one of the load methods. Depending on the specified
     // frequency, it generates specific timestamps (see below).
     // It returns a vector of IndexType timestamps.
-    // Currently IndexType could be any built-in numeric type or DateTime
+    // Currently IndexType could be any built-in numeric type, DateTime or
+    // Timestamp
     //
     // start_datetime, end_datetime:
     //   They are the start/end date/times of requested timestamps.
@@ -6865,6 +7072,8 @@ public:  // Utilities and miscellaneous
     //   Specifies the timestamp frequency. Depending on the frequency, and
     //   IndexType type specific timestamps are generated as follows:
     //   - IndexType type of DateTime always generates timestamps of DateTime.
+    //   - IndexType type of Timestamp always generates the same instants as
+    //     DateTime, stored as nano-seconds since epoch (UTC).
     //   - Annual, monthly, weekly, and daily frequencies generates YYYYMMDD
     //     timestamps.
     //   - Hourly, minutely, and secondly frequencies generates epoch
@@ -6878,6 +7087,8 @@ public:  // Utilities and miscellaneous
     //
     // NOTE: It is the responsibility of the programmer to make sure
     //       IndexType type is big enough to contain the frequency.
+    // NOTE: Big indices of hourly and finer frequencies are generated in
+    //       parallel.
     //
     static StlVecType<I>
     gen_datetime_index(const char *start_datetime,
@@ -6905,6 +7116,45 @@ public:  // Utilities and miscellaneous
                        const IndexType &end_value,
                        long increment = 1);
 
+    // This static method parses a column of date/time strings, all in the
+    // same style, into DateTime values. It doesn't allocate memory per
+    // value. When consecutive strings are on the same day, the date part is
+    // parsed only once. Big columns are parsed in parallel.
+    // See DateTime string constructor for supported formats.
+    //
+    // strs:
+    //   Date/time strings
+    // ds:
+    //   Date style of all strings
+    // tz:
+    //   Time-zone of parsed values, unless a string specifies its own
+    //
+    static ColumnVecType<DateTime>
+    parse_datetime_column(std::span<const std::string_view> strs,
+                          DT_DATE_STYLE ds,
+                          DT_TIME_ZONE tz = DT_TIME_ZONE::LOCAL);
+
+    // This static method formats a column of DateTime values into one
+    // contiguous buffer. The i'th value is the characters in
+    // [offsets[i], offsets[i + 1]) of buffer. The output of each value is
+    // identical to DateTime::string_format(). Big columns are formatted
+    // in parallel.
+    //
+    // dts:
+    //   DateTime values to format
+    // format:
+    //   Output format
+    // buffer:
+    //   It is cleared and filled with the formatted values back to back
+    // offsets:
+    //   It is resized to dts.size() + 1 and filled with value boundaries
+    //
+    static void
+    format_datetime_column(std::span<const DateTime> dts,
+                           DT_FORMAT format,
+                           std::string &buffer,
+                           StlVecType<size_type> &offsets);
+
 public:  // Reading and writing
 
     // It outputs the content of DataFrame into the stream o.
@@ -6951,6 +7201,11 @@ public:  // Reading and writing
     //   Max number of rows to write. If it is positive, it will write max_recs
     //   from the beginning of DataFrame. If it is negative, it will write
     //   max_recs from the end of DataFrame
+    // chunk_rows, threads:
+    //   csv2 and json values are formatted in chunks of rows into buffers,
+    //   without going through the stream. Chunks are formatted in parallel
+    //   by up to threads threads and written to o in order.
+    //   See WriteParams for details
     //
     template<typename S, typename ... Ts>
     bool
@@ -7210,7 +7465,34 @@ private:
     //
     ColNameList     column_list_ { };  // Vector of column names and indices
 
+    // Columns of a memory-mapped file that are not loaded yet.
+    // See ReadParams::lazy_load
+    //
+    struct  MappedColumns_  {
+
+        struct  Entry  {
+
+            String32    type_name { };
+            size_type   offset { 0 };  // Of the column record in the file
+            size_type   length { 0 };  // Of the column record in bytes
+        };
+
+        explicit
+        MappedColumns_(const char *file_name) : mmap(file_name, false)  {   }
+
+        IOMmapOpti  mmap;
+        DFUnorderedMap<ColNameType, Entry, std::hash<VirtualString>>
+                    columns { };
+        bool        needs_flipping { false };
+        size_type   starting_row { 0 };
+        size_type   num_rows { std::numeric_limits<size_type>::max() };
+    };
+
+    std::shared_ptr<MappedColumns_> mapped_cols_ { };
+
     inline static SpinLock  *lock_ { nullptr };  // No lock safety by default
+    inline static size_type permute_mem_budget_ {
+        std::numeric_limits<size_type>::max() };
 
     // Private methods
     //
@@ -34,6 +34,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Utils/IsolationTree.h>
 #include <DataFrame/Utils/KDTree.h>
 #include <DataFrame/Utils/Matrix.h>
+#include <DataFrame/Utils/NeighborIndex.h>
 #include <DataFrame/Vectors/VectorPtrView.h>
 
 #include <algorithm>
@@ -543,7 +544,11 @@ public:
 // ------------------------------------------------------------------------------
 
 // Density-Based Spatial Clustering of Applications with Noise
-// Average runtime complexity is O(n log n). The worst case is O(n^2).
+// With the default distance, neighbors are found through a sorted index
+// (scalar) or a uniform grid (up to GridNeighborIndex::MAX_DIM dimensions),
+// and the runtime is O(n log n) plus the size of the neighborhoods. With a
+// user distance function, or in higher dimensions, every point is compared
+// with the whole column, which is O(n^2).
 //
 template<typename T, typename I = unsigned long, std::size_t A = 0>
 struct  DBSCANVisitor  {
@@ -552,6 +557,11 @@ private:
 
     static constexpr bool   is_md_ = random_acc_cont<T>;
 
+    using index_t =
+        std::conditional_t<is_md_,
+                           GridNeighborIndex<T>,
+                           SortedNeighborIndex<T>>;
+
 public:
 
     DEFINE_VISIT_BASIC_TYPES
@@ -604,9 +614,23 @@ private:
         const value_type    &value = *(column_begin + column_idx);
 
         cluster_index.clear();
-        for (id_t i = 0; i < col_s; ++i)  {
-            if (dfunc_(value, *(column_begin + i)) <= max_dist_)
-                cluster_index.push_back(i);
+        if (use_index_)  {
+            // The default scalar distance is squared
+            //
+            if constexpr (is_md_)
+                index_.within(value, max_dist_, hits_);
+            else
+                index_.within(value, std::sqrt(max_dist_), hits_);
+
+            for (const auto i : hits_)
+                if (dfunc_(value, *(column_begin + i)) <= max_dist_)
+                    cluster_index.push_back(id_t(i));
+        }
+        else  {
+            for (id_t i = 0; i < col_s; ++i)  {
+                if (dfunc_(value, *(column_begin + i)) <= max_dist_)
+                    cluster_index.push_back(i);
+            }
         }
     }
 
@@ -676,6 +700,18 @@ public:
         vec_t<id_t> cluster_neighors;
         id_t        cluster_id { 0 };
 
+        use_index_ = default_dist_ && max_dist_ >= 0 && col_s > 0;
+        if constexpr (is_md_)  {
+            if (use_index_ &&
+                std::size(*column_begin) <= index_t::MAX_DIM)
+                index_.build(column_begin, size_type(col_s), max_dist_);
+            else
+                use_index_ = false;
+        }
+        else  {
+            if (use_index_)  index_.build(column_begin, size_type(col_s));
+        }
+
         seeds.reserve(col_s / 20);
         cluster_neighors.reserve(col_s / 20);
         for (id_t i = 0; i < col_s; ++i)  {
@@ -711,7 +747,11 @@ public:
         }
     }
 
-    inline void set_dist_func(distance_func &&f)  { dfunc_ = f; }
+    inline void set_dist_func(distance_func &&f)  {
+
+        dfunc_ = f;
+        default_dist_ = false;
+    }
 
     inline void pre ()  {
 
@@ -733,17 +773,26 @@ public:
 
 private:
 
-    const id_t          min_mems_;
-    const double        max_dist_;
-    distance_func       dfunc_ { };
-    result_type         clusters_ { };       // Clusters
-    order_type          clusters_idxs_ { };  // Clusters indices
-    vec_t<size_type>    noisey_idxs_ { };    // Indices of noisey elements
+    const id_t              min_mems_;
+    const double            max_dist_;
+    distance_func           dfunc_ { };
+    bool                    default_dist_ { true };
+    bool                    use_index_ { false };
+    index_t                 index_ { };
+    std::vector<size_type>  hits_ { };           // Index query scratch
+    result_type             clusters_ { };       // Clusters
+    order_type              clusters_idxs_ { };  // Clusters indices
+    vec_t<size_type>        noisey_idxs_ { };    // Indices of noisey elements
 };
 
 // ------------------------------------------------------------------------------
 
 // Runtime complexity is O(I * n^2) where I is number of iterations.
+// With the default distance, the points within the kernel radius are found
+// through a sorted index (scalar) or a uniform grid (up to
+// GridNeighborIndex::MAX_DIM dimensions), so each iteration is O(n log n)
+// plus the size of the neighborhoods. The points of an iteration are
+// shifted in parallel.
 //
 // Type T must have arithmetic operators and default constructor well defined
 //
@@ -754,6 +803,11 @@ private:
 
     static constexpr bool   is_md_ = random_acc_cont<T>;
 
+    using index_t =
+        std::conditional_t<is_md_,
+                           GridNeighborIndex<T>,
+                           SortedNeighborIndex<T>>;
+
 public:
 
     DEFINE_VISIT_BASIC_TYPES
@@ -859,7 +913,7 @@ private:
                        size_type index,
                        const value_type &val,
                        vec_t<value_type> &shifted,
-                       vec_t<bool> &shifting)  {
+                       vec_t<char> &shifting) const  {
 
         if (dfunc_(val, *(column_begin + index)) <= max_dist_)
             shifting[index] = false;
@@ -936,45 +990,102 @@ public:
             : (kernel_ == mean_shift_kernel::sigmoid) ? &sigmoid_kernel_
             : &silverman_kernel_;
         vec_t<value_type>   shifted (column_begin, column_end);
-        vec_t<bool>         shifting (col_s, true);
+        vec_t<char>         shifting (col_s, true);
         size_type           iterations { 0 };
         const double        radius { kband_ * 3.0 };
         const double        dbl_sq_bw { 2.0 * kband_ * kband_ };
+        index_t             index { };
+        bool                use_index { default_dist_ && col_s > 0 };
 
-        while (iterations++ < max_iter_ &&
-               std::any_of(shifting.begin(), shifting.end(),
-                           [](bool v) -> bool { return (v); }))  {
-            for (size_type i { 0 }; i < col_s; ++i)  {
-                if (! shifting[i])  continue;
+        if constexpr (is_md_)  {
+            if (use_index && std::size(*column_begin) <= index_t::MAX_DIM)
+                index.build(column_begin, col_s, radius);
+            else
+                use_index = false;
+        }
+        else  {
+            if (use_index)  index.build(column_begin, col_s);
+        }
 
-                value_type          new_val { };
-                const value_type    &val_to_shift { shifted[i] };
-                double              total_w { 0 };
+        // Each point moves to the weighted average of its neighbors in the
+        // original column, so the points of one iteration are independent
+        //
+        auto    lbd =
+            [&column_begin = std::as_const(column_begin), &k_func,
+             &index = std::as_const(index), &shifted, &shifting,
+             col_s, radius, dbl_sq_bw, use_index, this]
+            (auto begin, auto end) -> void  {
+                std::vector<size_type>  hits;
 
-                for (size_type j = 0; j < col_s; ++j)  {
-                    const value_type    &this_val = *(column_begin + j);
-                    const double        dist = dfunc_(val_to_shift, this_val);
+                for (size_type i { begin }; i < end; ++i)  {
+                    if (! shifting[i])  continue;
+
+                    value_type          new_val { };
+                    const value_type    &val_to_shift { shifted[i] };
+                    double              total_w { 0 };
+                    auto                add_neighbor =
+                        [&](size_type j) -> void  {
+                            const value_type    &this_val =
+                                *(column_begin + j);
+                            const double        dist =
+                                dfunc_(val_to_shift, this_val);
+
+                            if (dist <= radius)  {
+                                const double    weight =
+                                    k_func(dist) / dbl_sq_bw;
+
+                                new_val = new_val + (this_val * weight);
+                                total_w += weight;
+                            }
+                        };
 
-                    if (dist <= radius)  {
-                        const double    weight = k_func(dist) / dbl_sq_bw;
+                    if (use_index)  {
+                        // The default scalar distance is squared
+                        //
+                        if constexpr (is_md_)
+                            index.within(val_to_shift, radius, hits);
+                        else
+                            index.within(val_to_shift, std::sqrt(radius),
+                                         hits);
 
-                        new_val = new_val + (this_val * weight);
-                        total_w += weight;
+                        for (const auto j : hits)  add_neighbor(j);
+                    }
+                    else  {
+                        for (size_type j = 0; j < col_s; ++j)
+                            add_neighbor(j);
                     }
+
+                    // The new position of value is the weighted average of
+                    // its neighbors
+                    //
+                    new_val = new_val / total_w;
+                    shift_(column_begin, i, new_val, shifted, shifting);
                 }
+            };
+        const long  thread_level =
+            (col_s >= 5'000) ? ThreadGranularity::get_thread_level() : 0;
 
-                // The new position of value is the weighted average of
-                // its neighbors
-                //
-                new_val = new_val / total_w;
-                shift_(column_begin, i, new_val, shifted, shifting);
+        while (iterations++ < max_iter_ &&
+               std::any_of(shifting.begin(), shifting.end(),
+                           [](bool v) -> bool { return (v); }))  {
+            if (thread_level > 2)  {
+                auto    futures =
+                    ThreadGranularity::thr_pool_.parallel_loop<char>(
+                        size_type(0), col_s, lbd);
+
+                for (auto &fut : futures)  fut.get();
             }
+            else  lbd(size_type(0), col_s);
         }
 
         build_cluster_(column_begin, col_s, shifted);
     }
 
-    inline void set_dist_func(distance_func &&f)  { dfunc_ = f; }
+    inline void set_dist_func(distance_func &&f)  {
+
+        dfunc_ = f;
+        default_dist_ = false;
+    }
 
     inline void pre ()  { clusters_.clear(); clusters_idxs_.clear(); }
     inline void post ()  {  }
@@ -999,6 +1110,7 @@ private:
     const size_type         max_iter_;
     const double            max_dist_;
     distance_func           dfunc_ { };
+    bool                    default_dist_ { true };
     result_type             clusters_ { };       // Clusters
     order_type              clusters_idxs_ { };  // Clusters indices
 };
@@ -4056,8 +4168,7 @@ public:
 
         if (type_ == hampel_type::median)
             hampel_(idx_begin, idx_end, column_begin, column_end,
-                    SimpleRollAdopter<MedianVisitor<T, I>, T, I>
-                        (MedianVisitor<T, I> { }, window_size_));
+                    RollingMedianVisitor<T, I, A> { window_size_, true });
         else if (type_ == hampel_type::mean)
             hampel_(idx_begin, idx_end, column_begin, column_end,
                     SimpleRollAdopter<MeanVisitor<T, I>, T, I>
@@ -4329,17 +4440,16 @@ public:
         // For MD, col_s is the number of rows (observations).
         // dim is 1 for scalar, or the vector/array width for MD.
         //
-        pvec_t      dists(col_s);
         knn_mat_t   neighbors { long(col_s), long(k_) };
         rch_mat_t   reach_dists { long(col_s), long(k_) };
         dist_vec_t  lrd(col_s, 0);  // Local Reachability Density
 
-        for (size_type i { 0 }; i < col_s; ++i)  {
-            if (nt_ > normalization_type::none)
-                get_knn_(norm.get_result().begin(), col_s, i, neighbors, dists);
-            else
-                get_knn_(column_begin, col_s, i, neighbors, dists);
+        if (nt_ > normalization_type::none)
+            get_all_knn_(norm.get_result().begin(), col_s, neighbors);
+        else
+            get_all_knn_(column_begin, col_s, neighbors);
 
+        for (size_type i { 0 }; i < col_s; ++i)  {
             double  sum_reach_dist { 0 };
 
             for (long j { 0 }; j < neighbors.cols(); ++j)  {
@@ -4381,6 +4491,148 @@ public:
 
 private:
 
+    using index_t =
+        std::conditional_t<is_md_,
+                           GridNeighborIndex<T>,
+                           SortedNeighborIndex<T>>;
+
+    // Neighbors can come from an index only if the distance is the default
+    // Euclidean one
+    //
+    [[nodiscard]] bool
+    is_def_dist_() const  {
+
+        using fptr_t = double (*)(const value_type &, const value_type &);
+
+        const auto  *fptr { dfunc_.template target<fptr_t>() };
+
+        return (fptr != nullptr && *fptr == &def_dist);
+    }
+
+    // Fills row i of neighbors with the k_ nearest neighbors of point i
+    //
+    template <typename H>
+    inline void
+    get_all_knn_(const H &column_begin,
+                 size_type col_s,
+                 knn_mat_t &neighbors) const  {
+
+        const bool  use_index { is_def_dist_() };
+
+        // The grid only pays off in a few dimensions. Above that, the
+        // neighbors come from a KD-tree
+        //
+        if constexpr (is_md_)  {
+            if (use_index && std::size(*column_begin) > index_t::MAX_DIM)  {
+                get_all_knn_tree_(column_begin, col_s, neighbors);
+                return;
+            }
+        }
+
+        if (! use_index)  {
+            pvec_t  dists(col_s);
+
+            for (size_type i { 0 }; i < col_s; ++i)
+                get_knn_(column_begin, col_s, i, neighbors, dists);
+            return;
+        }
+
+        index_t index { };
+
+        index.build(column_begin, col_s);
+
+        const auto  thread_level { (col_s < ThreadPool::MUL_THR_THHOLD)
+            ? 0L : ThreadGranularity::get_thread_level()
+        };
+        auto        lbd =
+            [&index = std::as_const(index), &neighbors, this,
+             &column_begin = std::as_const(column_begin)]
+            (auto begin, auto end) -> void  {
+                std::vector<typename index_t::dist_pair_t>  hits;
+
+                for (size_type i { begin }; i < end; ++i)  {
+                    const auto  &val { *(column_begin + i) };
+
+                    // One more than k_, because the point itself is its
+                    // nearest neighbor
+                    //
+                    index.k_nearest(val, k_ + 1, hits);
+
+                    const auto  self {
+                        std::find_if(hits.begin(), hits.end(),
+                                     [i](const auto &hit) -> bool  {
+                                         return (hit.second == i);
+                                     })
+                    };
+
+                    if (self != hits.end())  hits.erase(self);
+                    else  hits.pop_back();
+                    for (size_type j { 0 }; j < k_; ++j)  {
+                        const size_type pos { hits[j].second };
+
+                        neighbors(long(i), long(j)) =
+                            { dfunc_(val, *(column_begin + pos)), pos };
+                    }
+                }
+            };
+
+        if (thread_level > 2)  {
+            auto    futures =
+                ThreadGranularity::thr_pool_.parallel_loop<double>(
+                    size_type(0), col_s, std::move(lbd));
+
+            for (auto &fut : futures)  fut.get();
+        }
+        else  {
+            lbd(size_type(0), col_s);
+        }
+    }
+
+    template <typename H>
+    inline void
+    get_all_knn_tree_(const H &column_begin,
+                      size_type col_s,
+                      knn_mat_t &neighbors) const  {
+
+        const size_type     dim { std::size(*column_begin) };
+        std::vector<double> data(col_s * dim);
+
+        for (size_type i { 0 }; i < col_s; ++i)
+            std::copy(std::begin(*(column_begin + i)),
+                      std::end(*(column_begin + i)),
+                      data.begin() + i * dim);
+
+        FlatKDTree<double>  tree { dim };
+
+        tree.build(data.data(), col_s);
+
+        // One more than k_, because the point itself is its nearest neighbor
+        //
+        const auto      all_hits { tree.all_k_nearest(k_ + 1) };
+        const size_type kk { all_hits.size() / col_s };
+
+        for (size_type i { 0 }; i < col_s; ++i)  {
+            const auto  &val { *(column_begin + i) };
+            const auto  hits_begin { all_hits.begin() + i * kk };
+            const auto  hits_end { hits_begin + kk };
+            const auto  self {
+                std::find_if(hits_begin, hits_end,
+                             [i](const auto &hit) -> bool  {
+                                 return (hit.second == i);
+                             })
+            };
+
+            for (size_type j { 0 }, h { 0 }; j < k_; ++j, ++h)  {
+                if (hits_begin + h == self)  h += 1;
+
+                const size_type pos { (hits_begin + h)->second };
+
+                neighbors(long(i), long(j)) =
+                    { dfunc_(val, *(column_begin + pos)), pos };
+            }
+        }
+    }
+
     template <typename H>
     inline void
     get_knn_(const H &column_begin,
@@ -6200,7 +6452,7 @@ public:
     using result_type = vec_t<data_t>;
     using index_vec_t = vec_t<size_type>;
 
-    // KDTree<double>::point_t is std::vector<double>.
+    // FlatKDTree<data_t>::point_t is std::vector<data_t>.
     // For the scalar path, a "window" flattened to vector<data_t> is
     // just {x[0], x[1], ..., x[window-1]}.
     // For the MD path, a "window" is the concatenation of all inner elements
@@ -6254,7 +6506,16 @@ public:
         }
 #endif // HMDF_SANITY_EXCEPTIONS
 
-        tree_points_t   buckets;
+        size_type       inner_dim { 1 };
+
+        if constexpr (is_md_)  inner_dim = column_begin->size();
+
+        // tree_point dimension:
+        //   scalar path: window_ (one scalar per step)
+        //   MD path: window_ * inner_dim (all elements concatenated)
+        //
+        const size_type tree_dim { window_ * inner_dim };
+        tree_t          tree { make_tree_(tree_dim) };
 
         if (nt_ > normalization_type::none)  {
             NormalizeVisitor<T, I, A>   norm { nt_ };
@@ -6262,35 +6523,25 @@ public:
             norm.pre();
             norm(idx_begin, idx_end, column_begin, column_end);
             norm.post();
-            buckets = bucketize_(norm.get_result().begin(), col_s);
+            build_tree_(tree, norm.get_result().begin(), col_s, inner_dim);
         }
         else
-            buckets = bucketize_(column_begin, col_s);
-
-        // tree_point dimension:
-        //   scalar path: window_ (one scalar per step)
-        //   MD path: window_ * inner_dim (all elements concatenated)
-        //
-        const size_type tree_dim {
-            buckets.empty() ? window_ : buckets[0].size()
-        };
-
-        KDTree<data_t>  tree { tree_dim, std::forward<distance_func>(dfunc_) };
-
-        tree.build(buckets);
+            build_tree_(tree, column_begin, col_s, inner_dim);
 
         // Score each bucket: average distance to k nearest neighbors.
         // +1 because the nearest neighbor is always the point itself.
         //
-        result_type scores;
+        const auto      neighbors { tree.all_k_nearest(k_ + 1) };
+        const size_type n_buckets { tree.size() };
+        const size_type kk { n_buckets ? neighbors.size() / n_buckets : 0 };
+        result_type     scores;
 
-        scores.reserve(buckets.size());
-        for (const auto &pt : buckets)  {
-            const auto  dists { tree.k_nearest_dists(pt, k_ + 1) };
-            data_t      sum { 0 };
+        scores.reserve(n_buckets);
+        for (size_type b { 0 }; b < n_buckets; ++b)  {
+            data_t  sum { 0 };
 
-            for (size_type i { 1 }; i < dists.size(); ++i)
-                sum += data_t(dists[i]);
+            for (size_type i { 1 }; i < kk; ++i)
+                sum += data_t(neighbors[b * kk + i].first);
             scores.push_back(sum / data_t(k_));
         }
 
@@ -6341,8 +6592,30 @@ public:
 
 private:
 
-    // Flatten each sliding window of value_type elements into a
-    // tree_point_t (std::vector<data_t>) that KDTree<data_t> expects.
+    using tree_t = FlatKDTree<data_t>;
+
+    // With the default distance the tree computes Euclidean distances in
+    // place. Otherwise every distance goes through dfunc_.
+    //
+    [[nodiscard]] tree_t
+    make_tree_(size_type tree_dim) const  {
+
+        using fptr_t = double (*)(const tree_point_t &, const tree_point_t &);
+
+        const auto  *fptr { dfunc_.template target<fptr_t>() };
+
+        if (fptr != nullptr && *fptr == &def_dist)
+            return (tree_t { tree_dim });
+        return (tree_t {
+            tree_dim,
+            [this](const tree_point_t &x, const tree_point_t &y) -> data_t  {
+                return (data_t(dfunc_(x, y)));
+            }
+        });
+    }
+
+    // Flatten each sliding window of value_type elements into one
+    // contiguous buffer, window after window, and build the tree over it.
     //
     // Scalar path  (T = double):
     //   value_type = double, one element per position → [v0, v1, ..., v_{w-1}]
@@ -6352,34 +6625,30 @@ private:
     //   [v0[0],...,v0[d-1], v1[0],...,v_{w-1}[d-1]]
     //
     template <typename H>
-    inline tree_points_t
-    bucketize_(const H &column_begin, size_type col_s) const  {
+    inline void
+    build_tree_(tree_t &tree,
+                const H &column_begin,
+                size_type col_s,
+                size_type inner_dim) const  {
 
-        tree_points_t   result;
-        size_type       inner_dim { 1 };
+        const size_type     n_buckets { col_s - window_ + 1 };
+        const size_type     tree_dim { window_ * inner_dim };
+        std::vector<data_t> buckets(n_buckets * tree_dim);
 
-        if constexpr (is_md_)  inner_dim = column_begin->size();
-        result.reserve(col_s - window_ + 1);
-        for (size_type i { 0 }; (i + window_) <= col_s; ++i)  {
-            tree_point_t    pt;
+        for (size_type i { 0 }; i < n_buckets; ++i)  {
+            data_t  *pt { buckets.data() + i * tree_dim };
 
             if constexpr (! is_md_)  { // Scalar: copy window raw values directly
-                pt.resize(window_);
                 for (size_type j { 0 }; j < window_; ++j)
                     pt[j] = data_t(*(column_begin + i + j));
             }
             else  { // MD: concatenate inner elements across the window
-                pt.reserve(window_ * inner_dim);
-                for (size_type j { 0 }; j < window_; ++j)  {
-                    const auto  &elem { *(column_begin + i + j) };
-
-                    for (const auto &v : elem)
-                        pt.push_back(data_t(v));
-                }
+                for (size_type j { 0 }; j < window_; ++j)
+                    for (const auto &v : *(column_begin + i + j))
+                        *(pt++) = data_t(v);
             }
-            result.push_back(std::move(pt));
         }
-        return (result);
+        tree.build(buckets.data(), n_buckets);
     }
 
     inline result_type
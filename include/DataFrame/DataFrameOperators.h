@@ -30,9 +30,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
+#include <future>
 #include <iterator>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 // ----------------------------------------------------------------------------
 
@@ -194,6 +203,764 @@ inline DF scaler_df_divides (const DF &lhs, const ST &scaler)  {
     return (sc_binary_operation<DF, ST, std::divides, Ts ...>(lhs, scaler));
 }
 
+// ----------------------------------------------------------------------------
+
+//
+// Lazy expressions
+//
+// Operators on column expressions (col_expr()) and frame expressions
+// (df_expr()) don't compute anything. They build a tree which is evaluated
+// in one pass, without intermediate columns, when it is loaded into a
+// DataFrame (load_column()) or materialized (eval_expr(), eval_df_expr()).
+// For example:
+//
+//     df.load_column("feature",
+//                    (col_expr<double>(df, "a") + col_expr<double>(df, "b")) *
+//                    col_expr<double>(df, "c") - 1.0);
+//
+//     MyDataFrame result =
+//         eval_df_expr<MyDataFrame, double, long>(
+//             (df_expr(df1) + df_expr(df2)) * df_expr(df3) - df_expr(df4));
+//
+// Column expressions support arithmetic, comparison and logical (&, |, !)
+// operators and expr_where(). Frame expressions support arithmetic on the
+// same-name and same-type columns, like df_plus() and friends.
+// Columns from different DataFrames are aligned by index as in
+// binary_operation(). Only rows whose index value is in all DataFrames are
+// used. A column shorter than its index ends the rows.
+// Long expressions are evaluated in parallel, if thread level is > 2.
+//
+// NOTE: Indices of all DataFrames must be already sorted, if there is more
+//       than one DataFrame in an expression.
+// NOTE: Expressions refer to the DataFrame columns. They must not outlive
+//       them and the DataFrames must not change until evaluation.
+//
+
+// Rows common to all DataFrames in an expression. With one DataFrame, or if
+// all DataFrames have the same index, rows are not remapped.
+//
+template<typename DF>
+struct  ExprAlignment  {
+
+    using size_type = typename DF::size_type;
+
+    explicit
+    ExprAlignment(std::vector<const DF *> &&frames)
+        : frames_(std::move(frames))  {
+
+        if (frames_.empty())  return;
+
+        const auto  &idx0 = frames_[0]->get_index();
+
+        rows_ = idx0.size();
+
+        // Often all DataFrames have the same index
+        //
+        const bool  same_idx =
+            std::all_of(frames_.begin() + 1, frames_.end(),
+                        [&idx0](const DF *df) -> bool  {
+                            return (std::ranges::equal(df->get_index(),
+                                                       idx0));
+                        });
+
+        if (same_idx)  return;
+
+        positions_.resize(frames_.size());
+        positions_[0].resize(rows_);
+        std::iota(positions_[0].begin(), positions_[0].end(), size_type(0));
+        for (size_type f = 1; f < frames_.size(); ++f)  {
+            const auto  &idx = frames_[f]->get_index();
+            const auto  idx_s = idx.size();
+            size_type   kept = 0;
+            size_type   k = 0;
+            size_type   j = 0;
+
+            positions_[f].reserve(std::min(rows_, idx_s));
+            while (k < rows_ && j < idx_s)  {
+                const auto  &val = idx0[positions_[0][k]];
+
+                if (val == idx[j])  {
+                    for (size_type p = 0; p < f; ++p)
+                        positions_[p][kept] = positions_[p][k];
+                    positions_[f].push_back(j);
+                    kept += 1;
+                    k += 1;
+                    j += 1;
+                }
+                else if (idx[j] < val)  j += 1;
+                else  k += 1;
+            }
+            rows_ = kept;
+            for (size_type p = 0; p < f; ++p)
+                positions_[p].resize(kept);
+        }
+    }
+
+    inline bool is_aligned() const  { return (! positions_.empty()); }
+    inline size_type rows() const  { return (rows_); }
+
+    // Positions of the rows in df, or nullptr if rows are not remapped
+    //
+    inline const size_type *positions(const DF *df) const  {
+
+        if (! is_aligned())  return (nullptr);
+        for (size_type f = 0; f < frames_.size(); ++f)
+            if (frames_[f] == df)  return (positions_[f].data());
+        return (nullptr);
+    }
+
+    // Index of the common rows
+    //
+    inline typename DF::IndexVecType index(size_type n) const  {
+
+        const auto  &idx0 = frames_[0]->get_index();
+
+        if (! is_aligned())
+            return (typename DF::IndexVecType(idx0.begin(),
+                                              idx0.begin() + n));
+
+        typename DF::IndexVecType   result;
+
+        result.reserve(n);
+        for (size_type i = 0; i < n; ++i)
+            result.push_back(idx0[positions_[0][i]]);
+        return (result);
+    }
+
+private:
+
+    std::vector<const DF *>                 frames_ { };
+    std::vector<std::vector<size_type>>     positions_ { };
+    size_type                               rows_ { 0 };
+};
+
+// ----------------------------------------------------------------------------
+
+template<typename DF>
+inline void
+add_expr_frame_(std::vector<const DF *> &frames, const DF *df)  {
+
+    if (std::find(frames.begin(), frames.end(), df) == frames.end())
+        frames.push_back(df);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename DF, typename T>
+struct  ColumnExpr  {
+
+    using value_type = T;
+    using frame_type = DF;
+    using size_type = typename DF::size_type;
+    using col_type = typename DF::template ColumnVecType<T>;
+
+    static constexpr bool   is_column_expr { true };
+
+    ColumnExpr(const DF &df, const char *name)
+        : df_(&df), col_(&(df.template get_column<T>(name)))  {   }
+
+    inline void frames_(std::vector<const DF *> &frames) const  {
+
+        add_expr_frame_(frames, df_);
+    }
+    inline void bind_(const ExprAlignment<DF> &align)  {
+
+        pos_ = align.positions(df_);
+    }
+
+    // Number of leading common rows that this column has
+    //
+    inline size_type rows_(const ExprAlignment<DF> &align) const  {
+
+        if (! pos_)  return (std::min(align.rows(), col_->size()));
+        return (size_type(std::lower_bound(pos_, pos_ + align.rows(),
+                                           col_->size()) - pos_));
+    }
+
+    template<bool ALIGNED>
+    inline decltype(auto) get_(size_type i) const  {
+
+        if constexpr (ALIGNED)
+            return ((*col_)[pos_[i]]);
+        else
+            return ((*col_)[i]);
+    }
+
+private:
+
+    const DF        *df_;
+    const col_type  *col_;
+    const size_type *pos_ { nullptr };
+};
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+struct  ScalarExpr  {
+
+    using value_type = T;
+    using frame_type = void;
+    using size_type = std::size_t;
+
+    explicit ScalarExpr(const T &value) : value_(value)  {   }
+
+    template<typename DF>
+    inline void frames_(std::vector<const DF *> &) const  {   }
+    template<typename DF>
+    inline void bind_(const ExprAlignment<DF> &)  {   }
+    template<typename DF>
+    inline size_type rows_(const ExprAlignment<DF> &) const  {
+
+        return (std::numeric_limits<size_type>::max());
+    }
+
+    template<bool ALIGNED>
+    inline const value_type &get_(size_type) const  { return (value_); }
+
+private:
+
+    const value_type    value_;
+};
+
+// ----------------------------------------------------------------------------
+
+// Scalars have no DataFrame
+//
+template<typename F1, typename F2>
+using expr_frame_t = std::conditional_t<std::is_void_v<F1>, F2, F1>;
+
+template<typename E, typename OP>
+struct  UnaryExpr  {
+
+    using value_type =
+        std::decay_t<std::invoke_result_t<OP, typename E::value_type>>;
+    using frame_type = typename E::frame_type;
+    using size_type = std::size_t;
+
+    static constexpr bool   is_column_expr { true };
+
+    explicit UnaryExpr(const E &expr) : expr_(expr)  {   }
+
+    inline void frames_(std::vector<const frame_type *> &frames) const  {
+
+        expr_.frames_(frames);
+    }
+    inline void bind_(const ExprAlignment<frame_type> &align)  {
+
+        expr_.bind_(align);
+    }
+    inline size_type rows_(const ExprAlignment<frame_type> &align) const  {
+
+        return (expr_.rows_(align));
+    }
+
+    template<bool ALIGNED>
+    inline value_type get_(size_type i) const  {
+
+        return (op_(expr_.template get_<ALIGNED>(i)));
+    }
+
+private:
+
+    E           expr_;
+    const OP    op_ { };
+};
+
+// ----------------------------------------------------------------------------
+
+template<typename L, typename R, typename OP>
+struct  BinaryExpr  {
+
+    using value_type =
+        std::decay_t<std::invoke_result_t<OP,
+                                          typename L::value_type,
+                                          typename R::value_type>>;
+    using frame_type =
+        expr_frame_t<typename L::frame_type, typename R::frame_type>;
+    using size_type = std::size_t;
+
+    static constexpr bool   is_column_expr { true };
+
+    BinaryExpr(const L &lhs, const R &rhs) : lhs_(lhs), rhs_(rhs)  {   }
+
+    inline void frames_(std::vector<const frame_type *> &frames) const  {
+
+        lhs_.frames_(frames);
+        rhs_.frames_(frames);
+    }
+    inline void bind_(const ExprAlignment<frame_type> &align)  {
+
+        lhs_.bind_(align);
+        rhs_.bind_(align);
+    }
+    inline size_type rows_(const ExprAlignment<frame_type> &align) const  {
+
+        return (std::min(lhs_.rows_(align), rhs_.rows_(align)));
+    }
+
+    template<bool ALIGNED>
+    inline value_type get_(size_type i) const  {
+
+        return (op_(lhs_.template get_<ALIGNED>(i),
+                    rhs_.template get_<ALIGNED>(i)));
+    }
+
+private:
+
+    L           lhs_;
+    R           rhs_;
+    const OP    op_ { };
+};
+
+// ----------------------------------------------------------------------------
+
+// Element-wise cond ? x : y
+//
+template<typename C, typename X, typename Y>
+struct  WhereExpr  {
+
+    using value_type =
+        std::common_type_t<typename X::value_type, typename Y::value_type>;
+    using frame_type =
+        expr_frame_t<typename C::frame_type,
+                     expr_frame_t<typename X::frame_type,
+                                  typename Y::frame_type>>;
+    using size_type = std::size_t;
+
+    static constexpr bool   is_column_expr { true };
+
+    WhereExpr(const C &cond, const X &x, const Y &y)
+        : cond_(cond), x_(x), y_(y)  {   }
+
+    inline void frames_(std::vector<const frame_type *> &frames) const  {
+
+        cond_.frames_(frames);
+        x_.frames_(frames);
+        y_.frames_(frames);
+    }
+    inline void bind_(const ExprAlignment<frame_type> &align)  {
+
+        cond_.bind_(align);
+        x_.bind_(align);
+        y_.bind_(align);
+    }
+    inline size_type rows_(const ExprAlignment<frame_type> &align) const  {
+
+        return (std::min({ cond_.rows_(align),
+                           x_.rows_(align),
+                           y_.rows_(align) }));
+    }
+
+    template<bool ALIGNED>
+    inline value_type get_(size_type i) const  {
+
+        return (cond_.template get_<ALIGNED>(i)
+                    ? value_type(x_.template get_<ALIGNED>(i))
+                    : value_type(y_.template get_<ALIGNED>(i)));
+    }
+
+private:
+
+    C   cond_;
+    X   x_;
+    Y   y_;
+};
+
+// ----------------------------------------------------------------------------
+
+// Leaf of a column expression
+//
+template<typename T, typename DF>
+inline ColumnExpr<DF, T>
+col_expr(const DF &df, const char *col_name)  {
+
+    return (ColumnExpr<DF, T>(df, col_name));
+}
+
+// ----------------------------------------------------------------------------
+
+// An operand that is not an expression is a scalar
+//
+template<typename S>
+inline auto as_expr_(const S &s)  {
+
+    if constexpr (column_expression<S>)
+        return (s);
+    else
+        return (ScalarExpr<S>(s));
+}
+
+template<typename A, typename B>
+concept expr_operands =
+    (column_expression<A> || column_expression<B>) &&
+    ! frame_expression<A> && ! frame_expression<B>;
+
+#define HMDF_COL_EXPR_BINARY_OPT(OPT, FUNC) \
+    template<typename A, typename B> \
+    requires expr_operands<A, B> \
+    inline auto OPT (const A &lhs, const B &rhs)  { \
+\
+        using L = decltype(as_expr_(lhs)); \
+        using R = decltype(as_expr_(rhs)); \
+\
+        return (BinaryExpr<L, R, FUNC>(as_expr_(lhs), as_expr_(rhs))); \
+    }
+
+HMDF_COL_EXPR_BINARY_OPT(operator +, std::plus<>)
+HMDF_COL_EXPR_BINARY_OPT(operator -, std::minus<>)
+HMDF_COL_EXPR_BINARY_OPT(operator *, std::multiplies<>)
+HMDF_COL_EXPR_BINARY_OPT(operator /, std::divides<>)
+HMDF_COL_EXPR_BINARY_OPT(operator ==, std::equal_to<>)
+HMDF_COL_EXPR_BINARY_OPT(operator !=, std::not_equal_to<>)
+HMDF_COL_EXPR_BINARY_OPT(operator <, std::less<>)
+HMDF_COL_EXPR_BINARY_OPT(operator <=, std::less_equal<>)
+HMDF_COL_EXPR_BINARY_OPT(operator >, std::greater<>)
+HMDF_COL_EXPR_BINARY_OPT(operator >=, std::greater_equal<>)
+HMDF_COL_EXPR_BINARY_OPT(operator &, std::logical_and<>)
+HMDF_COL_EXPR_BINARY_OPT(operator |, std::logical_or<>)
+
+#undef HMDF_COL_EXPR_BINARY_OPT
+
+template<column_expression E>
+inline UnaryExpr<E, std::negate<>>
+operator - (const E &expr)  { return (UnaryExpr<E, std::negate<>>(expr)); }
+
+template<column_expression E>
+inline UnaryExpr<E, std::logical_not<>>
+operator ! (const E &expr)  {
+
+    return (UnaryExpr<E, std::logical_not<>>(expr));
+}
+
+template<column_expression C, typename X, typename Y>
+inline auto expr_where(const C &cond, const X &x, const Y &y)  {
+
+    using XE = decltype(as_expr_(x));
+    using YE = decltype(as_expr_(y));
+
+    return (WhereExpr<C, XE, YE>(cond, as_expr_(x), as_expr_(y)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<bool ALIGNED, typename E, typename V>
+inline void
+expr_fill_(const E &expr,
+           V &out,
+           const std::size_t *out_pos,
+           std::size_t begin,
+           std::size_t end)  {
+
+    using value_type = typename V::value_type;
+
+    if (out_pos)
+        for (std::size_t i = begin; i < end; ++i)
+            out[out_pos[i]] =
+                static_cast<value_type>(expr.template get_<ALIGNED>(i));
+    else
+        for (std::size_t i = begin; i < end; ++i)
+            out[i] = static_cast<value_type>(expr.template get_<ALIGNED>(i));
+}
+
+// It writes the first n rows of a bound expression to out, at out_pos if
+// given
+//
+template<typename E, typename V>
+inline void
+expr_evaluate_(const E &expr,
+               bool aligned,
+               V &out,
+               const std::size_t *out_pos,
+               std::size_t n)  {
+
+    using value_type = typename V::value_type;
+
+    const auto  fill =
+        [&expr, &out, out_pos, aligned]
+        (std::size_t begin, std::size_t end) -> void  {
+            if (aligned)
+                expr_fill_<true>(expr, out, out_pos, begin, end);
+            else
+                expr_fill_<false>(expr, out, out_pos, begin, end);
+        };
+
+    // Bits of a bool vector are shared between threads
+    //
+    if (n >= ThreadPool::MUL_THR_THHOLD &&
+        ThreadGranularity::get_thread_level() > 2 &&
+        ! std::is_same_v<value_type, bool>)  {
+        auto    futures =
+            ThreadGranularity::thr_pool_.parallel_loop<value_type>(
+                std::size_t(0), n, fill);
+
+        for (auto &fut : futures)  {
+            while (fut.wait_for(std::chrono::seconds(0)) ==
+                       std::future_status::timeout)
+                ThreadGranularity::thr_pool_.run_task();
+            fut.get();
+        }
+    }
+    else
+        fill(std::size_t(0), n);
+}
+
+// ----------------------------------------------------------------------------
+
+// It evaluates expr for the rows of df. Rows of df that are not common to
+// all DataFrames in expr are NaN. If expr has only df's columns, the result
+// is as long as the shortest column.
+//
+template<column_expression E, typename DF>
+typename DF::template StlVecType<typename E::value_type>
+eval_expr_for(const E &expr, const DF &df)  {
+
+    using value_type = typename E::value_type;
+    using frame_type = typename E::frame_type;
+
+    static_assert(std::is_same_v<frame_type, DF>,
+                  "eval_expr_for(): Expression must be on the same "
+                  "DataFrame type");
+
+    std::vector<const DF *> frames { &df };
+
+    expr.frames_(frames);
+
+    const ExprAlignment<DF> align (std::move(frames));
+    E                       e = expr;
+
+    e.bind_(align);
+
+    const std::size_t                           n = e.rows_(align);
+    typename DF::template StlVecType<value_type> result;
+
+    if (! align.is_aligned())  {
+        result.resize(n);
+        expr_evaluate_(e, false, result, nullptr, n);
+    }
+    else  {
+        result.resize(df.get_index().size(), get_nan<value_type>());
+        expr_evaluate_(e, true, result, align.positions(&df), n);
+    }
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+// It evaluates expr into a new DataFrame with the common index and one
+// column named col_name
+//
+template<column_expression E>
+typename E::frame_type
+eval_expr(const E &expr, const char *col_name)  {
+
+    using DF = typename E::frame_type;
+    using value_type = typename E::value_type;
+
+    std::vector<const DF *> frames;
+
+    expr.frames_(frames);
+
+    const ExprAlignment<DF> align (std::move(frames));
+    E                       e = expr;
+
+    e.bind_(align);
+
+    const std::size_t                           n = e.rows_(align);
+    typename DF::template StlVecType<value_type> col (n);
+    DF                                          result;
+
+    expr_evaluate_(e, align.is_aligned(), col, nullptr, n);
+    result.load_index(align.index(n));
+    result.template load_column<value_type>(col_name, std::move(col));
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename DF>
+struct  FrameExpr  {
+
+    using frame_type = DF;
+
+    static constexpr bool   is_frame_expr { true };
+
+    explicit FrameExpr(const DF &df) : df_(&df)  {   }
+
+    inline void frames_(std::vector<const DF *> &frames) const  {
+
+        add_expr_frame_(frames, df_);
+    }
+    template<typename T>
+    inline ColumnExpr<DF, T> column_(const char *col_name) const  {
+
+        return (ColumnExpr<DF, T>(*df_, col_name));
+    }
+
+private:
+
+    const DF    *df_;
+};
+
+// ----------------------------------------------------------------------------
+
+template<typename ST>
+struct  FrameScalarExpr  {
+
+    using frame_type = void;
+
+    explicit FrameScalarExpr(const ST &value) : value_(value)  {   }
+
+    template<typename DF>
+    inline void frames_(std::vector<const DF *> &) const  {   }
+    template<typename T>
+    inline ScalarExpr<T> column_(const char *) const  {
+
+        return (ScalarExpr<T>(static_cast<T>(value_)));
+    }
+
+private:
+
+    const ST    value_;
+};
+
+// ----------------------------------------------------------------------------
+
+template<typename L, typename R, typename OP>
+struct  FrameBinaryExpr  {
+
+    using frame_type =
+        expr_frame_t<typename L::frame_type, typename R::frame_type>;
+
+    static constexpr bool   is_frame_expr { true };
+
+    FrameBinaryExpr(const L &lhs, const R &rhs) : lhs_(lhs), rhs_(rhs)  {   }
+
+    inline void frames_(std::vector<const frame_type *> &frames) const  {
+
+        lhs_.frames_(frames);
+        rhs_.frames_(frames);
+    }
+    template<typename T>
+    inline auto column_(const char *col_name) const  {
+
+        using LC = decltype(lhs_.template column_<T>(col_name));
+        using RC = decltype(rhs_.template column_<T>(col_name));
+
+        return (BinaryExpr<LC, RC, OP>(lhs_.template column_<T>(col_name),
+                                       rhs_.template column_<T>(col_name)));
+    }
+
+private:
+
+    L   lhs_;
+    R   rhs_;
+};
+
+// ----------------------------------------------------------------------------
+
+// Leaf of a frame expression
+//
+template<typename DF>
+inline FrameExpr<DF> df_expr(const DF &df)  { return (FrameExpr<DF>(df)); }
+
+template<typename S>
+inline auto as_df_expr_(const S &s)  {
+
+    if constexpr (frame_expression<S>)
+        return (s);
+    else
+        return (FrameScalarExpr<S>(s));
+}
+
+template<typename A, typename B>
+concept df_expr_operands =
+    (frame_expression<A> || frame_expression<B>) &&
+    ! column_expression<A> && ! column_expression<B>;
+
+#define HMDF_DF_EXPR_BINARY_OPT(OPT, FUNC) \
+    template<typename A, typename B> \
+    requires df_expr_operands<A, B> \
+    inline auto OPT (const A &lhs, const B &rhs)  { \
+\
+        using L = decltype(as_df_expr_(lhs)); \
+        using R = decltype(as_df_expr_(rhs)); \
+\
+        return (FrameBinaryExpr<L, R, FUNC>(as_df_expr_(lhs), \
+                                            as_df_expr_(rhs))); \
+    }
+
+HMDF_DF_EXPR_BINARY_OPT(operator +, std::plus<>)
+HMDF_DF_EXPR_BINARY_OPT(operator -, std::minus<>)
+HMDF_DF_EXPR_BINARY_OPT(operator *, std::multiplies<>)
+HMDF_DF_EXPR_BINARY_OPT(operator /, std::divides<>)
+
+#undef HMDF_DF_EXPR_BINARY_OPT
+
+// ----------------------------------------------------------------------------
+
+// It evaluates a frame expression into a new DataFrame. Each column of the
+// first DataFrame, with a type among Ts, that is also in all the other
+// DataFrames with the same type, is computed in one pass.
+// The result has the common index. The row alignment is computed once for
+// all columns.
+//
+template<typename DF, typename ... Ts, frame_expression E>
+DF eval_df_expr(const E &expr)  {
+
+    static_assert(std::is_same_v<typename E::frame_type, DF>,
+                  "eval_df_expr(): Expression must be on the DF type");
+
+    std::vector<const DF *> frames;
+
+    expr.frames_(frames);
+
+    std::vector<std::unordered_map<std::string, std::type_index>>   types;
+
+    types.reserve(frames.size());
+    for (const DF *df : frames)  {
+        auto    &col_types = types.emplace_back();
+
+        for (const auto &[name, size, type] :
+                 df->template get_columns_info<Ts ...>())
+            col_types.emplace(name.c_str(), type);
+    }
+
+    const ExprAlignment<DF> align (std::move(frames));
+    DF                      result;
+
+    result.load_index(align.index(align.rows()));
+    for (const auto &[name, type] : types[0])  {
+        const auto  in_all =
+            std::all_of(types.begin() + 1, types.end(),
+                        [&name, &type](const auto &col_types) -> bool  {
+                            const auto  citer = col_types.find(name);
+
+                            return (citer != col_types.end() &&
+                                    citer->second == type);
+                        });
+
+        if (! in_all)  continue;
+
+        const auto  eval_col = [&]<typename T>() -> void  {
+            if (type != std::type_index(typeid(T)))  return;
+
+            auto    e = expr.template column_<T>(name.c_str());
+
+            e.bind_(align);
+
+            const std::size_t                   n = e.rows_(align);
+            typename DF::template StlVecType<T> col (n);
+
+            expr_evaluate_(e, align.is_aligned(), col, nullptr, n);
+            if (! col.empty())
+                result.template load_column<T>(name.c_str(), std::move(col));
+        };
+
+        (eval_col.template operator()<Ts>(), ...);
+    }
+    return (result);
+}
+
 } // namespace hmdf
 
 // ----------------------------------------------------------------------------
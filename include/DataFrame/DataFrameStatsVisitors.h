@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Utils/Concepts.h>
 #include <DataFrame/Utils/FixedSizePriorityQueue.h>
 #include <DataFrame/Utils/Matrix.h>
+#include <DataFrame/Utils/OrderStatIndex.h>
 #include <DataFrame/Utils/Threads/ThreadGranularity.h>
 #include <DataFrame/Utils/Utils.h>
 
@@ -169,6 +170,7 @@ namespace hmdf
     bool        obo_data_ { false };  // one-by-one data passing
 
 #define OBO_PORT_OPT \
+    static constexpr bool   obo_port { true }; \
     inline void \
     operator()(const index_type &, const value_type &val)  { \
         obo_data_ = true; \
@@ -176,6 +178,7 @@ namespace hmdf
     }
 
 #define OBO_PORT_OPT2 \
+    static constexpr bool   obo_port { true }; \
     inline void \
     operator()(const index_type &idx, const value_type &val)  { \
         obo_data_ = true; \
@@ -576,6 +579,14 @@ struct  CountVisitor  {
     inline void post ()  {  }
     inline result_type get_result () const  { return (result_); }
 
+    // Reduce protocol (See reduce_visitor concept)
+    //
+    inline bool can_reduce() const  { return (true); }
+    inline void reduce(const CountVisitor &other)  {
+
+        result_ += other.result_;
+    }
+
     DECL_CTOR(CountVisitor)
 
 private:
@@ -681,15 +692,66 @@ public:
         }
     }
 
+    // Rolling protocol (See rolling_visitor concept).
+    // Floating point sums are compensated (Kahan), so removals don't
+    // accumulate rounding errors.
+    //
+    inline bool can_roll() const  { return (true); }
+    inline void roll_add(const index_type &, const value_type &val)
+        requires std::is_arithmetic_v<T>  {
+
+        rolling_ = true;
+        if (is_nan__(val)) [[unlikely]]  {
+            if (! skip_nan_)  roll_nan_cnt_ += 1;
+            return;
+        }
+        if constexpr (std::floating_point<value_type>)
+            kahan_add_(val);
+        else
+            roll_sum_ += val;
+    }
+    inline void roll_remove(const index_type &, const value_type &val)
+        requires std::is_arithmetic_v<T>  {
+
+        rolling_ = true;
+        if (is_nan__(val)) [[unlikely]]  {
+            if (! skip_nan_)  roll_nan_cnt_ -= 1;
+            return;
+        }
+        if constexpr (std::floating_point<value_type>)
+            kahan_add_(-val);
+        else
+            roll_sum_ -= val;
+    }
+
+    // Reduce protocol (See reduce_visitor concept)
+    //
+    inline bool can_reduce() const  { return (true); }
+    inline void reduce(const SumVisitor &other)
+        requires std::is_arithmetic_v<T>  { result_ += other.result_; }
+
     inline void pre()  {
 
         started_ = false;
-        if constexpr (std::is_arithmetic_v<value_type>)
+        rolling_ = false;
+        if constexpr (std::is_arithmetic_v<value_type>)  {
             result_ = 0;
+            roll_sum_ = 0;
+            roll_comp_ = 0;
+            roll_nan_cnt_ = 0;
+        }
         else if constexpr (StringOnly<value_type>)
             result_.clear();
     }
-    inline void post()  {  }
+    inline void post()  {
+
+        if constexpr (std::is_arithmetic_v<value_type>)  {
+            if (rolling_)
+                result_ = (roll_nan_cnt_ == 0)
+                    ? roll_sum_
+                    : std::numeric_limits<value_type>::quiet_NaN();
+        }
+    }
     inline const result_type &get_result() const  { return (result_); }
     inline result_type &get_result()  { return (result_); }
 
@@ -697,9 +759,22 @@ public:
 
 private:
 
+    inline void kahan_add_(const value_type &val)  {
+
+        const value_type    y = val - roll_comp_;
+        const value_type    t = roll_sum_ + y;
+
+        roll_comp_ = (t - roll_sum_) - y;
+        roll_sum_ = t;
+    }
+
     bool        started_ { false };
+    bool        rolling_ { false };
     result_type result_ { };
     const bool  skip_nan_;
+    COND_DECL(std::is_arithmetic_v<T>, T, roll_sum_);
+    COND_DECL(std::is_arithmetic_v<T>, T, roll_comp_);
+    size_type   roll_nan_cnt_ { 0 };
 };
 
 // ----------------------------------------------------------------------------
@@ -793,6 +868,36 @@ public:
             BaseClass::_sum.get_result() / data_t(BaseClass::_cnt);
     }
 
+    // Rolling protocol (See rolling_visitor concept)
+    //
+    inline bool can_roll() const  { return (true); }
+    inline void roll_add(const I &idx, const T &val)
+        requires std::is_arithmetic_v<T>  {
+
+        SKIP_NAN_BASE
+
+        BaseClass::_cnt += 1;
+        BaseClass::_sum.roll_add(idx, val);
+    }
+    inline void roll_remove(const I &idx, const T &val)
+        requires std::is_arithmetic_v<T>  {
+
+        SKIP_NAN_BASE
+
+        BaseClass::_cnt -= 1;
+        BaseClass::_sum.roll_remove(idx, val);
+    }
+
+    // Reduce protocol (See reduce_visitor concept)
+    //
+    inline bool can_reduce() const  { return (true); }
+    inline void reduce(const MeanVisitor &other)
+        requires std::is_arithmetic_v<T>  {
+
+        BaseClass::_cnt += other._cnt;
+        BaseClass::_sum.reduce(other._sum);
+    }
+
     MeanVisitor(bool skipnan = false) : BaseClass(skipnan)  {   }
 };
 
@@ -1148,7 +1253,9 @@ struct  ExtremumVisitor  {
                 pos_ = counter_;
                 index_ = *(idx_begin + index);
                 extremum_ = val;
+                is_first = false;
                 index += 1;
+                ++counter_;
                 break;
             }
         }
@@ -1229,6 +1336,27 @@ struct  ExtremumVisitor  {
     inline index_type get_index () const  { return (index_); }
     inline size_type get_position () const  { return (pos_); }
 
+    // Reduce protocol (See reduce_visitor concept).
+    // As in one pass, the first of equal extremums wins and a NaN, if not
+    // skipped, poisons the result.
+    //
+    inline bool can_reduce() const  { return (true); }
+    inline void reduce(const ExtremumVisitor &other)  {
+
+        if (! other.is_first)  {
+            if (is_first ||
+                (! is_nan__(extremum_) &&
+                 (is_nan__(other.extremum_) ||
+                  cmp_(extremum_, other.extremum_))))  {
+                extremum_ = other.extremum_;
+                index_ = other.index_;
+                pos_ = counter_ + other.pos_;
+                is_first = false;
+            }
+        }
+        counter_ += other.counter_;
+    }
+
     DECL_CTOR(ExtremumVisitor)
 
 private:
@@ -1418,6 +1546,23 @@ private:
         }
     };
 
+    // Welford state used by the rolling protocol
+    //
+    struct  RollResults  {
+        data_t      mean1 { 0 };
+        data_t      mean2 { 0 };
+        data_t      co_moment { 0 };
+        data_t      m2_1 { 0 };  // Sum of squared deviations of column 1
+        data_t      m2_2 { 0 };  // Sum of squared deviations of column 2
+        size_type   cnt { 0 };
+        size_type   nan_cnt { 0 };
+
+        inline void clear()  {
+            mean1 = mean2 = co_moment = m2_1 = m2_2 = 0;
+            cnt = nan_cnt = 0;
+        }
+    };
+
     // Kahan summation algorithm, also known as compensated summation
     // This is numerically stable for very large numbers
     //
@@ -1691,10 +1836,83 @@ public:
         }
     }
 
+    // Rolling protocol (See rolling_visitor2 concept).
+    // It uses Welford's updates which, unlike the sums of products, don't
+    // lose precision when values leave the window.
+    //
+    inline bool can_roll() const  { return (true); }
+    inline void roll_add(const index_type &,
+                         const value_type &val1, const value_type &val2)
+        requires std::floating_point<T>  {
+
+        rolling_ = true;
+        if (is_nan__(val1) || is_nan__(val2)) [[unlikely]]  {
+            if (! skip_nan_)  roll_result_.nan_cnt += 1;
+            return;
+        }
+
+        auto            &rr = roll_result_;
+        const data_t    delta1 = val1 - rr.mean1;
+        const data_t    delta2 = val2 - rr.mean2;
+
+        rr.cnt += 1;
+        rr.mean1 += delta1 / data_t(rr.cnt);
+        rr.mean2 += delta2 / data_t(rr.cnt);
+        rr.co_moment += delta1 * (val2 - rr.mean2);
+        rr.m2_1 += delta1 * (val1 - rr.mean1);
+        rr.m2_2 += delta2 * (val2 - rr.mean2);
+    }
+    inline void roll_remove(const index_type &,
+                            const value_type &val1, const value_type &val2)
+        requires std::floating_point<T>  {
+
+        rolling_ = true;
+        if (is_nan__(val1) || is_nan__(val2)) [[unlikely]]  {
+            if (! skip_nan_)  roll_result_.nan_cnt -= 1;
+            return;
+        }
+
+        auto    &rr = roll_result_;
+
+        if (rr.cnt <= 1)  {
+            const size_type nan_cnt = rr.nan_cnt;
+
+            rr.clear();
+            rr.nan_cnt = nan_cnt;
+            return;
+        }
+
+        const data_t    delta1 = val1 - rr.mean1;
+        const data_t    delta2 = val2 - rr.mean2;
+
+        rr.cnt -= 1;
+        rr.mean1 -= delta1 / data_t(rr.cnt);
+        rr.mean2 -= delta2 / data_t(rr.cnt);
+        rr.co_moment -= delta1 * (val2 - rr.mean2);
+        rr.m2_1 = std::max(rr.m2_1 - delta1 * (val1 - rr.mean1), data_t(0));
+        rr.m2_2 = std::max(rr.m2_2 - delta2 * (val2 - rr.mean2), data_t(0));
+    }
+
+    // Reduce protocol (See reduce_visitor concept)
+    //
+    inline bool can_reduce() const  { return (true); }
+    inline void reduce(const CovVisitor &other)
+        requires std::is_arithmetic_v<T>  {
+
+        inter_result_.total1 += other.inter_result_.total1;
+        inter_result_.total2 += other.inter_result_.total2;
+        inter_result_.dot_prod += other.inter_result_.dot_prod;
+        inter_result_.dot_prod1 += other.inter_result_.dot_prod1;
+        inter_result_.dot_prod2 += other.inter_result_.dot_prod2;
+        inter_result_.cnt += other.inter_result_.cnt;
+    }
+
     inline void pre ()  {
 
+        rolling_ = false;
         if constexpr (std::is_arithmetic_v<value_type>)  {
             inter_result_.clear();
+            roll_result_.clear();
             result_ = 0;
         }
         else  {
@@ -1706,6 +1924,11 @@ public:
     inline void post ()  {
 
         if constexpr (std::is_arithmetic_v<value_type>)  {
+            if (rolling_)  {
+                result_ = roll_moment_(roll_result_.co_moment);
+                return;
+            }
+
             const data_t    d = data_t(inter_result_.cnt) - b_;
 
             if (d != 0) [[likely]]  {
@@ -1723,6 +1946,8 @@ public:
     inline var_t get_var1 () const  {
 
         if constexpr (std::is_arithmetic_v<value_type>)  {
+            if (rolling_)  return (roll_moment_(roll_result_.m2_1));
+
             const data_t    d = data_t(inter_result_.cnt) - b_;
 
             if (d != 0) [[likely]]  {
@@ -1743,6 +1968,8 @@ public:
     inline var_t get_var2 () const  {
 
         if constexpr (std::is_arithmetic_v<value_type>)  {
+            if (rolling_)  return (roll_moment_(roll_result_.m2_2));
+
             const data_t    d = data_t(inter_result_.cnt) - b_;
 
             if (d != 0) [[likely]]  {
@@ -1763,7 +1990,7 @@ public:
     inline size_type get_count() const  {
 
         if constexpr (std::is_arithmetic_v<value_type>)
-            return (inter_result_.cnt);
+            return (rolling_ ? roll_result_.cnt : inter_result_.cnt);
         else
             return (0);
     }
@@ -1771,7 +1998,12 @@ public:
     inline const mean_t &get_mean1() const  {
 
         if constexpr (std::is_arithmetic_v<value_type>)  {
-            if (inter_result_.cnt | 0x0) [[likely]]
+            if (rolling_)
+                const_cast<CovVisitor *>(this)->mean1_ =
+                    roll_result_.cnt > 0
+                        ? roll_result_.mean1
+                        : std::numeric_limits<data_t>::quiet_NaN();
+            else if (inter_result_.cnt | 0x0) [[likely]]
                 const_cast<CovVisitor *>(this)->mean1_ =
                     inter_result_.total1 / data_t(inter_result_.cnt);
             else
@@ -1783,7 +2015,12 @@ public:
     inline const mean_t &get_mean2() const  {
 
         if constexpr (std::is_arithmetic_v<value_type>)  {
-            if (inter_result_.cnt | 0x0) [[likely]]
+            if (rolling_)
+                const_cast<CovVisitor *>(this)->mean2_ =
+                    roll_result_.cnt > 0
+                        ? roll_result_.mean2
+                        : std::numeric_limits<data_t>::quiet_NaN();
+            else if (inter_result_.cnt | 0x0) [[likely]]
                 const_cast<CovVisitor *>(this)->mean2_ =
                     inter_result_.total2 / data_t(inter_result_.cnt);
             else
@@ -1809,11 +2046,22 @@ public:
 
 private:
 
+    inline data_t roll_moment_(data_t moment) const  {
+
+        const data_t    d = data_t(roll_result_.cnt) - b_;
+
+        if (roll_result_.nan_cnt == 0 && d != 0) [[likely]]
+            return (moment / d);
+        return (std::numeric_limits<data_t>::quiet_NaN());
+    }
+
     InterResults    inter_result_ { };
+    RollResults     roll_result_ { };
     result_type     result_ { };
     data_t          b_;
     bool            skip_nan_;
     bool            stable_algo_;
+    bool            rolling_ { false };
     mean_t          mean1_ { };
     mean_t          mean2_ { };
 };
@@ -1972,6 +2220,20 @@ public:
     }
     data_t get_b() const  { return (cov_.get_b()); }
 
+    // Rolling protocol (See rolling_visitor concept)
+    //
+    inline bool can_roll() const  { return (true); }
+    inline void roll_add(const index_type &idx, const value_type &val)
+        requires std::floating_point<T>  { cov_.roll_add(idx, val, val); }
+    inline void roll_remove(const index_type &idx, const value_type &val)
+        requires std::floating_point<T>  { cov_.roll_remove(idx, val, val); }
+
+    // Reduce protocol (See reduce_visitor concept)
+    //
+    inline bool can_reduce() const  { return (true); }
+    inline void reduce(const VarVisitor &other)
+        requires std::is_arithmetic_v<T>  { cov_.reduce(other.cov_); }
+
     explicit VarVisitor(bool biased = false, bool skip_nan = false,
                         bool stable_algo = false)
         : cov_(biased, skip_nan, stable_algo)  {   }
@@ -2182,6 +2444,14 @@ public:
     inline const mean_t &get_mean() const  { return (var_.get_mean()); }
     data_t get_b() const  { return (var_.get_b()); }
 
+    // Rolling protocol (See rolling_visitor concept)
+    //
+    inline bool can_roll() const  { return (true); }
+    inline void roll_add(const index_type &idx, const value_type &val)
+        requires std::floating_point<T>  { var_.roll_add(idx, val); }
+    inline void roll_remove(const index_type &idx, const value_type &val)
+        requires std::floating_point<T>  { var_.roll_remove(idx, val); }
+
     explicit StdVisitor (bool biased = false, bool skip_nan = false,
                          bool stable_algo = false)
         : var_ (biased, skip_nan, stable_algo)  {   }
@@ -2812,6 +3082,30 @@ public:
         else  return (mean2_);
     }
 
+    // Rolling protocol (See rolling_visitor2 concept).
+    // Only Pearson correlation can be updated incrementally.
+    //
+    inline bool can_roll() const  {
+
+        return (type_ == correlation_type::pearson);
+    }
+    inline void roll_add(const index_type &idx,
+                         const value_type &val1, const value_type &val2)
+        requires std::floating_point<T>  { cov_.roll_add(idx, val1, val2); }
+    inline void roll_remove(const index_type &idx,
+                            const value_type &val1, const value_type &val2)
+        requires std::floating_point<T>  { cov_.roll_remove(idx, val1, val2); }
+
+    // Reduce protocol (See reduce_visitor concept).
+    // Only Pearson correlation can be computed from partial results.
+    //
+    inline bool can_reduce() const  {
+
+        return (type_ == correlation_type::pearson);
+    }
+    inline void reduce(const CorrVisitor &other)
+        requires std::is_arithmetic_v<T>  { cov_.reduce(other.cov_); }
+
     explicit
     CorrVisitor(correlation_type t = correlation_type::pearson,
                 bool biased = false,
@@ -3317,6 +3611,11 @@ using NMinSubArrayVisitor =
 
 // Simple rolling adoptor for visitors
 //
+// If the visitor supports the rolling protocol (See rolling_visitor and
+// rolling_visitor2 concepts), each step only adds the entering value and
+// removes the leaving one. Otherwise, the visitor is re-run over the whole
+// window at each step.
+//
 template<typename F, typename T, typename I = unsigned long, std::size_t A = 0>
 struct  SimpleRollAdopter  {
 
@@ -3325,6 +3624,12 @@ private:
     using visitor_type = F;
     using f_result_type = typename visitor_type::result_type;
 
+    // With the rolling protocol, the visitor is rebuilt from the window
+    // after this many full windows to stop the rounding errors of the
+    // incremental updates from drifting
+    //
+    static constexpr std::size_t    reseed_windows_ { 64 };
+
 public:
 
     DEFINE_VISIT_BASIC_TYPES
@@ -3348,6 +3653,36 @@ public:
         result_.reserve(col_s);
         for (size_type i = 0; i < roll_count_ - 1 && i < col_s; ++i) [[likely]]
             result_.push_back(std::numeric_limits<f_result_type>::quiet_NaN());
+
+        if constexpr (rolling_visitor<visitor_type>)  {
+            if (visitor_.can_roll())  {
+                const size_type reseed { roll_count_ * reseed_windows_ };
+
+                visitor_.pre();
+                for (size_type i = 0; i < col_s; ++i) [[likely]]  {
+                    if (i >= roll_count_)  {
+                        if ((i - roll_count_) % reseed == 0 && i > roll_count_)
+                            [[unlikely]]  {
+                            visitor_.pre();
+                            for (size_type j = i - roll_count_ + 1; j < i; ++j)
+                                visitor_.roll_add(*(idx_begin + j),
+                                                  *(column_begin + j));
+                        }
+                        else
+                            visitor_.roll_remove(
+                                *(idx_begin + (i - roll_count_)),
+                                *(column_begin + (i - roll_count_)));
+                    }
+                    visitor_.roll_add(*(idx_begin + i), *(column_begin + i));
+                    if (i + 1 >= roll_count_)  {
+                        visitor_.post();
+                        result_.push_back(visitor_.get_result());
+                    }
+                }
+                return;
+            }
+        }
+
         for (size_type i = 0; i < col_s; ++i) [[likely]]  {
             if (i + roll_count_ <= col_s)  {
                 visitor_.pre();
@@ -3360,6 +3695,73 @@ public:
         }
     }
 
+    // Rolling over two columns, for visitors such as CovVisitor and
+    // CorrVisitor
+    //
+    template <typename K, typename H>
+    inline void
+    operator()(const K &idx_begin, const K &idx_end,
+               const H &column_begin1, const H &column_end1,
+               const H &column_begin2, const H &column_end2)  {
+
+        const size_type col_s =
+            std::min({ std::distance(idx_begin, idx_end),
+                       std::distance(column_begin1, column_end1),
+                       std::distance(column_begin2, column_end2) });
+
+#ifdef HMDF_SANITY_EXCEPTIONS
+        if (roll_count_ == 0 || roll_count_ > col_s)
+            throw DataFrameError("SimpleRollAdopter: roll count must be <= "
+                                 "column size");
+#endif // HMDF_SANITY_EXCEPTIONS
+
+        result_.reserve(col_s);
+        for (size_type i = 0; i < roll_count_ - 1 && i < col_s; ++i) [[likely]]
+            result_.push_back(std::numeric_limits<f_result_type>::quiet_NaN());
+
+        if constexpr (rolling_visitor2<visitor_type>)  {
+            if (visitor_.can_roll())  {
+                const size_type reseed { roll_count_ * reseed_windows_ };
+
+                visitor_.pre();
+                for (size_type i = 0; i < col_s; ++i) [[likely]]  {
+                    if (i >= roll_count_)  {
+                        if ((i - roll_count_) % reseed == 0 && i > roll_count_)
+                            [[unlikely]]  {
+                            visitor_.pre();
+                            for (size_type j = i - roll_count_ + 1; j < i; ++j)
+                                visitor_.roll_add(*(idx_begin + j),
+                                                  *(column_begin1 + j),
+                                                  *(column_begin2 + j));
+                        }
+                        else
+                            visitor_.roll_remove(
+                                *(idx_begin + (i - roll_count_)),
+                                *(column_begin1 + (i - roll_count_)),
+                                *(column_begin2 + (i - roll_count_)));
+                    }
+                    visitor_.roll_add(*(idx_begin + i),
+                                      *(column_begin1 + i),
+                                      *(column_begin2 + i));
+                    if (i + 1 >= roll_count_)  {
+                        visitor_.post();
+                        result_.push_back(visitor_.get_result());
+                    }
+                }
+                return;
+            }
+        }
+
+        for (size_type i = 0; i + roll_count_ <= col_s; ++i) [[likely]]  {
+            visitor_.pre();
+            visitor_(idx_begin + i, idx_begin + (i + roll_count_),
+                     column_begin1 + i, column_begin1 + (i + roll_count_),
+                     column_begin2 + i, column_begin2 + (i + roll_count_));
+            visitor_.post();
+            result_.push_back(visitor_.get_result());
+        }
+    }
+
     inline void pre()  { visitor_.pre(); result_.clear(); }
     inline void post()  { visitor_.post(); }
     inline const result_type &get_result() const  { return (result_); }
@@ -3548,6 +3950,43 @@ struct  StatsVisitor  {
         return (result_type(value_type(n_) * m4_ / (m2_ * m2_) - 3.0));
     }
 
+    // Reduce protocol (See reduce_visitor concept).
+    // It merges the central moments of the two parts (Chan et al. and
+    // Pebay's pairwise formulas).
+    //
+    inline bool can_reduce() const  { return (true); }
+    inline void reduce(const StatsVisitor &other)  {
+
+        if (other.n_ == 0)  return;
+        if (n_ == 0)  {
+            n_ = other.n_;
+            m1_ = other.m1_;
+            m2_ = other.m2_;
+            m3_ = other.m3_;
+            m4_ = other.m4_;
+            return;
+        }
+
+        const value_type    na = value_type(n_);
+        const value_type    nb = value_type(other.n_);
+        const value_type    n = na + nb;
+        const value_type    delta = other.m1_ - m1_;
+        const value_type    delta_n = delta / n;
+        const value_type    delta_n2 = delta_n * delta_n;
+        const value_type    term1 = delta * delta_n * na * nb;
+
+        m4_ += other.m4_ +
+               term1 * delta_n2 * (na * na - na * nb + nb * nb) +
+               6.0 * delta_n2 * (na * na * other.m2_ + nb * nb * m2_) +
+               4.0 * delta_n * (na * other.m3_ - nb * m3_);
+        m3_ += other.m3_ +
+               term1 * delta_n * (na - nb) +
+               3.0 * delta_n * (na * other.m2_ - nb * m2_);
+        m2_ += other.m2_ + term1;
+        m1_ += delta_n * nb;
+        n_ += other.n_;
+    }
+
     DECL_CTOR(StatsVisitor)
 
 private:
@@ -5857,6 +6296,266 @@ using mad_v = MADVisitor<T, I, A>;
 
 // ----------------------------------------------------------------------------
 
+// Common part of the rolling order-statistic visitors below.
+// The values of the sliding window are kept in an OrderStatIndex, so each
+// step costs O(log(N)), instead of the O(window size) of rolling
+// MedianVisitor, QuantileVisitor or MADVisitor with SimpleRollAdopter.
+// Like SimpleRollAdopter, the first roll_count - 1 items of the result are
+// NaN. If skip_nan is false, windows that contain NaN produce NaN.
+//
+template<arithmetic T, typename I, std::size_t A>
+struct  RollingOrderStatBase  {
+
+    DEFINE_VISIT_BASIC_TYPES_3
+
+    DEFINE_PRE_POST
+    DEFINE_RESULT
+
+protected:
+
+    using index_t = OrderStatIndex<T>;
+    using sum_type = typename index_t::sum_type;
+
+    template<typename K, typename H, typename F>
+    inline void
+    roll_(const K &idx_begin, const K &idx_end,
+          const H &column_begin, const H &column_end,
+          F &&calc)  {
+
+        GET_COL_SIZE
+
+#ifdef HMDF_SANITY_EXCEPTIONS
+        if (roll_count_ == 0 || roll_count_ > col_s)
+            throw DataFrameError("RollingOrderStat: roll count must be <= "
+                                 "column size");
+#endif // HMDF_SANITY_EXCEPTIONS
+
+        index_t     window { column_begin, column_begin + col_s };
+        size_type   nan_cnt { 0 };
+
+        result_.reserve(col_s);
+        for (size_type i = 0; i < col_s; ++i) [[likely]]  {
+            const value_type    &in_val = *(column_begin + i);
+
+            if (is_nan__(in_val)) [[unlikely]]  nan_cnt += 1;
+            else  window.insert(in_val);
+            if (i >= roll_count_)  {
+                const value_type    &out_val =
+                    *(column_begin + (i - roll_count_));
+
+                if (is_nan__(out_val)) [[unlikely]]  nan_cnt -= 1;
+                else  window.erase(out_val);
+            }
+
+            if (i + 1 < roll_count_ ||
+                (nan_cnt > 0 && ! skip_nan_) ||
+                window.empty())
+                result_.push_back(std::numeric_limits<T>::quiet_NaN());
+            else
+                result_.push_back(calc(std::as_const(window)));
+        }
+    }
+
+    inline static sum_type median_(const index_t &window)  {
+
+        const size_type n = window.size();
+
+        if (n & 0x01)  return (sum_type(window.kth((n >> 1) + 1)));
+        return ((sum_type(window.kth(n >> 1)) +
+                 sum_type(window.kth((n >> 1) + 1))) / sum_type(2));
+    }
+    inline static sum_type
+    median_abs_dev_(const index_t &window, sum_type center)  {
+
+        const size_type n = window.size();
+
+        if (n & 0x01)  return (window.kth_abs_dev(center, (n >> 1) + 1));
+        return ((window.kth_abs_dev(center, n >> 1) +
+                 window.kth_abs_dev(center, (n >> 1) + 1)) / sum_type(2));
+    }
+
+    RollingOrderStatBase(size_type roll_count, bool skipnan)
+        : roll_count_(roll_count), skip_nan_(skipnan)  {   }
+
+    const size_type roll_count_;
+    const bool      skip_nan_;
+    result_type     result_ { };
+};
+
+// ----------------------------------------------------------------------------
+
+// Rolling median over windows of roll_count items
+//
+template<arithmetic T, typename I = unsigned long, std::size_t A = 0>
+struct  RollingMedianVisitor : public RollingOrderStatBase<T, I, A>  {
+
+    using BaseClass = RollingOrderStatBase<T, I, A>;
+    using value_type = typename BaseClass::value_type;
+
+    template <typename K, typename H>
+    inline void
+    operator() (const K &idx_begin, const K &idx_end,
+                const H &column_begin, const H &column_end)  {
+
+        BaseClass::roll_(idx_begin, idx_end, column_begin, column_end,
+                         [](const auto &window) -> value_type  {
+                             return (value_type(BaseClass::median_(window)));
+                         });
+    }
+
+    explicit
+    RollingMedianVisitor(std::size_t roll_count, bool skipnan = false)
+        : BaseClass(roll_count, skipnan)  {   }
+};
+
+template<typename T, typename I = unsigned long, std::size_t A = 0>
+using rmed_v = RollingMedianVisitor<T, I, A>;
+
+// ----------------------------------------------------------------------------
+
+// Rolling quantile over windows of roll_count items.
+// The quantile is calculated the same way as QuantileVisitor.
+//
+template<arithmetic T, typename I = unsigned long, std::size_t A = 0>
+struct  RollingQuantileVisitor : public RollingOrderStatBase<T, I, A>  {
+
+    using BaseClass = RollingOrderStatBase<T, I, A>;
+    using value_type = typename BaseClass::value_type;
+    using size_type = typename BaseClass::size_type;
+
+    template <typename K, typename H>
+    inline void
+    operator() (const K &idx_begin, const K &idx_end,
+                const H &column_begin, const H &column_end)  {
+
+#ifdef HMDF_SANITY_EXCEPTIONS
+        if (qt_ < 0.0 || qt_ > 1.0)
+            throw DataFrameError("RollingQuantileVisitor: qt must >= 0 and "
+                                 "<= 1");
+#endif // HMDF_SANITY_EXCEPTIONS
+
+        BaseClass::roll_(idx_begin, idx_end, column_begin, column_end,
+                         [this](const auto &window) -> value_type  {
+                             return (this->quantile_(window));
+                         });
+    }
+
+    explicit
+    RollingQuantileVisitor(std::size_t roll_count,
+                           double quantile = 0.5,
+                           quantile_policy q_policy =
+                               quantile_policy::mid_point,
+                           bool skipnan = false)
+        : BaseClass(roll_count, skipnan),
+          qt_(quantile),
+          policy_(q_policy)  {   }
+
+private:
+
+    inline value_type
+    quantile_(const typename BaseClass::index_t &window) const  {
+
+        const size_type n = window.size();
+
+        if (qt_ == 0.0)  return (window.kth(1));
+        if (qt_ == 1.0)  return (window.kth(n));
+
+        const double    vec_len_frac = qt_ * double(n);
+        const size_type int_idx =
+            std::clamp(static_cast<size_type>(std::round(vec_len_frac)),
+                       size_type(1), n);
+        const bool      need_two =
+            ! (n & 0x01) || double(int_idx) < vec_len_frac;
+
+        if (policy_ == quantile_policy::lower_value)
+            return (window.kth(int_idx));
+        if (policy_ == quantile_policy::higher_value)
+            return (window.kth(int_idx + 1 < n && need_two
+                                   ? int_idx + 1 : int_idx));
+
+        value_type  result = window.kth(int_idx);
+
+        if (need_two && int_idx + 1 < n)  {
+            const value_type    result2 = window.kth(int_idx + 1);
+
+            if (policy_ == quantile_policy::mid_point)
+                result = (result + result2) / 2.0;
+            else // linear
+                result = result + (result2 - result) * (1.0 - qt_);
+        }
+        return (result);
+    }
+
+    const double            qt_;
+    const quantile_policy   policy_;
+};
+
+template<typename T, typename I = unsigned long, std::size_t A = 0>
+using rqt_v = RollingQuantileVisitor<T, I, A>;
+
+// ----------------------------------------------------------------------------
+
+// Rolling mean/median absolute deviation over windows of roll_count items.
+// See mad_type and MADVisitor.
+//
+template<arithmetic T, typename I = unsigned long, std::size_t A = 0>
+struct  RollingMADVisitor : public RollingOrderStatBase<T, I, A>  {
+
+    using BaseClass = RollingOrderStatBase<T, I, A>;
+    using value_type = typename BaseClass::value_type;
+
+    template <typename K, typename H>
+    inline void
+    operator() (const K &idx_begin, const K &idx_end,
+                const H &column_begin, const H &column_end)  {
+
+        BaseClass::roll_(idx_begin, idx_end, column_begin, column_end,
+                         [this](const auto &window) -> value_type  {
+                             return (this->mad_(window));
+                         });
+    }
+
+    explicit
+    RollingMADVisitor(std::size_t roll_count,
+                      mad_type mt,
+                      bool skipnan = false)
+        : BaseClass(roll_count, skipnan), mad_type_(mt)  {   }
+
+private:
+
+    using sum_type = typename BaseClass::sum_type;
+
+    inline value_type
+    mad_(const typename BaseClass::index_t &window) const  {
+
+        const sum_type  n = sum_type(window.size());
+
+        switch (mad_type_)  {
+            case mad_type::mean_abs_dev_around_mean:
+                return (value_type(window.abs_dev_sum(window.sum() / n) / n));
+            case mad_type::mean_abs_dev_around_median:
+                return (value_type(
+                    window.abs_dev_sum(BaseClass::median_(window)) / n));
+            case mad_type::median_abs_dev_around_mean:
+                return (value_type(
+                    BaseClass::median_abs_dev_(window, window.sum() / n)));
+            case mad_type::median_abs_dev_around_median:
+                return (value_type(
+                    BaseClass::median_abs_dev_(window,
+                                               BaseClass::median_(window))));
+            default:
+                return (std::numeric_limits<value_type>::quiet_NaN());
+        }
+    }
+
+    const mad_type  mad_type_;
+};
+
+template<typename T, typename I = unsigned long, std::size_t A = 0>
+using rmad_v = RollingMADVisitor<T, I, A>;
+
+// ----------------------------------------------------------------------------
+
 template<arithmetic T, typename I = unsigned long, std::size_t A = 0>
 struct  DiffVisitor  {
 
@@ -34,6 +34,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Utils/FixedSizeString.h>
 #include <DataFrame/Utils/DateTime.h>
 #include <DataFrame/Utils/MetaProg.h>
+#include <DataFrame/Utils/Timestamp.h>
 
 #include <complex>
 #include <limits>
@@ -152,6 +153,63 @@ enum class  join_policy : unsigned char  {
 
 // ----------------------------------------------------------------------------
 
+// Algorithm used by join_by_index() and join_by_column() to match the keys.
+// It does not change which rows are joined, only the order of the rows in
+// the result.
+//
+enum class  join_strategy : unsigned char  {
+
+    // Default:
+    // Sort both sides and merge them. Result rows are in key order.
+    //
+    sort_merge = 1,
+
+    // Build a hash table on the smaller side and probe it with the larger
+    // side, in parallel chunks. Result rows are in the larger side's
+    // original order. For outer joins, the unmatched rows of the smaller
+    // side come last. The key type must be hashable.
+    //
+    hash = 2,
+
+    // Merge without sorting, if both sides are already sorted. Otherwise,
+    // hash join if one side is at least 8 times larger than the other and
+    // the key type is hashable. Otherwise, sort_merge.
+    //
+    automatic = 3,
+};
+
+// ----------------------------------------------------------------------------
+
+// Comparison operators for selecting rows by comparing a column with a
+// constant, in get_data_by_sel() and get_view_by_sel()
+//
+enum class  compare_op : unsigned char  {
+
+    eq = 1,  // column == value
+    ne = 2,  // column != value
+    lt = 3,  // column < value
+    le = 4,  // column <= value
+    gt = 5,  // column > value
+    ge = 6,  // column >= value
+};
+
+// ----------------------------------------------------------------------------
+
+// Order of the groups in the result of hash_groupby1/2/3()
+//
+enum class  group_order : unsigned char  {
+
+    // Groups appear in the order their key is first seen in the column(s)
+    //
+    first_seen = 1,
+
+    // Groups appear in ascending key order, the same as groupby1/2/3()
+    //
+    sorted = 2,
+};
+
+// ----------------------------------------------------------------------------
+
 enum class  gen_join_type : unsigned char  {
 
     no_match = 1,
@@ -387,6 +445,13 @@ enum class  io_format : unsigned char  {
     markdown = 7,
     latex = 8,
     html = 9,
+
+    // DataFrame specific binary format that is laid out to be memory-mapped.
+    // Every column starts at an aligned offset and the file ends with a
+    // directory of columns. It can be written to any stream, but it can only
+    // be read from a file.
+    //
+    mmap_binary = 10,
 };
 
 // ----------------------------------------------------------------------------
@@ -864,6 +929,7 @@ enum class  file_dtypes : std::size_t  {
     STR_SET = 33,         // std::set<std::string>
     STR_DBL_MAP = 34,     // std::map<std::string, double>
     STR_DBL_UNOMAP = 35,  // std::unordered_map<std::string, double>
+    TIMESTAMP = 36,       // Timestamp
 };
 
 // ----------------------------------------------------------------------------
@@ -1015,6 +1081,26 @@ struct  ReadParams  {
     // (separating) character.
     //
     char        delim { ',' };
+
+    // These only apply to csv2 format, when read() is given a file name.
+    // If chunk_size is nonzero, the file is memory-mapped and split at line
+    // boundaries into chunks of roughly chunk_size bytes. The chunks are
+    // parsed in parallel on the DataFrame thread pool and the column pieces
+    // are concatenated in file order. With fewer than 3 threads in the pool,
+    // the chunks are parsed serially.
+    // num_threads caps the number of threads used for parsing. 0 means use
+    // all the threads in the pool.
+    //
+    std::size_t chunk_size { 0 };
+    std::size_t num_threads { 0 };
+
+    // This only applies to mmap_binary format.
+    // If true, the file stays memory-mapped and only the index column is
+    // loaded by read(). Each data column is loaded the first time it is
+    // accessed by get_column(). Also, arithmetic columns can be accessed in
+    // place through get_mapped_column() without being loaded at all.
+    //
+    bool        lazy_load { false };
 };
 
 // ----------------------------------------------------------------------------
@@ -1049,6 +1135,21 @@ struct  WriteParams  {
     // (separating) character.
     //
     char            delim { ',' };
+
+    // This only applies to csv2 and json formats. Rows are formatted in
+    // chunks of this many rows into reusable buffers. Each buffer is written
+    // to the stream in one call. Values <= 0 format all rows as one chunk.
+    //
+    long            chunk_rows { 16 * 1024 };
+
+    // This only applies to csv2 and json formats. It is the max number of
+    // chunks formatted at the same time by the DataFrame thread-pool.
+    // Chunks are always written in order, so the output is the same
+    // regardless of this value.
+    // 0 means use all the pool threads, if the DataFrame thread level is
+    // above 2. 1 formats all chunks in the calling thread.
+    //
+    long            threads { 0 };
 };
 
 // ----------------------------------------------------------------------------
@@ -1297,6 +1398,25 @@ struct  KrigingParams  {
 
 // ----------------------------------------------------------------------------
 
+// Random number engines behind the gen_*_dist() functions
+//
+enum class  rand_engine : unsigned char  {
+
+    // std::mt19937_64. Numbers are generated serially, one after another
+    //
+    mersenne_twister = 1,
+    // Philox4x32-10 counter-based engine. Numbers are generated in fixed
+    // chunks, each from its own stream, in parallel if the thread level
+    // allows. For a given seed, the numbers are the same regardless of the
+    // thread level. It is much faster for uniform real, exponential,
+    // normal and lognormal distributions. But the numbers are different
+    // from mersenne_twister numbers with the same seed.
+    //
+    philox = 2,
+};
+
+// ----------------------------------------------------------------------------
+
 template<typename T>
 struct  RandGenParams  {
 
@@ -1304,6 +1424,7 @@ struct  RandGenParams  {
     T   max_value { std::numeric_limits<T>::max() };
 
     unsigned int    seed { static_cast<unsigned int>(-1) };
+    rand_engine     engine { rand_engine::mersenne_twister };
 
     // The p distribution parameter (probability of generating true)
     //
@@ -54,6 +54,7 @@ DataFrame<I, H>::operator= (const DataFrame &that)  {
         indices_ = that.indices_;
         column_tb_ = that.column_tb_;
         column_list_ = that.column_list_;
+        mapped_cols_ = that.mapped_cols_;
 
         const SpinGuard guard(lock_);
 
@@ -167,6 +168,7 @@ DataFrame<I, H>::operator= (DataFrame &&that)  {
         indices_ = std::exchange(that.indices_, IndexVecType { });
         column_tb_ = std::exchange(that.column_tb_, ColNameDict { });
         column_list_ = std::exchange(that.column_list_, ColNameList { });
+        mapped_cols_ = std::move(that.mapped_cols_);
 
         const SpinGuard guard(lock_);
 
@@ -213,6 +215,20 @@ void DataFrame<I, H>::remove_lock ()  { lock_ = nullptr; }
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+void DataFrame<I, H>::set_permute_mem_budget (size_type bytes)  {
+
+    permute_mem_budget_ = bytes;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+typename DataFrame<I, H>::size_type
+DataFrame<I, H>::get_permute_mem_budget ()  { return (permute_mem_budget_); }
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename ... Ts>
 void
@@ -222,55 +238,65 @@ DataFrame<I, H>::shuffle(const StlVecType<const char *> &col_names,
 
     std::random_device  rd;
     std::mt19937        g ((seed != seed_t(-1)) ? seed : rd());
-    std::future<void>   idx_future;
     const auto          thread_level =
         (indices_.size() < ThreadPool::MUL_THR_THHOLD)
             ? 0L : get_thread_level();
 
-    if (also_shuffle_index)  {
-        if (thread_level > 2)  {
-            auto    lbd = [&g, this] () -> void  {
-                std::shuffle(this->indices_.begin(), this->indices_.end(), g);
-            };
+    // Each column is shuffled by its own permutation. Their seeds are
+    // drawn here, so the result only depends on seed and not on threads.
+    //
+    StlVecType<std::pair<size_type, std::mt19937::result_type>>  cols;
 
-            idx_future = thr_pool_.dispatch(false, lbd);
-        }
-        else
-            std::shuffle(indices_.begin(), indices_.end(), g);
-    }
+    cols.reserve(col_names.size());
+    for (const auto &name_citer : col_names) [[likely]]  {
+        const auto  citer = column_tb_.find (name_citer);
 
-    shuffle_functor_<Ts ...>    functor (g);
-    auto                        lbd =
-        [&functor, this](const auto &name_citer) -> void  {
-            const auto  citer = this->column_tb_.find (name_citer);
+        if (citer == column_tb_.end()) [[unlikely]]  {
+            char buffer [512];
 
-            if (citer == this->column_tb_.end()) [[unlikely]]  {
-                char buffer [512];
+            snprintf(buffer, sizeof(buffer) - 1,
+                    "DataFrame::shuffle(): ERROR: Cannot find column '%s'",
+                     name_citer);
+            throw ColNotFound(buffer);
+        }
+        cols.emplace_back(citer->second, g());
+    }
 
-                snprintf(buffer, sizeof(buffer) - 1,
-                        "DataFrame::shuffle(): ERROR: Cannot find column '%s'",
-                         name_citer);
-                throw ColNotFound(buffer);
-            }
+    const auto  idx_seed = g();
+    auto        idx_lbd = [idx_seed, this] () -> void  {
+        std::mt19937            idx_g (idx_seed);
+        StlVecType<size_type>   perm (this->indices_.size());
 
-            this->data_[citer->second].change(functor);
-        };
-    const SpinGuard             guard (lock_);
+        std::iota(perm.begin(), perm.end(), size_type(0));
+        std::shuffle(perm.begin(), perm.end(), idx_g);
+        permute_in_place_(this->indices_, perm, false);
+    };
+    const SpinGuard guard (lock_);
 
     if (thread_level > 2)  {
         std::vector<std::future<void>>  futures;
 
-        futures.reserve(col_names.size());
-        for (const auto &name_citer : col_names) [[likely]]
-            futures.emplace_back(thr_pool_.dispatch(
-                false, lbd, std::cref(name_citer)));
-
-        if (idx_future.valid())  idx_future.get();
+        futures.reserve(cols.size() + 1);
+        if (also_shuffle_index)
+            futures.emplace_back(thr_pool_.dispatch(false, idx_lbd));
+        for (const auto &[idx, col_seed] : cols) [[likely]]
+            futures.emplace_back(
+                thr_pool_.dispatch(
+                    false,
+                    [idx = idx, col_seed = col_seed, this]() -> void  {
+                        shuffle_functor_<Ts ...>    functor (col_seed);
+
+                        this->data_[idx].change(functor);
+                    }));
         for (auto &fut : futures)  fut.get();
     }
     else  {
-        for (const auto &name_citer : col_names) [[likely]]
-            lbd(name_citer);
+        if (also_shuffle_index)  idx_lbd();
+        for (const auto &[idx, col_seed] : cols) [[likely]]  {
+            shuffle_functor_<Ts ...>    functor (col_seed);
+
+            data_[idx].change(functor);
+        }
     }
 }
 
@@ -1016,53 +1042,324 @@ groupby3_async(const char *col_name1,
 // ----------------------------------------------------------------------------
 
 template<typename I, typename H>
-template<hashable_equal T>
-DataFrame<T, HeteroVector<std::size_t(H::align_value)>>
-DataFrame<I, H>::value_counts (const char *col_name) const  {
+template<hashable_equal T, typename I_V, typename ... Ts>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
+hash_groupby1(const char *col_name,
+              group_order order,
+              I_V &&idx_visitor,
+              Ts&& ... args) const  {
 
-    const ColumnVecType<T>  &vec = get_column<T>(col_name);
-    auto                    hash_func =
-        [](std::reference_wrapper<const T> v) -> std::size_t  {
-            return(std::hash<T>{}(v.get()));
-    };
-    auto                    equal_func =
-        [](std::reference_wrapper<const T> lhs,
-           std::reference_wrapper<const T> rhs) -> bool  {
-            return(lhs.get() == rhs.get());
-    };
+    const ColumnVecType<T>  *gb_vec { nullptr };
 
-    using map_t =
-        DFUnorderedMap<typename std::reference_wrapper<const T>::type,
-                       size_type,
-                       decltype(hash_func),
-                       decltype(equal_func)>;
-    using res_t = DataFrame<T, HeteroVector<align_value>>;
+    if (! ::strcmp(col_name, DF_INDEX_COL_NAME))
+        gb_vec = (const ColumnVecType<T> *) &(get_index());
+    else
+        gb_vec = (const ColumnVecType<T> *) &(get_column<T>(col_name));
 
-    map_t       values_map(vec.size(), hash_func, equal_func);
-    size_type   nan_count = 0;
+    const StlVecType<std::size_t>   sort_v =
+        hash_group_perm_(order, gb_vec->size(), *gb_vec);
 
-    // take care of nans
-    for (const auto &citer : vec) [[likely]]  {
-        if (is_nan<T>(citer)) [[unlikely]]  {
-            ++nan_count;
-            continue;
-        }
+    using res_t = DataFrame<I, HeteroVector<std::size_t(H::align_value)>>;
+
+    res_t   result;
+    auto    args_tuple = std::tuple<Ts ...>(args ...);
+    auto    func =
+        [this,
+         &result,
+         &gb_vec = std::as_const(*gb_vec),
+         &sort_v = std::as_const(sort_v),
+         idx_visitor = std::forward<I_V>(idx_visitor),
+         col_name](auto &triple) mutable -> void {
+            _load_groupby_data_1_(*this,
+                                  result,
+                                  triple,
+                                  idx_visitor,
+                                  gb_vec,
+                                  sort_v,
+                                  col_name);
+        };
+
+    const SpinGuard guard(lock_);
+
+    for_each_in_tuple (args_tuple, func);
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<hashable_equal T1, hashable_equal T2, typename I_V, typename ... Ts>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
+hash_groupby2(const char *col_name1,
+              const char *col_name2,
+              group_order order,
+              I_V &&idx_visitor,
+              Ts&& ... args) const  {
+
+    const ColumnVecType<T1> *gb_vec1 { nullptr };
+    const ColumnVecType<T2> *gb_vec2 { nullptr };
+    const SpinGuard         guard (lock_);
+
+    if (! ::strcmp(col_name1, DF_INDEX_COL_NAME))  {
+        gb_vec1 = (const ColumnVecType<T1> *) &(get_index());
+        gb_vec2 =
+            (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
+    }
+    else if (! ::strcmp(col_name2, DF_INDEX_COL_NAME))  {
+        gb_vec1 =
+            (const ColumnVecType<T1> *) &(get_column<T1>(col_name1, false));
+        gb_vec2 = (const ColumnVecType<T2> *) &(get_index());
+    }
+    else  {
+        gb_vec1 =
+            (const ColumnVecType<T1> *) &(get_column<T1>(col_name1, false));
+        gb_vec2 =
+            (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
+    }
+
+    const StlVecType<std::size_t>   sort_v =
+        hash_group_perm_(order,
+                         std::min(gb_vec1->size(), gb_vec2->size()),
+                         *gb_vec1,
+                         *gb_vec2);
+
+    using res_t = DataFrame<I, HeteroVector<std::size_t(H::align_value)>>;
+
+    res_t   res;
+    auto    args_tuple = std::tuple<Ts ...>(args ...);
+    auto    func =
+        [this,
+         &res,
+         &gb_vec1 = std::as_const(*gb_vec1),
+         &gb_vec2 = std::as_const(*gb_vec2),
+         &sort_v = std::as_const(sort_v),
+         idx_visitor = std::forward<I_V>(idx_visitor),
+         col_name1,
+         col_name2](auto &triple) mutable -> void {
+            _load_groupby_data_2_(*this,
+                                  res,
+                                  triple,
+                                  idx_visitor,
+                                  gb_vec1,
+                                  gb_vec2,
+                                  sort_v,
+                                  col_name1,
+                                  col_name2);
+        };
+
+    for_each_in_tuple (args_tuple, func);
+    return (res);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<hashable_equal T1, hashable_equal T2, hashable_equal T3,
+         typename I_V, typename ... Ts>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
+hash_groupby3(const char *col_name1,
+              const char *col_name2,
+              const char *col_name3,
+              group_order order,
+              I_V &&idx_visitor,
+              Ts&& ... args) const  {
+
+    const ColumnVecType<T1> *gb_vec1 { nullptr };
+    const ColumnVecType<T2> *gb_vec2 { nullptr };
+    const ColumnVecType<T3> *gb_vec3 { nullptr };
+    const SpinGuard         guard (lock_);
 
-        auto    insert_result = values_map.emplace(std::ref(citer), 1);
+    if (! ::strcmp(col_name1, DF_INDEX_COL_NAME))  {
+        gb_vec1 = (const ColumnVecType<T1> *) &(get_index());
+        gb_vec2 =
+            (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
+        gb_vec3 =
+            (const ColumnVecType<T3> *) &(get_column<T3>(col_name3, false));
+    }
+    else if (! ::strcmp(col_name2, DF_INDEX_COL_NAME))  {
+        gb_vec1 =
+            (const ColumnVecType<T1> *) &(get_column<T1>(col_name1, false));
+        gb_vec2 =
+            (const ColumnVecType<T2> *) &(get_index());
+        gb_vec3 =
+            (const ColumnVecType<T3> *) &(get_column<T3>(col_name3, false));
+    }
+    else if (! ::strcmp(col_name3, DF_INDEX_COL_NAME))  {
+        gb_vec1 =
+            (const ColumnVecType<T1> *) &(get_column<T1>(col_name1, false));
+        gb_vec2 =
+            (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
+        gb_vec3 = (const ColumnVecType<T3> *) &(get_index());
+    }
+    else  {
+        gb_vec1 =
+            (const ColumnVecType<T1> *) &(get_column<T1>(col_name1, false));
+        gb_vec2 =
+            (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
+        gb_vec3 =
+            (const ColumnVecType<T3> *) &(get_column<T3>(col_name3, false));
+    }
+
+    const StlVecType<std::size_t>   sort_v =
+        hash_group_perm_(
+            order,
+            std::min({ gb_vec1->size(), gb_vec2->size(), gb_vec3->size() }),
+            *gb_vec1,
+            *gb_vec2,
+            *gb_vec3);
+
+    using res_t = DataFrame<I, HeteroVector<std::size_t(H::align_value)>>;
+
+    res_t   res;
+    auto    args_tuple = std::tuple<Ts ...>(args ...);
+    auto    func =
+        [this,
+         &res,
+         &gb_vec1 = std::as_const(*gb_vec1),
+         &gb_vec2 = std::as_const(*gb_vec2),
+         &gb_vec3 = std::as_const(*gb_vec3),
+         &sort_v = std::as_const(sort_v),
+         idx_visitor = std::forward<I_V>(idx_visitor),
+         col_name1,
+         col_name2,
+         col_name3](auto &triple) mutable -> void {
+            _load_groupby_data_3_(*this,
+                                  res,
+                                  triple,
+                                  idx_visitor,
+                                  gb_vec1,
+                                  gb_vec2,
+                                  gb_vec3,
+                                  sort_v,
+                                  col_name1,
+                                  col_name2,
+                                  col_name3);
+        };
+
+    for_each_in_tuple (args_tuple, func);
+    return (res);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<hashable_equal T, typename I_V, typename ... Ts>
+std::future<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>>
+DataFrame<I, H>::
+hash_groupby1_async(const char *col_name,
+                    group_order order,
+                    I_V &&idx_visitor,
+                    Ts&& ... args) const {
+
+    return (thr_pool_.dispatch(
+        true,
+        [col_name, order, idx_visitor = std::forward<I_V>(idx_visitor),
+         ... args = std::forward<Ts>(args), this]() mutable -> DataFrame  {
+            return (this->hash_groupby1<T, I_V, Ts ...>(
+                        col_name,
+                        order,
+                        std::forward<I_V>(idx_visitor),
+                        std::forward<Ts>(args) ...));
+        }));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<hashable_equal T1, hashable_equal T2, typename I_V, typename ... Ts>
+std::future<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>>
+DataFrame<I, H>::
+hash_groupby2_async(const char *col_name1,
+                    const char *col_name2,
+                    group_order order,
+                    I_V &&idx_visitor,
+                    Ts&& ... args) const  {
+
+    return (thr_pool_.dispatch(
+        true,
+        [col_name1, col_name2, order,
+         idx_visitor = std::forward<I_V>(idx_visitor),
+         ... args = std::forward<Ts>(args),
+         this]() mutable -> DataFrame  {
+            return (this->hash_groupby2<T1, T2, I_V, Ts ...>(
+                        col_name1,
+                        col_name2,
+                        order,
+                        std::forward<I_V>(idx_visitor),
+                        std::forward<Ts>(args) ...));
+        }));
+}
 
-        if (insert_result.second == false)
-            insert_result.first->second += 1;
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<hashable_equal T1, hashable_equal T2, hashable_equal T3,
+         typename I_V, typename ... Ts>
+std::future<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>>
+DataFrame<I, H>::
+hash_groupby3_async(const char *col_name1,
+                    const char *col_name2,
+                    const char *col_name3,
+                    group_order order,
+                    I_V &&idx_visitor,
+                    Ts&& ... args) const  {
+
+    return (thr_pool_.dispatch(
+        true,
+        [col_name1, col_name2, col_name3, order,
+         idx_visitor = std::forward<I_V>(idx_visitor),
+         ... args = std::forward<Ts>(args),
+         this]() mutable -> DataFrame  {
+            return (this->hash_groupby3<T1, T2, T3, I_V, Ts ...>(
+                        col_name1,
+                        col_name2,
+                        col_name3,
+                        order,
+                        std::forward<I_V>(idx_visitor),
+                        std::forward<Ts>(args) ...));
+        }));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<hashable_equal T>
+DataFrame<T, HeteroVector<std::size_t(H::align_value)>>
+DataFrame<I, H>::value_counts (const char *col_name) const  {
+
+    using res_t = DataFrame<T, HeteroVector<align_value>>;
+
+    const ColumnVecType<T>  &vec = get_column<T>(col_name);
+    const size_type         col_s = vec.size();
+    const auto              row_groups =
+        group_rows_(col_s,
+                    true,
+                    [&vec](size_type r) -> bool  {
+                        return (! is_nan<T>(vec[r]));
+                    },
+                    vec);
+
+    // nans are left out of the groups and counted together
+    //
+    size_type   nan_count = col_s;
+    size_type   groups_cnt = 0;
+
+    for (const auto &table : row_groups)  {
+        nan_count -= table.rows();
+        groups_cnt += table.groups();
     }
 
     typename res_t::IndexVecType                        res_indices;
     typename res_t::template ColumnVecType<size_type>   counts;
 
-    counts.reserve(values_map.size());
-    res_indices.reserve(values_map.size());
+    counts.reserve(groups_cnt + 1);
+    res_indices.reserve(groups_cnt + 1);
 
-    for (const auto &citer : values_map) [[likely]]  {
-        res_indices.push_back(citer.first);
-        counts.emplace_back(citer.second);
+    for (const auto &table : row_groups)  {
+        for (size_type g = 0; g < table.groups(); ++g) [[likely]]  {
+            res_indices.push_back(vec[table.first_row(g)]);
+            counts.emplace_back(table.group_size(g));
+        }
     }
     if (nan_count > 0)  {
         res_indices.push_back(get_nan<T>());
@@ -2070,15 +2367,15 @@ bucketize_async(bucket_type bt,
 
 template<typename I, typename H>
 template<typename I_V, typename ... Ts>
-DataFrame<DateTime, H>
+DataFrame<I, H>
 DataFrame<I, H>::
 resample(time_frequency tf,
          size_type interval_num,
          I_V &&idx_visitor,
          Ts && ... args) const
-    requires std::same_as<I, DateTime>  {
+    requires DateTime_or_Timestamp<I>  {
 
-    using res_t = DataFrame<DateTime, H>;
+    using res_t = DataFrame<I, H>;
 
     res_t           result;
     auto            &dst_idx = result.get_index();
@@ -2123,15 +2420,15 @@ resample(time_frequency tf,
 
 template<typename I, typename H>
 template<typename I_V, typename ... Ts>
-std::future<DataFrame<DateTime, H>>
+std::future<DataFrame<I, H>>
 DataFrame<I, H>::
 resample_async(time_frequency tf,
                size_type interval_num,
                I_V &&idx_visitor,
                Ts && ... args) const
-    requires std::same_as<I, DateTime>  {
+    requires DateTime_or_Timestamp<I>  {
 
-    using res_t = DataFrame<DateTime, H>;
+    using res_t = DataFrame<I, H>;
 
     return (thr_pool_.dispatch(
         true,
@@ -78,12 +78,11 @@ struct  remove_column_functor_ : DataVec::template visitor_base<Ts ...>  {
 template<typename ... Ts>
 struct  sort_functor_ : DataVec::template visitor_base<Ts ...>  {
 
-    inline sort_functor_ (const StlVecType<size_t> &si, size_t is)
-        : sorted_idxs(si), idx_s(is), done_vec(idx_s)  {   }
+    inline sort_functor_ (const StlVecType<size_t> &si, bool par = false)
+        : sorted_idxs(si), parallel(par)  {   }
 
     const StlVecType<size_t>   &sorted_idxs;
-    const size_t               idx_s;
-    StlVecType<char>           done_vec;
+    const bool                 parallel;  // Gather with all threads
 
     template<typename T2>
     void operator() (T2 &vec);
@@ -278,14 +277,19 @@ struct  print_json_functor_ : DataVec::template visitor_base<Ts ...>  {
                                 bool npc,
                                 std::ostream &o,
                                 long sr,
-                                long er)
-        : name(n), need_pre_comma(npc), start_row(sr), end_row(er), os(o) {   }
+                                long er,
+                                const DataFrame &d,
+                                const WriteParams<> &p)
+        : name(n), need_pre_comma(npc), start_row(sr), end_row(er), os(o),
+          df(d), params(p)  {   }
 
-    const char      *name;
-    const bool      need_pre_comma;
-    const long      start_row;
-    const long      end_row;
-    std::ostream    &os;
+    const char          *name;
+    const bool          need_pre_comma;
+    const long          start_row;
+    const long          end_row;
+    std::ostream        &os;
+    const DataFrame     &df;
+    const WriteParams<> &params;
 
     template<typename T>
     void operator() (const T &vec);
@@ -311,15 +315,12 @@ struct  print_csv2_header_functor_ : DataVec::template visitor_base<Ts ...>  {
 
 // ----------------------------------------------------------------------------
 
-template<typename S, typename ... Ts>
-struct  print_csv2_data_functor_ : DataVec::template visitor_base<Ts ...>  {
+template<typename ... Ts>
+struct  csv2_cell_functor_ : DataVec::template visitor_base<Ts ...>  {
 
-    inline print_csv2_data_functor_ (std::size_t i, S &o, DT_FORMAT dtf)
-        : index(i), os(o), dt_format(dtf)  {  }
+    inline csv2_cell_functor_ (csv2_cell_ &c) : cell(c)  {  }
 
-    const std::size_t   index;
-    S                   &os;
-    const DT_FORMAT     dt_format;
+    csv2_cell_  &cell;
 
     template<typename T>
     void operator() (const T &vec);
@@ -572,13 +573,19 @@ struct  sel_load_functor_ : DataVec::template visitor_base<Ts ...>  {
     inline sel_load_functor_ (const char *n,
                               const StlVecType<IT> &si,
                               size_type is,
-                              DF &d)
-        : name (n), sel_indices (si), indices_size(is), df(d)  {   }
+                              DF &d,
+                              bool pg = false)
+        : name (n),
+          sel_indices (si),
+          indices_size(is),
+          df(d),
+          par_gather(pg)  {   }
 
     const char              *name;
     const StlVecType<IT>    &sel_indices;
     const size_type         indices_size;
     DF                      &df;
+    const bool              par_gather;  // Gather with all threads
 
     template<typename T>
     void operator() (const T &vec);
@@ -638,9 +645,9 @@ struct  sel_remove_functor_ : DataVec::template visitor_base<Ts ...>  {
 template<typename ... Ts>
 struct  shuffle_functor_ : DataVec::template visitor_base<Ts ...>  {
 
-    inline shuffle_functor_ (std::mt19937 &g) : g_(g)  {  }
+    inline shuffle_functor_ (std::mt19937::result_type s) : seed(s)  {  }
 
-    std::mt19937    &g_;
+    const std::mt19937::result_type seed;
 
     template<typename T>
     void operator() (T &vec) const;
@@ -704,24 +711,6 @@ struct  columns_info_functor_ : DataVec::template visitor_base<Ts ...>  {
 
 // ----------------------------------------------------------------------------
 
-template<typename DF, typename ... Ts>
-struct  copy_remove_functor_ : DataVec::template visitor_base<Ts ...>  {
-
-    inline copy_remove_functor_ (const char *n,
-                                 const DFUnorderedSet<std::size_t>  &td,
-                                 DF &d)
-        : name(n), to_delete (td), df(d)  {   }
-
-    const char                          *name;
-    const DFUnorderedSet<std::size_t>   &to_delete;
-    DF                                  &df;
-
-    template<typename T>
-    void operator() (const T &vec);
-};
-
-// ----------------------------------------------------------------------------
-
 template<typename DF, typename ... Ts>
 struct  fill_missing_functor_ :
     DataVec::template visitor_base<Ts ...>  {
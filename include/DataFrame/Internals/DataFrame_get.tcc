@@ -122,6 +122,13 @@ DataFrame<I, H>::get_column (const char *name, bool do_lock)  {
 
         return (data_vec);
     }
+    if constexpr (std::is_base_of<HeteroVector<align_value>, H>::value)  {
+        if (mapped_cols_ && mapped_cols_->columns.contains(name))
+            [[unlikely]]  {
+            load_mapped_column_(name);
+            return (get_column<T>(name, do_lock));
+        }
+    }
 
     char buffer [512];
 
@@ -156,7 +163,8 @@ DataFrame<I, H>::get_column(size_type index, bool do_lock)  {
 template<typename I, typename H>
 bool DataFrame<I, H>::has_column (const char *name) const  {
 
-    return (column_tb_.contains(name));
+    return (column_tb_.contains(name) ||
+            (mapped_cols_ && mapped_cols_->columns.contains(name)));
 }
 
 // ----------------------------------------------------------------------------
@@ -198,6 +206,62 @@ DataFrame<I, H>::get_column(size_type index, bool do_lock) const  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<arithmetic T>
+VectorConstView<T, DataFrame<I, H>::align_value>
+DataFrame<I, H>::get_mapped_column(const char *name) const  {
+
+    static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, Timestamp>,
+                  "Only arithmetic and Timestamp columns can be accessed "
+                  "in place");
+
+    if (! mapped_cols_ || ! mapped_cols_->columns.contains(name))  {
+        char buffer [512];
+
+        snprintf (buffer, sizeof(buffer) - 1,
+                  "DataFrame::get_mapped_column(): ERROR: "
+                  "Cannot find mapped column '%s'",
+                  name);
+        throw ColNotFound (buffer);
+    }
+
+    const auto  &entry = mapped_cols_->columns.find(name)->second;
+    const auto  citer = _typeinfo_name_.find(typeid(T));
+
+    if (citer == _typeinfo_name_.end() ||
+        std::strcmp(citer->second, entry.type_name.c_str()))  {
+        char buffer [512];
+
+        snprintf (buffer, sizeof(buffer) - 1,
+                  "DataFrame::get_mapped_column(): ERROR: "
+                  "Column '%s' is of type '%s'",
+                  name, entry.type_name.c_str());
+        throw DataFrameError (buffer);
+    }
+    if (mapped_cols_->needs_flipping)
+        throw DataFrameError("DataFrame::get_mapped_column(): ERROR: "
+                             "The file has different endianness");
+
+    // The number of rows is right before the data
+    //
+    const char  *rec =
+        mapped_cols_->mmap.data + entry.offset +
+        (_mmap_binary_rec_hdr_size_ - sizeof(uint64_t));
+    uint64_t    vec_size;
+
+    std::memcpy(&vec_size, rec, sizeof(vec_size));
+
+    const T         *data = reinterpret_cast<const T *>(rec + sizeof(vec_size));
+    const size_type begin =
+        std::min(size_type(vec_size), mapped_cols_->starting_row);
+    const size_type end =
+        begin + std::min(size_type(vec_size) - begin, mapped_cols_->num_rows);
+
+    return (VectorConstView<T, align_value>(data + begin, data + end));
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 const typename DataFrame<I, H>::IndexVecType &
 DataFrame<I, H>::get_index() const  { return (indices_); }
@@ -660,7 +724,7 @@ change_freq(size_type new_freq,
     DataFrame       result;
     IndexVecType    new_idx;
 
-    if constexpr (std::is_same_v<I, DateTime>)  {
+    if constexpr (DateTime_or_Timestamp<I>)  {
 #ifdef HMDF_SANITY_EXCEPTIONS
         if (time_unit == time_frequency::not_valid)
             throw NotFeasible(
@@ -1511,19 +1575,18 @@ knn(std::vector<const char *> &&col_names,
         };
 
         for (auto &fut : futures)  fut.get();
-        thr_pool_.parallel_sort(distances.begin(), distances.end(),
-                                [](const auto &lhs, const auto &rhs) -> bool  {
-                                    return (lhs.first < rhs.first);
-                                });
     }
     else  {
         lbd(size_type(0), col_s);
-        std::sort(distances.begin(), distances.end(),
-                  [](const auto &lhs, const auto &rhs) -> bool  {
-                      return (lhs.first < rhs.first);
-                  });
     }
 
+    // There is one target, so only the k nearest need to be ordered.
+    // Ties are broken by row index.
+    //
+    std::nth_element(distances.begin(), distances.begin() + (k - 1),
+                     distances.end());
+    std::sort(distances.begin(), distances.begin() + k);
+
     KNNResult<T>    result(k);
 
     for (size_type i { 0 }; i < k; ++i) {
@@ -2032,102 +2095,96 @@ crosstab(const char *row_col_name,
             col_vec = &(get_column<COL_T>(col_col_name, false));
     }
 
-    // 2. Collect sorted unique values for both axes
+    // 2. Group the rows by each axis value. Rows with a nan on either
+    //    axis are left out.
     //
-    // Use a reference-wrapper unordered_map, same pattern as value_counts()
-    //
-    auto    row_hash =
-        [](std::reference_wrapper<const ROW_T> v) -> std::size_t  {
-            return (std::hash<ROW_T>{}(v.get()));
-        };
-    auto    row_eq =
-        [](std::reference_wrapper<const ROW_T> a,
-           std::reference_wrapper<const ROW_T> b) -> bool  {
-            return (a.get() == b.get());
-        };
-    auto    col_hash =
-        [](std::reference_wrapper<const COL_T> v) -> std::size_t  {
-            return (std::hash<COL_T>{}(v.get()));
-        };
-    auto    col_eq =
-        [](std::reference_wrapper<const COL_T> a,
-           std::reference_wrapper<const COL_T> b) -> bool  {
-            return (a.get() == b.get());
+    const size_type col_s { std::min(row_vec->size(), col_vec->size()) };
+    const auto      use_row =
+        [row_vec, col_vec](size_type i) -> bool  {
+            return (! is_nan<ROW_T>((*row_vec)[i]) &&
+                    ! is_nan<COL_T>((*col_vec)[i]));
         };
+    const auto      row_groups = group_rows_(col_s, true, use_row, *row_vec);
+    const auto      col_groups = group_rows_(col_s, true, use_row, *col_vec);
 
-    using row_map_t =
-        std::unordered_map<std::reference_wrapper<const ROW_T>,
-                           size_type,
-                           decltype(row_hash),
-                           decltype(row_eq)>;
-    using col_map_t =
-        std::unordered_map<std::reference_wrapper<const COL_T>,
-                           size_type,
-                           decltype(col_hash),
-                           decltype(col_eq)>;
-
-    // First pass: record every non-NaN unique row/col value and assign a
-    // stable ordinal to it.
+    // The unique values of an axis, sorted for a deterministic, ascending
+    // order. rank[p][g] is the position of group g of partition p in it.
     //
-    const size_type     col_s { std::min(row_vec->size(), col_vec->size()) };
-    row_map_t           row_ordinal(col_s, row_hash, row_eq);
-    col_map_t           col_ordinal(col_s, col_hash, col_eq);
-    StlVecType<ROW_T>   uniq_rows;
-    StlVecType<COL_T>   uniq_cols;
-
-    uniq_rows.reserve(col_s / 2);
-    uniq_cols.reserve(col_s / 2);
-    for (size_type i { 0 }; i < col_s; ++i) [[likely]]  {
-        const ROW_T &rv { (*row_vec)[i] };
-        const COL_T &cv { (*col_vec)[i] };
-
-        if (is_nan<ROW_T>(rv) || is_nan<COL_T>(cv)) [[unlikely]]
-            continue;
+    auto    sort_groups =
+        [](const StlVecType<FlatRowTable> &groups,
+           const auto &vec,
+           auto &uniq) -> StlVecType<StlVecType<size_type>>  {
+            StlVecType<size_type>   firsts;
+
+            for (const auto &table : groups)
+                for (size_type g = 0; g < table.groups(); ++g)
+                    firsts.push_back(table.first_row(g));
+
+            StlVecType<size_type>   order(firsts.size());
+
+            std::iota(order.begin(), order.end(), size_type(0));
+            std::sort(order.begin(), order.end(),
+                      [&firsts, &vec](size_type lhs, size_type rhs) -> bool {
+                          return (vec[firsts[lhs]] < vec[firsts[rhs]]);
+                      });
+
+            StlVecType<size_type>   flat_rank(firsts.size());
+
+            uniq.reserve(firsts.size());
+            for (size_type k = 0; k < order.size(); ++k)  {
+                uniq.push_back(vec[firsts[order[k]]]);
+                flat_rank[order[k]] = k;
+            }
 
-        if (row_ordinal.emplace(std::cref(rv), row_ordinal.size()).second)
-            uniq_rows.push_back(rv);
-        if (col_ordinal.emplace(std::cref(cv), col_ordinal.size()).second)
-            uniq_cols.push_back(cv);
-    }
+            StlVecType<StlVecType<size_type>>   rank(groups.size());
+            size_type                           base { 0 };
 
-    // Sort both unique-value lists for deterministic, ascending column order
-    //
-    std::sort(uniq_rows.begin(), uniq_rows.end());
-    std::sort(uniq_cols.begin(), uniq_cols.end());
-
-    // Rebuild ordinal maps using the sorted vectors so the ordinal equals
-    // the position in the sorted list
-    //
-    row_ordinal.clear();
-    col_ordinal.clear();
+            for (size_type p = 0; p < groups.size(); ++p)  {
+                rank[p].assign(flat_rank.begin() + base,
+                               flat_rank.begin() + base + groups[p].groups());
+                base += groups[p].groups();
+            }
+            return (rank);
+        };
 
-    for (size_type i { 0 }; i < uniq_rows.size(); ++i)
-        row_ordinal.emplace(std::cref(uniq_rows[i]), i);
-    for (size_type i { 0 }; i < uniq_cols.size(); ++i)
-        col_ordinal.emplace(std::cref(uniq_cols[i]), i);
+    StlVecType<ROW_T>   uniq_rows;
+    StlVecType<COL_T>   uniq_cols;
+    const auto          row_rank =
+        sort_groups(row_groups, *row_vec, uniq_rows);
+    const auto          col_rank =
+        sort_groups(col_groups, *col_vec, uniq_cols);
 
     const size_type n_rows { uniq_rows.size() };
     const size_type n_cols { uniq_cols.size() };
 
-    // 3. Second pass: accumulate counts into a flat row-major matrix
+    // 3. Accumulate counts into a flat row-major matrix
     //
     // cell(r, c) holds count(row_value=uniq_rows[r], col_value=uniq_cols[c])
     //
     Matrix<size_type, matrix_orient::row_major> cell {
         long(n_rows), long(n_cols), 0
     };
+    StlVecType<size_type>                       col_of_row (col_s);
 
-    for (size_type i { 0 }; i < col_s; ++i) [[likely]]  {
-        const ROW_T &rv { (*row_vec)[i] };
-        const COL_T &cv { (*col_vec)[i] };
-
-        if (is_nan<ROW_T>(rv) || is_nan<COL_T>(cv)) [[unlikely]]
-            continue;
+    for (size_type p = 0; p < col_groups.size(); ++p)  {
+        const auto  &table = col_groups[p];
 
-        const size_type r { row_ordinal.find(std::cref(rv))->second };
-        const size_type c { col_ordinal.find(std::cref(cv))->second };
-
-        cell(long(r), long(c)) += 1;
+        for (size_type g = 0; g < table.groups(); ++g) [[likely]]
+            table.for_each_row(g,
+                               [&col_of_row, c = col_rank[p][g]]
+                               (size_type i) -> void  {
+                                   col_of_row[i] = c;
+                               });
+    }
+    for (size_type p = 0; p < row_groups.size(); ++p)  {
+        const auto  &table = row_groups[p];
+
+        for (size_type g = 0; g < table.groups(); ++g) [[likely]]
+            table.for_each_row(g,
+                               [&cell, &col_of_row, r = long(row_rank[p][g])]
+                               (size_type i) -> void  {
+                                   cell(r, long(col_of_row[i])) += 1;
+                               });
     }
 
     // 4. Compute marginal totals (always as size_type, before normalise)
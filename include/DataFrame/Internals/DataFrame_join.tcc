@@ -39,7 +39,7 @@ namespace hmdf
 template<typename I, typename H>
 template<typename RHS_T, typename ... Ts>
 DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-join_by_index (const RHS_T &rhs, join_policy mp) const  {
+join_by_index (const RHS_T &rhs, join_policy mp, join_strategy js) const  {
 
     static_assert(comparable<I>, "Index type must have comparison operators");
 
@@ -47,8 +47,18 @@ join_by_index (const RHS_T &rhs, join_policy mp) const  {
     using pair_vec_iter =
         typename StlVecType<JoinSortingPair<IndexType>>::iterator;
 
-    const auto      &lhs_idx = get_index();
-    const auto      &rhs_idx = rhs.get_index();
+    const auto  &lhs_idx = get_index();
+    const auto  &rhs_idx = rhs.get_index();
+    bool        presorted { false };
+
+    if (resolve_join_strategy_<IndexType>(lhs_idx, rhs_idx, js, presorted) ==
+            join_strategy::hash)
+        return (index_join_helper_<DataFrame, RHS_T, Ts ...>
+                    (*this, rhs,
+                     get_hash_join_idx_vector_<IndexType>(lhs_idx,
+                                                          rhs_idx,
+                                                          mp)));
+
     const size_type lhs_idx_s = lhs_idx.size();
     const size_type rhs_idx_s = rhs_idx.size();
     pair_vec_t      idx_vec_lhs;
@@ -68,7 +78,8 @@ join_by_index (const RHS_T &rhs, join_policy mp) const  {
     const auto  thread_level =
         (lhs_idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
 
-    if (thread_level > 3)  {
+    if (presorted)  ;
+    else if (thread_level > 3)  {
         std::future<void>   futures[2];
 
         futures[0] = thr_pool_.dispatch(
@@ -658,13 +669,24 @@ template<typename I, typename H>
 template<typename RHS_T, comparable T, typename ... Ts>
 DataFrame<unsigned long, HeteroVector<std::size_t(H::align_value)>>
 DataFrame<I, H>::
-join_by_column(const RHS_T &rhs, const char *name, join_policy mp) const  {
+join_by_column(const RHS_T &rhs,
+               const char *name,
+               join_policy mp,
+               join_strategy js) const  {
 
     using pair_vec_t = StlVecType<JoinSortingPair<T>>;
     using pair_vec_iter = typename StlVecType<JoinSortingPair<T>>::iterator;
 
-    const auto      &lhs_vec = get_column<T>(name);
-    const auto      &rhs_vec = rhs.template get_column<T>(name);
+    const auto  &lhs_vec = get_column<T>(name);
+    const auto  &rhs_vec = rhs.template get_column<T>(name);
+    bool        presorted { false };
+
+    if (resolve_join_strategy_<T>(lhs_vec, rhs_vec, js, presorted) ==
+            join_strategy::hash)
+        return (column_join_helper_<DataFrame, RHS_T, T, Ts ...>
+                    (*this, rhs, name,
+                     get_hash_join_idx_vector_<T>(lhs_vec, rhs_vec, mp)));
+
     const size_type lhs_vec_s = lhs_vec.size();
     const size_type rhs_vec_s = rhs_vec.size();
     pair_vec_t      col_vec_lhs;
@@ -684,7 +706,8 @@ join_by_column(const RHS_T &rhs, const char *name, join_policy mp) const  {
     const auto  thread_level =
         (lhs_vec_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
 
-    if (thread_level > 3)  {
+    if (presorted)  ;
+    else if (thread_level > 3)  {
         std::future<void>   futures[2];
 
         futures[0] = thr_pool_.dispatch(
@@ -728,6 +751,165 @@ join_by_column(const RHS_T &rhs, const char *name, join_policy mp) const  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename T, typename LV, typename RV>
+join_strategy DataFrame<I, H>::
+resolve_join_strategy_(const LV &lhs_keys,
+                       const RV &rhs_keys,
+                       join_strategy js,
+                       bool &presorted)  {
+
+    // If one side is at least this many times larger than the other,
+    // hashing the smaller side beats sorting the larger one
+    //
+    constexpr size_type hash_ratio { 8 };
+
+    presorted = false;
+    if (js == join_strategy::hash)  {
+        if constexpr (! hashable_equal<T>)
+            throw NotFeasible("join: join_strategy::hash requires hashable "
+                              "key type");
+        return (js);
+    }
+    if (js == join_strategy::sort_merge)  return (js);
+
+    // join_strategy::automatic
+    //
+    if (std::is_sorted(lhs_keys.begin(), lhs_keys.end()) &&
+        std::is_sorted(rhs_keys.begin(), rhs_keys.end()))  {
+        presorted = true;
+        return (join_strategy::sort_merge);
+    }
+    if constexpr (hashable_equal<T>)  {
+        const size_type lhs_s = lhs_keys.size();
+        const size_type rhs_s = rhs_keys.size();
+
+        if (std::max(lhs_s, rhs_s) >= hash_ratio * std::min(lhs_s, rhs_s))
+            return (join_strategy::hash);
+    }
+    return (join_strategy::sort_merge);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T, typename LV, typename RV>
+typename DataFrame<I, H>::IndexIdxVector DataFrame<I, H>::
+get_hash_join_idx_vector_(const LV &lhs_keys,
+                          const RV &rhs_keys,
+                          join_policy jp)  {
+
+    constexpr auto  NONE { std::numeric_limits<size_type>::max() };
+
+    // Build the table on the smaller side and probe it with the larger side
+    //
+    const bool  build_lhs { lhs_keys.size() < rhs_keys.size() };
+    const bool  keep_lhs {
+        jp == join_policy::left_join || jp == join_policy::left_right_join
+    };
+    const bool  keep_rhs {
+        jp == join_policy::right_join || jp == join_policy::left_right_join
+    };
+    const bool  keep_build { build_lhs ? keep_lhs : keep_rhs };
+    const bool  keep_probe { build_lhs ? keep_rhs : keep_lhs };
+    const auto  make_pair =
+        [build_lhs](size_type build_i,
+                    size_type probe_i) -> std::tuple<size_type, size_type>  {
+            return (build_lhs ? std::make_tuple(build_i, probe_i)
+                              : std::make_tuple(probe_i, build_i));
+        };
+    auto        join =
+        [keep_build, keep_probe, &make_pair]
+        (const auto &build_keys, const auto &probe_keys) -> IndexIdxVector  {
+            using key_t = std::tuple<const T &>;
+            using map_t = DFUnorderedMap<key_t, size_type, TupleHash>;
+
+            const size_type build_s = build_keys.size();
+            const size_type probe_s = probe_keys.size();
+            map_t           table;
+
+            // Rows with equal keys are chained through next, in row order.
+            // Building backward makes the table point to the first one.
+            //
+            StlVecType<size_type>   next(build_s);
+
+            table.reserve(build_s);
+            for (size_type i = build_s; i > 0; --i)  {
+                const size_type r = i - 1;
+                const auto      [iter, inserted] =
+                    table.emplace(key_t(build_keys[r]), r);
+
+                next[r] = inserted ? NONE : iter->second;
+                iter->second = r;
+            }
+
+            StlVecType<unsigned char>   matched(keep_build ? build_s : 0, 0);
+            auto                        probe =
+                [&table = std::as_const(table),
+                 &next = std::as_const(next),
+                 &probe_keys, &matched, &make_pair, keep_build, keep_probe]
+                (size_type begin, size_type end) -> IndexIdxVector  {
+                    IndexIdxVector  res;
+
+                    res.reserve(end - begin);
+                    for (size_type p = begin; p < end; ++p) [[likely]]  {
+                        const auto  iter = table.find(key_t(probe_keys[p]));
+
+                        if (iter != table.end())  {
+                            for (size_type b = iter->second; b != NONE;
+                                 b = next[b])  {
+                                res.emplace_back(make_pair(b, p));
+                                if (keep_build)
+                                    std::atomic_ref<unsigned char>(matched[b])
+                                        .store(1, std::memory_order_relaxed);
+                            }
+                        }
+                        else if (keep_probe)
+                            res.emplace_back(make_pair(NONE, p));
+                    }
+                    return (res);
+                };
+            IndexIdxVector              result;
+
+            if (probe_s >= ThreadPool::MUL_THR_THHOLD &&
+                get_thread_level() > 2)  {
+                auto                        futures =
+                    thr_pool_.parallel_loop<size_type>(size_type(0), probe_s,
+                                                      probe);
+                StlVecType<IndexIdxVector>  chunks;
+                size_type                   total { 0 };
+
+                chunks.reserve(futures.size());
+                for (auto &fut : futures)  {
+                    chunks.push_back(fut.get());
+                    total += chunks.back().size();
+                }
+                result.reserve(total + (keep_build ? build_s : 0));
+                for (const auto &chunk : chunks)
+                    result.insert(result.end(), chunk.begin(), chunk.end());
+            }
+            else
+                result = probe(size_type(0), probe_s);
+
+            if (keep_build)  {
+                for (size_type b = 0; b < build_s; ++b)
+                    if (! matched[b])
+                        result.emplace_back(make_pair(b, NONE));
+            }
+            return (result);
+        };
+
+    if constexpr (hashable_equal<T>)  {
+        if (build_lhs)  return (join(lhs_keys, rhs_keys));
+        return (join(rhs_keys, lhs_keys));
+    }
+    else
+        throw NotFeasible("get_hash_join_idx_vector_(): Key type must be "
+                          "hashable");
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename LHS_T, typename RHS_T, typename ... Ts>
 DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
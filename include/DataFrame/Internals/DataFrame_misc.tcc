@@ -88,7 +88,7 @@ template<typename T2>
 void
 DataFrame<I, H>::sort_functor_<Ts ...>::operator() (T2 &vec)  {
 
-    _sort_by_sorted_index_(vec, sorted_idxs, done_vec, idx_s);
+    permute_in_place_(vec, sorted_idxs, parallel);
 }
 
 // ----------------------------------------------------------------------------
@@ -320,13 +320,15 @@ DataFrame<I, H>::print_json_functor_<Ts ...>::operator() (const T &vec)  {
     const long  er = std::min(end_row, vec_size);
 
     os << "\"D\":[";
-    if (vec_size > 0)  {
-        _write_json_df_index_(os, vec[start_row]);
-        for (long i = sr + 1; i < er; ++i)  {
-            os << ',';
-            _write_json_df_index_(os, vec[i]);
-        }
-    }
+    df.write_text_chunks_(
+        os, sr, er, params,
+        [&vec, sr](text_chunk_ &chunk, long begin, long end) -> void  {
+            for (long i = begin; i < end; ++i)  {
+                if (i != sr)  chunk.buffer += ',';
+                _append_json_cell_(chunk.buffer, vec[i],
+                                   chunk.ss, chunk.plain);
+            }
+        });
     os << "]}";
 
     return;
@@ -356,20 +358,24 @@ print_csv2_header_functor_<S, Ts ...>::operator() (const T &vec)  {
 // ----------------------------------------------------------------------------
 
 template<typename I, typename H>
-template<typename S, typename ... Ts>
+template<typename ... Ts>
 template<typename T>
 void DataFrame<I, H>::
-print_csv2_data_functor_<S, Ts ...>::operator() (const T &vec)  {
+csv2_cell_functor_<Ts ...>::operator() (const T &vec)  {
 
     using VecType = typename std::remove_reference<T>::type;
-    using ValueType = typename VecType::value_type;
 
-    if (vec.size() > index)  {
-        if constexpr (std::same_as<ValueType, DateTime>)
-            _write_csv_df_index_(os, vec[index], dt_format);
-        else
-            _write_csv_df_index_(os, vec[index]);
-    }
+    cell.column = &vec;
+    cell.size = vec.size();
+    cell.append =
+        [](const void *col, size_type row, DT_FORMAT dt_format,
+           text_chunk_ &chunk) -> void  {
+            _append_csv2_cell_(chunk.buffer,
+                               (*static_cast<const VecType *>(col))[row],
+                               dt_format,
+                               chunk.ss,
+                               chunk.plain);
+        };
 }
 
 // ----------------------------------------------------------------------------
@@ -455,22 +461,23 @@ operator()(const T &lhs_vec)  {
 
     const auto              &rhs_vec =
         rhs.template get_column<ValueType>(name);
-    StlVecType<ValueType>   lhs_result_col;
-    StlVecType<ValueType>   rhs_result_col;
-
-    lhs_result_col.reserve(joined_index_idx.size());
-    rhs_result_col.reserve(joined_index_idx.size());
-    for (const auto &citer : joined_index_idx)  {
-        const size_type left_i = std::get<0>(citer);
-        const size_type right_i = std::get<1>(citer);
-
-        lhs_result_col.push_back(
-            left_i != std::numeric_limits<size_type>::max()
-                ? lhs_vec[left_i] : get_nan<ValueType>());
-        rhs_result_col.push_back(
-            right_i != std::numeric_limits<size_type>::max()
-                ? rhs_vec[right_i] : get_nan<ValueType>());
-    }
+    StlVecType<ValueType>   lhs_result_col(joined_index_idx.size());
+    StlVecType<ValueType>   rhs_result_col(joined_index_idx.size());
+
+    // Columns are already joined in parallel, one task per column
+    //
+    gather_rows_<true>(lhs_vec,
+                       [this](size_type i) -> size_type  {
+                           return (std::get<0>(this->joined_index_idx[i]));
+                       },
+                       lhs_result_col,
+                       false);
+    gather_rows_<true>(rhs_vec,
+                       [this](size_type i) -> size_type  {
+                           return (std::get<1>(this->joined_index_idx[i]));
+                       },
+                       rhs_result_col,
+                       false);
 
     char    lhs_str[256];
     char    rhs_str[256];
@@ -498,16 +505,16 @@ operator()(const T &vec)  {
     using VecType = typename std::remove_reference<T>::type;
     using ValueType = typename VecType::value_type;
 
-    StlVecType<ValueType>   result_col;
-
-    result_col.reserve(joined_index_idx.size());
-    for (const auto &citer : joined_index_idx)  {
-        const size_type i = std::get<SIDE>(citer);
+    StlVecType<ValueType>   result_col(joined_index_idx.size());
 
-        result_col.push_back(
-            i != std::numeric_limits<size_type>::max()
-                ? vec[i] : get_nan<ValueType>());
-    }
+    // Columns are already joined in parallel, one task per column
+    //
+    gather_rows_<true>(vec,
+                       [this](size_type i) -> size_type  {
+                           return (std::get<SIDE>(this->joined_index_idx[i]));
+                       },
+                       result_col,
+                       false);
 
     result.template load_column<ValueType>(name,
                                            std::move(result_col),
@@ -767,6 +774,30 @@ operator() (const T &vec)  {
     StlVecType<ValueType>   new_col;
     const size_type         vec_size = vec.size();
 
+    if constexpr (std::is_same_v<IT, size_type> &&
+                  std::is_default_constructible_v<ValueType> &&
+                  ! std::is_same_v<ValueType, bool>)  {
+        if (par_gather)  {
+            // Same as the loop below, stop at the first index past the
+            // end of the column
+            //
+            new_col.resize(
+                vec_size >= indices_size
+                    ? sel_indices.size()
+                    : size_type(std::find_if(sel_indices.begin(),
+                                             sel_indices.end(),
+                                             [vec_size](IT i) -> bool  {
+                                                 return (i >= vec_size);
+                                             }) - sel_indices.begin()));
+            gather_by_idx_(vec, sel_indices, new_col, true);
+            df.template load_column<ValueType>(name,
+                                               std::move(new_col),
+                                               nan_policy::dont_pad_with_nans,
+                                               false);
+            return;
+        }
+    }
+
     new_col.reserve(std::min(sel_indices.size(), vec_size));
     for (auto citer : sel_indices) [[likely]]  {
         const size_type index =
@@ -855,7 +886,12 @@ DataFrame<I, H>::
 shuffle_functor_<Ts ...>::
 operator() (T &vec) const  {
 
-    std::shuffle(vec.begin(), vec.end(), g_);
+    std::mt19937            g (seed);
+    StlVecType<size_type>   perm (vec.size());
+
+    std::iota(perm.begin(), perm.end(), size_type(0));
+    std::shuffle(perm.begin(), perm.end(), g);
+    permute_in_place_(vec, perm, false);
 }
 
 // ----------------------------------------------------------------------------
@@ -944,33 +980,6 @@ DataFrame<I, H>::columns_info_functor_<Ts ...>::operator() (const T &vec)  {
 
 // ----------------------------------------------------------------------------
 
-template<typename I, typename H>
-template<typename DF, typename ... Ts>
-template<typename T>
-void
-DataFrame<I, H>::copy_remove_functor_<DF, Ts ...>::
-operator() (const T &vec)  {
-
-    using VecType = typename std::remove_reference<T>::type;
-    using ValueType = typename VecType::value_type;
-    using NewVecType = typename DF::template ColumnVecType<ValueType>;
-
-    NewVecType  new_vec;
-
-    new_vec.reserve(vec.size() - to_delete.size());
-    for (size_type i = 0; i < vec.size(); ++i)  {
-        if (! to_delete.contains(i))
-            new_vec.push_back(vec[i]);
-    }
-
-    df.template load_column<ValueType>(name,
-                                       std::move(new_vec),
-                                       nan_policy::dont_pad_with_nans,
-                                       false);
-}
-
-// ----------------------------------------------------------------------------
-
 template<typename I, typename H>
 template<typename DF, typename ... Ts>
 template<typename T>
@@ -1137,51 +1146,26 @@ void
 DataFrame<I, H>::dup_mask_functor_<Ts ...>::
 operator() (const T &vec)  {
 
-    using VecType = typename std::remove_reference<T>::type;
-    using ValueType = typename VecType::value_type;
     using NewVecType = ColumnVecType<int>;
 
-    using data_tuple = std::tuple<const ValueType &, const IndexType &>;
-    using map_t = DFUnorderedMap<data_tuple, int, TupleHash>;
-
-    const IndexType dummy_idx { };
-    const auto      col_s = std::min(idx_vec.size(), vec.size());
-    map_t           table;
-    size_type       i { 0 };
-
-    table.reserve(col_s);
-    for (const auto &val : vec)  {
-        const auto  insert_res =
-            table.emplace(
-                std::forward_as_tuple(val,
-                                      incl_idx ? idx_vec[i++] : dummy_idx),
-                0);
-
-        insert_res.first->second += 1;
-    }
-
-    NewVecType  new_vec;
-
-    new_vec.reserve(col_s);
-    i = 0;
-    if (! binary)  {
-        for (const auto &val : vec)  {
-            const auto  find_res =
-                table.find(std::make_tuple(
-                    val, incl_idx ? idx_vec[i++] : dummy_idx));
-
-            if (find_res != table.end())
-                new_vec.push_back(find_res->second);
-        }
-    }
-    else  {
-        for (const auto &val : vec)  {
-            const auto  find_res =
-                table.find(std::make_tuple(
-                    val, incl_idx ? idx_vec[i++] : dummy_idx));
-
-            if (find_res != table.end())
-                new_vec.push_back(find_res->second == 1 ? 0 : 1);
+    // The columns are already masked in parallel, one task per column
+    //
+    const auto      every_row = [](size_type) -> bool  { return (true); };
+    const size_type col_s =
+        incl_idx ? std::min(idx_vec.size(), vec.size()) : vec.size();
+    const auto      row_groups =
+        incl_idx ? group_rows_(col_s, false, every_row, vec, idx_vec)
+                 : group_rows_(col_s, false, every_row, vec);
+    NewVecType      new_vec (col_s);
+
+    for (const auto &table : row_groups)  {
+        for (size_type g = 0; g < table.groups(); ++g) [[likely]]  {
+            const size_type cnt = table.group_size(g);
+            const int       val = binary ? (cnt == 1 ? 0 : 1) : int(cnt);
+
+            table.for_each_row(g, [&new_vec, val](size_type r) -> void  {
+                new_vec[r] = val;
+            });
         }
     }
 
@@ -70,6 +70,62 @@ void read_binary_(S &file,
                   size_type starting_row,
                   size_type num_rows);
 
+template<typename S>
+void read_binary_index_(S &stream,
+                        bool needs_flipping,
+                        size_type starting_row,
+                        size_type num_rows);
+
+template<typename S>
+void read_binary_column_(S &stream,
+                         const char *col_name,
+                         const char *col_type,
+                         bool needs_flipping,
+                         size_type starting_row,
+                         size_type num_rows);
+
+void read_mmap_binary_(const char *file_name, const ReadParams &params);
+void load_mapped_column_(const char *col_name);
+
+template<typename S, typename ... Ts>
+void write_mmap_binary_(S &o,
+                        long start_row,
+                        long end_row,
+                        bool columns_only) const;
+
+// Formatting state of one chunk of rows in the csv2 and json writers.
+// ss is only used for values that cannot go through std::to_chars.
+//
+struct  text_chunk_  {
+
+    std::string         buffer { };
+    std::ostringstream  ss { };
+    bool                plain { true };
+};
+
+// A column bound to the function that appends its i'th value to a csv2 row
+//
+struct  csv2_cell_  {
+
+    using append_t =
+        void (*)(const void *, size_type, DT_FORMAT, text_chunk_ &);
+
+    const void  *column { nullptr };
+    size_type   size { 0 };
+    append_t    append { nullptr };
+};
+
+// It formats [start_row, end_row) in chunks of rows by calling
+// format(chunk, begin, end), possibly in parallel. Chunk buffers are written
+// to o in order and reused.
+//
+template<typename S, typename F>
+void write_text_chunks_(S &o,
+                        long start_row,
+                        long end_row,
+                        const WriteParams<> &params,
+                        F &&format) const;
+
 template<typename S>
 void read_csv_(S &file, bool columns_only, char delim);
 
@@ -82,6 +138,11 @@ void read_csv2_(S &stream,
                 const std::vector<ReadSchema> &schema,
                 char delim);
 
+void read_csv2_mmap_(const char *file_name, const ReadParams &params);
+
+template<typename V>
+void read_csv2_load_(V &spec_vec, bool columns_only);
+
 template<typename LHS_T, typename RHS_T, typename ... Ts>
 static DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
 index_join_helper_(const LHS_T &lhs,
@@ -178,6 +239,19 @@ template<typename LHS_T, typename RHS_T, typename ... Ts>
 static void
 concat_helper_(LHS_T &lhs, const RHS_T &rhs, bool add_new_columns);
 
+template<typename T, typename LV, typename RV>
+static join_strategy
+resolve_join_strategy_(const LV &lhs_keys,
+                       const RV &rhs_keys,
+                       join_strategy js,
+                       bool &presorted);
+
+template<typename T, typename LV, typename RV>
+static IndexIdxVector
+get_hash_join_idx_vector_(const LV &lhs_keys,
+                          const RV &rhs_keys,
+                          join_policy jp);
+
 template<typename T>
 static IndexIdxVector
 get_left_right_index_idx_vector_(
@@ -939,98 +1013,867 @@ join_helper_common_(
 
 // ----------------------------------------------------------------------------
 
-template<typename MAP, typename ... Ts>
+// It groups rows [0, n) that have equal values in all the given columns.
+// Rows are hashed and compared column by column, so no key tuples are made.
+// Rows for which use_row(row) is false are left out.
+// With enough rows and threads (and if parallel is true), rows are
+// partitioned by hash and each partition is grouped by its own table on
+// the thread pool. Equal keys always land in the same partition. Within
+// each table, rows are inserted in row order.
+//
+template<typename F, typename ... Vs>
+static StlVecType<FlatRowTable>
+group_rows_(size_type n,
+            bool parallel,
+            const F &use_row,
+            const Vs & ... vecs)  {
+
+    const auto  hash_of =
+        [&vecs ...](size_type r) -> std::uint64_t  {
+            std::size_t seed { 0 };
+
+            (_hash_combine_(seed, vecs[r]), ...);
+            return (FlatRowTable::mix(seed));
+        };
+    const auto  thread_level =
+        (! parallel || n < ThreadPool::MUL_THR_THHOLD)
+            ? 0L : get_thread_level();
+
+    if (thread_level <= 2)  {
+        StlVecType<FlatRowTable>    result;
+        FlatRowTable                &table = result.emplace_back(n);
+
+        for (size_type r = 0; r < n; ++r) [[likely]]
+            if (use_row(r)) [[likely]]
+                table.insert(r, hash_of(r),
+                             [r, &vecs ...](size_type other) -> bool  {
+                                 return (((vecs[r] == vecs[other]) && ...));
+                             });
+        return (result);
+    }
+
+    const size_type                     parts = thread_level;
+    const size_type                     chunk_s = n / parts + 1;
+    StlVecType<std::uint64_t>           hashes(n);
+    StlVecType<StlVecType<size_type>>   part_rows(parts * parts);
+    const auto                          run_parts =
+        [parts](auto &&func) -> void  {
+            std::vector<std::future<void>>  futures;
+
+            futures.reserve(parts);
+            for (size_type p = 0; p < parts; ++p)
+                futures.emplace_back(
+                    thr_pool_.dispatch(false,
+                                       [&func, p]() -> void  { func(p); }));
+            for (auto &fut : futures)  fut.get();
+        };
+
+    // Rows of chunk c that hash into partition p, in row order.
+    // The partition is taken from the high bits. The tables probe with the
+    // low bits.
+    //
+    run_parts([&hashes, &part_rows, &hash_of, &use_row, parts, chunk_s, n]
+              (size_type c) -> void  {
+                  const size_type   end = std::min(n, (c + 1) * chunk_s);
+
+                  for (size_type p = 0; p < parts; ++p)
+                      part_rows[c * parts + p].reserve(chunk_s / parts + 1);
+                  for (size_type r = c * chunk_s; r < end; ++r)  {
+                      if (! use_row(r)) [[unlikely]]  continue;
+
+                      hashes[r] = hash_of(r);
+                      part_rows[c * parts +
+                                ((hashes[r] >> 32) * parts >> 32)]
+                          .push_back(r);
+                  }
+              });
+
+    StlVecType<FlatRowTable>    result(parts);
+
+    run_parts([&result, &hashes = std::as_const(hashes),
+               &part_rows = std::as_const(part_rows), parts, &vecs ...]
+              (size_type p) -> void  {
+                  size_type rows { 0 };
+
+                  for (size_type c = 0; c < parts; ++c)
+                      rows += part_rows[c * parts + p].size();
+
+                  FlatRowTable  table (rows);
+
+                  for (size_type c = 0; c < parts; ++c)
+                      for (const size_type r : part_rows[c * parts + p])
+                          table.insert(
+                              r, hashes[r],
+                              [r, &vecs ...](size_type other) -> bool  {
+                                  return (((vecs[r] == vecs[other]) && ...));
+                              });
+                  result[p] = std::move(table);
+              });
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+// The groups remove_duplicates() works on. Every row takes part, and the
+// index is part of the key only if include_index is true.
+//
+template<typename IV, typename ... Vs>
+static StlVecType<FlatRowTable>
+dup_row_groups_(size_type n,
+                bool include_index,
+                const IV &index,
+                const Vs & ... vecs)  {
+
+    const auto  every_row = [](size_type) -> bool  { return (true); };
+
+    if (include_index)
+        return (group_rows_(n, true, every_row, vecs ..., index));
+    return (group_rows_(n, true, every_row, vecs ...));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename ... Ts>
 static
 DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
 remove_dups_common_(const DataFrame &s_df,
                     remove_dup_spec rds,
-                    const MAP &row_table,
-                    const IndexVecType &index)  {
+                    const StlVecType<FlatRowTable> &row_groups,
+                    size_type idx_s)  {
 
-    using count_set = DFUnorderedSet<size_type>;
-    using res_t = DataFrame<I, HeteroVector<std::size_t(H::align_value)>>;
+    // Rows past the end of the key columns are not in any group and are
+    // always kept. Partitions own disjoint rows, so they can be marked
+    // in parallel.
+    //
+    StlVecType<char>    keep(idx_s, 1);
+    const auto          mark =
+        [&keep, &row_groups, rds](size_type p) -> void  {
+            const FlatRowTable  &table = row_groups[p];
+            const auto          drop =
+                [&keep](size_type r) -> void  { keep[r] = 0; };
+
+            for (size_type g = 0; g < table.groups(); ++g) [[likely]]  {
+                if (table.group_size(g) < 2) [[likely]]  continue;
+
+                table.for_each_row(g, drop);
+                if (rds == remove_dup_spec::keep_first)
+                    keep[table.first_row(g)] = 1;
+                else if (rds == remove_dup_spec::keep_last)
+                    keep[table.last_row(g)] = 1;
+            }
+        };
 
-    const size_type idx_s = index.size();
-    count_set       rows_to_del;
+    if (row_groups.size() > 1)  {
+        std::vector<std::future<void>>  futures;
 
-    rows_to_del.reserve(idx_s / 100);
-    if (rds == remove_dup_spec::keep_first)  {
-        for (const auto &[val_tuple, idx_vec] : row_table)  {
-            if (idx_vec.size() > 1)
-                rows_to_del.insert(idx_vec.begin() + 1, idx_vec.end());
-        }
-    }
-    else if (rds == remove_dup_spec::keep_last)  {
-        for (const auto &[val_tuple, idx_vec] : row_table)  {
-            if (idx_vec.size() > 1)
-                rows_to_del.insert(idx_vec.begin(), idx_vec.end() - 1);
-        }
+        futures.reserve(row_groups.size());
+        for (size_type p = 0; p < row_groups.size(); ++p)
+            futures.emplace_back(thr_pool_.dispatch(false, mark, p));
+        for (auto &fut : futures)  fut.get();
     }
-    else  {  // remove_dup_spec::keep_none
-        for (const auto &[val_tuple, idx_vec] : row_table)
-            if (idx_vec.size() > 1)
-                rows_to_del.insert(idx_vec.begin(), idx_vec.end());
+    else if (! row_groups.empty())
+        mark(0);
+
+    StlVecType<size_type>   kept_rows;
+
+    kept_rows.reserve(idx_s);
+    for (size_type i = 0; i < idx_s; ++i)
+        if (keep[i])  kept_rows.push_back(i);
+
+    return (s_df.template data_by_sel_common_<Ts ...>(kept_rows, idx_s));
+}
+
+// ----------------------------------------------------------------------------
+
+// It returns a permutation of [0, n) in which rows with equal keys are
+// contiguous. This is what _load_groupby_data_*_() expect from a sorted
+// permutation, so the hash_groupby*() family can share them with groupby*().
+// Rows are partitioned by key hash, so equal keys land in one partition and
+// each partition is grouped independently. Group ids are then assigned in
+// first-seen order, optionally re-ranked by key, and the permutation is
+// scattered per partition. Rows within a group keep their original order.
+//
+template<typename ... Vs>
+StlVecType<size_type>
+hash_group_perm_(group_order order,
+                 size_type n,
+                 const Vs & ... key_vecs) const  {
+
+    using key_t = std::tuple<const typename Vs::value_type & ...>;
+    using map_t = DFUnorderedMap<key_t, size_type, TupleHash>;
+
+    const auto      key_of =
+        [&key_vecs ...](size_type r) -> key_t  {
+            return (key_t(key_vecs[r] ...));
+        };
+    const auto      thread_level =
+        (n < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+    const size_type parts = (thread_level > 2) ? thread_level : 1;
+    const size_type chunk_s = n / parts + 1;
+    const auto      run_parts =
+        [parts](auto &&func) -> void  {
+            if (parts == 1)  {
+                func(size_type(0));
+                return;
+            }
+
+            std::vector<std::future<void>>  futures;
+
+            futures.reserve(parts);
+            for (size_type p = 0; p < parts; ++p)
+                futures.emplace_back(
+                    thr_pool_.dispatch(false,
+                                       [&func, p]() -> void  { func(p); }));
+            for (auto &fut : futures)  fut.get();
+        };
+
+    // Rows of chunk c that hash into partition p, in ascending order.
+    // With one partition, there is no need to materialize them.
+    //
+    StlVecType<StlVecType<size_type>>   part_rows(parts > 1 ? parts * parts
+                                                            : 0);
+    const auto                          for_each_row =
+        [&part_rows = std::as_const(part_rows), parts, n]
+        (size_type p, auto &&func) -> void  {
+            if (parts == 1)  {
+                for (size_type r = 0; r < n; ++r)  func(r);
+                return;
+            }
+            for (size_type c = 0; c < parts; ++c)
+                for (const size_type r : part_rows[c * parts + p])  func(r);
+        };
+
+    if (parts > 1)  {
+        run_parts([&part_rows, &key_of, parts, chunk_s, n]
+                  (size_type c) -> void  {
+                      const size_type   end = std::min(n, (c + 1) * chunk_s);
+                      const TupleHash   hasher { };
+
+                      for (size_type p = 0; p < parts; ++p)
+                          part_rows[c * parts + p].reserve(chunk_s / parts);
+                      for (size_type r = c * chunk_s; r < end; ++r)
+                          part_rows[c * parts + hasher(key_of(r)) % parts]
+                              .push_back(r);
+                  });
     }
 
-    res_t                        new_df;
-    typename res_t::IndexVecType new_index;
-    const SpinGuard              guard(lock_);
+    // Each row points to the first row with the same key (its leader)
+    //
+    StlVecType<size_type>   leader(n);
+
+    run_parts([&leader, &key_of, &for_each_row, &part_rows, parts, n]
+              (size_type p) -> void  {
+                  size_type rows { n };
+
+                  if (parts > 1)  {
+                      rows = 0;
+                      for (size_type c = 0; c < parts; ++c)
+                          rows += part_rows[c * parts + p].size();
+                  }
 
-    // Load the index
+                  map_t table;
+
+                  table.reserve(rows);
+                  for_each_row(p, [&leader, &table, &key_of](size_type r)  {
+                      leader[r] = table.emplace(key_of(r), r).first->second;
+                  });
+              });
+
+    // Number the leaders in row order, which is first-seen order
     //
-    new_index.reserve(idx_s - rows_to_del.size());
-    for (size_type i = 0; i < idx_s; ++i)  {
-        if (! rows_to_del.contains(i))
-            new_index.push_back(index[i]);
+    StlVecType<size_type>   group_id(n);
+    StlVecType<size_type>   chunk_base(parts + 1, 0);
+
+    run_parts([&leader = std::as_const(leader), &chunk_base, chunk_s, n]
+              (size_type c) -> void  {
+                  const size_type   end = std::min(n, (c + 1) * chunk_s);
+
+                  for (size_type r = c * chunk_s; r < end; ++r)
+                      if (leader[r] == r)  chunk_base[c + 1] += 1;
+              });
+    for (size_type c = 0; c < parts; ++c)
+        chunk_base[c + 1] += chunk_base[c];
+    run_parts([&leader = std::as_const(leader), &group_id,
+               &chunk_base = std::as_const(chunk_base), chunk_s, n]
+              (size_type c) -> void  {
+                  const size_type   end = std::min(n, (c + 1) * chunk_s);
+                  size_type         gid = chunk_base[c];
+
+                  for (size_type r = c * chunk_s; r < end; ++r)
+                      if (leader[r] == r)  group_id[r] = gid++;
+              });
+
+    const size_type         num_groups = chunk_base[parts];
+    StlVecType<size_type>   rank;
+
+    if (order == group_order::sorted)  {
+        if constexpr ((comparable<typename Vs::value_type> && ...))  {
+            StlVecType<size_type>   firsts(num_groups);
+
+            for (size_type r = 0, g = 0; g < num_groups; ++r)
+                if (leader[r] == r)  firsts[g++] = r;
+
+            StlVecType<size_type>   sorted_gids(num_groups);
+            auto                    cf =
+                [&firsts = std::as_const(firsts), &key_of]
+                (size_type lhs, size_type rhs) -> bool  {
+                    return (key_of(firsts[lhs]) < key_of(firsts[rhs]));
+                };
+
+            std::iota(sorted_gids.begin(), sorted_gids.end(), 0);
+            if (parts > 1 && num_groups >= ThreadPool::MUL_THR_THHOLD)
+                thr_pool_.parallel_sort(sorted_gids.begin(),
+                                        sorted_gids.end(),
+                                        cf);
+            else
+                std::ranges::sort(sorted_gids, cf);
+
+            rank.resize(num_groups);
+            for (size_type g = 0; g < num_groups; ++g)
+                rank[sorted_gids[g]] = g;
+        }
+        else  {
+            throw NotFeasible("hash_group_perm_(): group_order::sorted "
+                              "requires comparable keys");
+        }
     }
 
-    new_df.load_index(std::move(new_index));
+    run_parts([&leader = std::as_const(leader), &group_id,
+               &rank = std::as_const(rank), chunk_s, n]
+              (size_type c) -> void  {
+                  const size_type   end = std::min(n, (c + 1) * chunk_s);
+
+                  // Leaders' ids are not re-ranked until the next step, so
+                  // they can be read from any chunk here
+                  //
+                  for (size_type r = c * chunk_s; r < end; ++r)  {
+                      const size_type   lead = leader[r];
+
+                      if (lead != r)
+                          group_id[r] = rank.empty()
+                              ? group_id[lead] : rank[group_id[lead]];
+                  }
+              });
+    if (! rank.empty())  {
+        run_parts([&leader = std::as_const(leader), &group_id,
+                   &rank = std::as_const(rank), chunk_s, n]
+                  (size_type c) -> void  {
+                      const size_type   end = std::min(n, (c + 1) * chunk_s);
+
+                      for (size_type r = c * chunk_s; r < end; ++r)
+                          if (leader[r] == r)  group_id[r] = rank[group_id[r]];
+                  });
+    }
 
-    // Create the columns, so loading can proceed in parallel
+    // Groups never span partitions, so each partition can count and
+    // scatter its own groups without synchronization
     //
-    for (const auto &citer : s_df.column_list_)  {
-        create_col_functor_<res_t, Ts ...>  functor(
-            citer.first.c_str(), new_df);
+    StlVecType<size_type>   offsets(num_groups + 1, 0);
+
+    run_parts([&group_id = std::as_const(group_id), &offsets, &for_each_row]
+              (size_type p) -> void  {
+                  for_each_row(p, [&group_id, &offsets](size_type r)  {
+                      offsets[group_id[r] + 1] += 1;
+                  });
+              });
+    for (size_type g = 0; g < num_groups; ++g)
+        offsets[g + 1] += offsets[g];
+
+    StlVecType<size_type>   perm(n);
+
+    run_parts([&group_id = std::as_const(group_id), &offsets, &perm,
+               &for_each_row]
+              (size_type p) -> void  {
+                  for_each_row(p, [&group_id, &offsets, &perm](size_type r)  {
+                      perm[offsets[group_id[r]]++] = r;
+                  });
+              });
+    return (perm);
+}
+
+// ----------------------------------------------------------------------------
 
-        s_df.data_[citer.second].change(functor);
+// Maps a value onto an unsigned key with the same order.
+// Signed values have their sign bit flipped. Negative floating-point values
+// have all their bits flipped, the others only their sign bit. DateTime and
+// Timestamp are nanoseconds since epoch, the same as their comparison
+// operators.
+//
+template<radix_sortable T>
+static std::uint64_t
+radix_key_(const T &val) noexcept  {
+
+    constexpr std::uint64_t SIGN_BIT { std::uint64_t(1) << 63 };
+
+    if constexpr (std::is_same_v<T, DateTime> ||
+                  std::is_same_v<T, Timestamp>)
+        return (std::uint64_t(val.long_time()) ^ SIGN_BIT);
+    else if constexpr (std::floating_point<T>)  {
+        const std::uint64_t bits { std::bit_cast<std::uint64_t>(double(val)) };
+
+        return ((bits & SIGN_BIT) ? ~bits : (bits | SIGN_BIT));
     }
+    else if constexpr (std::is_signed_v<T>)
+        return (std::uint64_t(std::int64_t(val)) ^ SIGN_BIT);
+    else
+        return (std::uint64_t(val));
+}
 
-    const auto  thread_level =
-        (new_df.get_index().size() < ThreadPool::MUL_THR_THHOLD)
-            ? 0L : get_thread_level();
+// ----------------------------------------------------------------------------
+
+// LSD radix sort of the row positions of vec. It returns the permutation
+// that sorts vec according to dir. The sort is stable, and NaN values go to
+// the end regardless of dir.
+// Keys are sorted 8 bits at a time. Each pass counts the digits of every
+// chunk of rows into its own histogram and then scatters every chunk into
+// its own slots. So with more than 2 threads, the chunks are done in
+// parallel. Passes whose digit is the same for all keys are skipped.
+//
+template<radix_sortable T, typename V, typename P>
+void
+radix_sort_perm_(const V &vec, sort_spec dir, P &perm) const  {
+
+    using hist_t = std::array<size_type, 256>;
+
+    const size_type n { vec.size() };
+    const auto      thread_level =
+        (n < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+    const size_type parts = (thread_level > 2) ? thread_level : 1;
+    const size_type chunk_s = n / parts + 1;
+    const auto      run_parts =
+        [parts](auto &&func) -> void  {
+            if (parts == 1)  {
+                func(size_type(0));
+                return;
+            }
+
+            std::vector<std::future<void>>  futures;
+
+            futures.reserve(parts);
+            for (size_type p = 0; p < parts; ++p)
+                futures.emplace_back(
+                    thr_pool_.dispatch(false,
+                                       [&func, p]() -> void  { func(p); }));
+            for (auto &fut : futures)  fut.get();
+        };
+    const bool      abs_val =
+        dir == sort_spec::abs_ascen || dir == sort_spec::abs_desce;
+    const bool      descending =
+        dir == sort_spec::desce || dir == sort_spec::abs_desce;
+
+    StlVecType<std::uint64_t>   keys(n);
+    StlVecType<std::uint64_t>   keys_tmp(n);
+    StlVecType<size_type>       rows(n);
+    StlVecType<size_type>       rows_tmp(n);
+
+    run_parts([&vec, &keys, &rows, abs_val, descending, chunk_s, n]
+              (size_type c) -> void  {
+                  const size_type   end = std::min(n, (c + 1) * chunk_s);
+
+                  for (size_type r = c * chunk_s; r < end; ++r)  {
+                      const T   &val = vec[r];
+
+                      if (is_nan__(val))  {
+                          keys[r] = std::numeric_limits<std::uint64_t>::max();
+                      }
+                      else  {
+                          const std::uint64_t   key =
+                              radix_key_(abs_val ? T(abs__(val)) : val);
+
+                          keys[r] = descending ? ~key : key;
+                      }
+                      rows[r] = r;
+                  }
+              });
+
+    StlVecType<hist_t>  hists(parts);
+
+    for (unsigned int shift = 0; shift < 64; shift += 8)  {
+        run_parts([&keys = std::as_const(keys), &hists, shift, chunk_s, n]
+                  (size_type c) -> void  {
+                      const size_type   end = std::min(n, (c + 1) * chunk_s);
+                      hist_t            &hist = hists[c];
+
+                      hist.fill(0);
+                      for (size_type r = c * chunk_s; r < end; ++r)
+                          hist[(keys[r] >> shift) & 0xFF] += 1;
+                  });
+
+        // Turn the counts into the starting slot of each digit in each
+        // chunk. Chunks of the same digit are laid out in chunk order, so
+        // the sort stays stable.
+        //
+        size_type   total { 0 };
+        bool        one_digit { false };
+
+        for (size_type d = 0; d < 256; ++d)  {
+            const size_type digit_start = total;
+
+            for (size_type c = 0; c < parts; ++c)  {
+                const size_type cnt = hists[c][d];
+
+                hists[c][d] = total;
+                total += cnt;
+            }
+            if (total - digit_start == n)  {
+                one_digit = true;
+                break;
+            }
+        }
+        if (one_digit)  continue;
+
+        run_parts([&keys = std::as_const(keys), &rows = std::as_const(rows),
+                   &keys_tmp, &rows_tmp, &hists, shift, chunk_s, n]
+                  (size_type c) -> void  {
+                      const size_type   end = std::min(n, (c + 1) * chunk_s);
+                      hist_t            &slots = hists[c];
+
+                      for (size_type r = c * chunk_s; r < end; ++r)  {
+                          const size_type   pos =
+                              slots[(keys[r] >> shift) & 0xFF]++;
+
+                          keys_tmp[pos] = keys[r];
+                          rows_tmp[pos] = rows[r];
+                      }
+                  });
+        keys.swap(keys_tmp);
+        rows.swap(rows_tmp);
+    }
+
+    perm.resize(n);
+    std::copy(rows.begin(), rows.end(), perm.begin());
+}
+
+// ----------------------------------------------------------------------------
+
+// If T is radix sortable and vec is big enough, it sorts vec and, unless
+// ignore_index is true, the index by radix sort. sorting_idxs is set to the
+// permutation that was applied, and it returns true.
+// Otherwise, it does nothing and returns false.
+//
+template<typename T>
+bool
+radix_sort_col_(ColumnVecType<T> &vec,
+                sort_spec dir,
+                bool ignore_index,
+                StlVecType<size_type> &sorting_idxs)  {
+
+    if constexpr (radix_sortable<T>)  {
+        if (vec.size() < ThreadPool::MUL_THR_THHOLD)  return (false);
+
+        radix_sort_perm_<T>(vec, dir, sorting_idxs);
+        permute_in_place_(vec, sorting_idxs, true);
+        if (! ignore_index)  permute_in_place_(indices_, sorting_idxs, true);
+        return (true);
+    }
+    else
+        return (false);
+}
+
+// ----------------------------------------------------------------------------
+
+// It calls sel_chunk(begin, end, out) over [0, n) and returns the
+// concatenation of what it appended to out, in order.
+// sel_chunk must append the selected positions in [begin, end) to out.
+// For big sizes, the chunks are done in parallel.
+//
+template<typename F>
+StlVecType<size_type>
+sel_chunks_(size_type n, F &&sel_chunk) const  {
+
+    StlVecType<size_type>   col_indices;
+    const auto              thread_level =
+        (n < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
 
     if (thread_level > 2)  {
-        auto    lbd =
-            [&rows_to_del = std::as_const(rows_to_del),
-             &s_df = std::as_const(s_df),
-             &new_df]
-            (const auto &begin, const auto &end) -> void  {
-                for (auto citer = begin; citer < end; ++citer)  {
-                    copy_remove_functor_<res_t, Ts ...> functor(
-                        citer->first.c_str(),
-                        rows_to_del,
-                        new_df);
+        auto    futures =
+            thr_pool_.parallel_loop<size_type>(
+                size_type(0), n,
+                [&sel_chunk](size_type begin,
+                             size_type end) -> StlVecType<size_type>  {
+                    StlVecType<size_type>   chunk;
+
+                    chunk.reserve((end - begin) / 2);
+                    sel_chunk(begin, end, chunk);
+                    return (chunk);
+                });
+        StlVecType<StlVecType<size_type>>   chunks;
+        size_type                           total { 0 };
+
+        chunks.reserve(futures.size());
+        for (auto &fut : futures)  {
+            chunks.push_back(fut.get());
+            total += chunks.back().size();
+        }
+        col_indices.reserve(total);
+        for (const auto &chunk : chunks)
+            col_indices.insert(col_indices.end(), chunk.begin(), chunk.end());
+    }
+    else  {
+        col_indices.reserve(n / 2);
+        sel_chunk(size_type(0), n, col_indices);
+    }
+    return (col_indices);
+}
+
+// ----------------------------------------------------------------------------
+
+// Positions in [0, n) for which pred(i) is true
+//
+template<typename P>
+StlVecType<size_type>
+sel_indices_(size_type n, P &&pred) const  {
+
+    return (sel_chunks_(
+        n,
+        [&pred](size_type begin,
+                size_type end,
+                StlVecType<size_type> &out) -> void  {
+            for (size_type i = begin; i < end; ++i) [[likely]]
+                if (pred(i)) [[unlikely]]
+                    out.push_back(i);
+        }));
+}
+
+// ----------------------------------------------------------------------------
+
+// Appends the positions in [begin, end) where cmp(vec[i], value) is true.
+// For arithmetic types, the comparisons are done in blocks of 64 into a bit
+// mask without branches, so the compiler can vectorize them.
+//
+template<typename V, typename T, typename C>
+static void
+cmp_sel_chunk_(const V &vec,
+               const T &value,
+               C &&cmp,
+               size_type begin,
+               size_type end,
+               StlVecType<size_type> &out)  {
+
+    using value_t = typename V::value_type;
+
+    size_type   i { begin };
+
+    if constexpr (std::is_arithmetic_v<value_t> &&
+                  ! std::is_same_v<value_t, bool>)  {
+        constexpr size_type BLOCK { 64 };
+        const value_t       *data { vec.data() };
+        const value_t       val { static_cast<value_t>(value) };
+
+        for (; i + BLOCK <= end; i += BLOCK)  {
+            std::uint64_t   mask { 0 };
+
+            for (size_type j = 0; j < BLOCK; ++j)
+                mask |= std::uint64_t(cmp(data[i + j], val)) << j;
+            while (mask)  {
+                out.push_back(i + std::countr_zero(mask));
+                mask &= mask - 1;
+            }
+        }
+    }
+    for (; i < end; ++i)
+        if (cmp(vec[i], value))  out.push_back(i);
+}
+
+// ----------------------------------------------------------------------------
 
-                    s_df.data_[citer->second].change(functor);
+// Positions of the rows where "vec[i] op value" is true
+//
+template<typename V, typename T>
+StlVecType<size_type>
+cmp_sel_indices_(const V &vec, compare_op op, const T &value) const  {
+
+    const size_type col_s { vec.size() };
+    auto            by_op =
+        [&vec, &value, col_s, this](auto &&cmp) -> StlVecType<size_type>  {
+            return (this->sel_chunks_(
+                col_s,
+                [&vec, &value, &cmp](size_type begin,
+                                     size_type end,
+                                     StlVecType<size_type> &out) -> void  {
+                    cmp_sel_chunk_(vec, value, cmp, begin, end, out);
+                }));
+        };
+
+    switch (op)  {
+    case compare_op::eq:
+        return (by_op([](const auto &a, const auto &b) { return (a == b); }));
+    case compare_op::ne:
+        return (by_op([](const auto &a, const auto &b) { return (a != b); }));
+    case compare_op::lt:
+        return (by_op([](const auto &a, const auto &b) { return (a < b); }));
+    case compare_op::le:
+        return (by_op([](const auto &a, const auto &b) { return (a <= b); }));
+    case compare_op::gt:
+        return (by_op([](const auto &a, const auto &b) { return (a > b); }));
+    case compare_op::ge:
+        return (by_op([](const auto &a, const auto &b) { return (a >= b); }));
+    default:
+        throw NotFeasible("cmp_sel_indices_(): Unknown compare_op");
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// This is the engine that moves rows around by index vectors.
+// dst[i] = src[row_of(i)] for all i in [0, dst.size()). If NAN_FILL is true,
+// a row of std::numeric_limits<size_type>::max() produces a NaN.
+// Reading the source rows is random access, so the source row a few
+// iterations ahead is prefetched. If parallel is true and dst is big, dst
+// is divided into blocks that are gathered by the thread pool.
+//
+template<bool NAN_FILL = false, typename V, typename F, typename DV>
+static void
+gather_rows_(const V &src, const F &row_of, DV &dst, bool parallel)  {
+
+    using value_t = typename V::value_type;
+
+    constexpr size_type PREFETCH_DIST { 16 };
+    constexpr size_type NONE { std::numeric_limits<size_type>::max() };
+    constexpr bool      is_bool { std::is_same_v<value_t, bool> };
+
+    auto    gather_block =
+        [&src, &row_of, &dst](size_type begin, size_type end) -> void  {
+            for (size_type i = begin; i < end; ++i) [[likely]]  {
+#if defined(__GNUC__) || defined(__clang__)
+                if constexpr (! is_bool)  {
+                    if (i + PREFETCH_DIST < end)  {
+                        const size_type ahead = row_of(i + PREFETCH_DIST);
+
+                        if (! NAN_FILL || ahead != NONE)
+                            __builtin_prefetch(&src[ahead]);
+                    }
                 }
-            };
+#endif // __GNUC__ || __clang__
+
+                const size_type row = row_of(i);
+
+                if constexpr (NAN_FILL)
+                    dst[i] = row != NONE ? src[row] : get_nan<value_t>();
+                else
+                    dst[i] = src[row];
+            }
+        };
+    const size_type n = dst.size();
+
+    if (! is_bool && parallel &&
+        n >= ThreadPool::MUL_THR_THHOLD && get_thread_level() > 2)  {
         auto    futures =
-            thr_pool_.parallel_loop<double>(s_df.column_list_.begin(),
-                                            s_df.column_list_.end(),
-                                            std::move(lbd));
+            thr_pool_.parallel_loop<size_type>(size_type(0), n,
+                                               gather_block);
 
         for (auto &fut : futures)  fut.get();
     }
-    else  {
-        for (const auto &citer : s_df.column_list_)  {
-            copy_remove_functor_<res_t, Ts ...> functor(citer.first.c_str(),
-                                                        rows_to_del,
-                                                        new_df);
+    else
+        gather_block(size_type(0), n);
+}
+
+// ----------------------------------------------------------------------------
+
+// dst[i] = src[sel[i]] for all i in [0, dst.size())
+//
+template<typename V, typename S, typename DV>
+static void
+gather_by_idx_(const V &src, const S &sel, DV &dst, bool parallel)  {
+
+    gather_rows_(src,
+                 [&sel](size_type i) -> size_type  { return (sel[i]); },
+                 dst,
+                 parallel);
+}
+
+// ----------------------------------------------------------------------------
+
+// It reorders vec, so vec[i] becomes the old vec[perm[i]].
+// It gathers into a new buffer, unless the column is bigger than
+// permute_mem_budget_ bytes. Then it follows the permutation cycles in
+// place, which needs no extra memory, but it is one random swap per row.
+// Views always follow the cycles, since they cannot own a new buffer.
+//
+template<typename V>
+static void
+permute_in_place_(V &vec, const StlVecType<size_type> &perm, bool parallel)  {
+
+    using value_t = typename V::value_type;
+
+    const size_type n = perm.size();
+
+    if constexpr (std::is_base_of<HeteroVector<align_value>, H>::value &&
+                  std::is_default_constructible_v<value_t> &&
+                  ! std::is_same_v<value_t, bool>)  {
+        if (vec.size() == n &&
+            n <= permute_mem_budget_ / sizeof(value_t))  {
+            V   permuted(n);
+
+            gather_by_idx_(vec, perm, permuted, parallel);
+            vec.swap(permuted);
+            return;
+        }
+    }
+
+    StlVecType<char>    done_vec(n, 0);
 
-            s_df.data_[citer.second].change(functor);
+    for (size_type i = 0; i < n; ++i) [[likely]]  {
+        if (! done_vec[i]) [[likely]]  {
+            done_vec[i] = 1;
+
+            size_type   prev_j = i;
+            size_type   j = perm[i];
+
+            while (i != j) [[likely]]  {
+                std::swap(vec[prev_j], vec[j]);
+                done_vec[j] = 1;
+                prev_j = j;
+                j = perm[j];
+            }
         }
     }
-    return (new_df);
+}
+
+// ----------------------------------------------------------------------------
+
+// It applies perm to all the columns, except the ones named in skip.
+// With enough columns, each column is one task. Otherwise, the columns are
+// done one at a time, each by all the threads.
+//
+template<typename ... Ts>
+void
+permute_columns_(const StlVecType<size_type> &perm,
+                 std::initializer_list<const char *> skip)  {
+
+    const auto              thread_level = get_thread_level();
+    const bool              big = perm.size() >= ThreadPool::MUL_THR_THHOLD;
+    StlVecType<size_type>   cols;
+
+    cols.reserve(column_list_.size());
+    for (const auto &[name, idx] : column_list_) [[likely]]
+        if (std::none_of(skip.begin(), skip.end(),
+                         [&name](const char *s) -> bool  {
+                             return (name == s);
+                         }))
+            cols.push_back(idx);
+
+    if (thread_level > 2 && cols.size() > 1 &&
+        (! big || cols.size() >= size_type(thread_level)))  {
+        std::vector<std::future<void>>  futures;
+
+        futures.reserve(cols.size());
+        for (const size_type idx : cols)
+            futures.emplace_back(
+                thr_pool_.dispatch(
+                    false,
+                    [&perm, idx, this]() -> void  {
+                        sort_functor_<Ts ...>   functor (perm, false);
+
+                        this->data_[idx].change(functor);
+                    }));
+        for (auto &fut : futures)  fut.get();
+    }
+    else  {
+        sort_functor_<Ts ...>   functor (perm, thread_level > 2 && big);
+
+        for (const size_type idx : cols)  data_[idx].change(functor);
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -1046,9 +1889,21 @@ data_by_sel_common_(const StlVecType<size_type> &col_indices,
     res_t       ret_df;
     idx_vec_t   new_index;
 
-    new_index.reserve(col_indices.size());
-    for (const auto &citer: col_indices) [[likely]]
-        new_index.push_back(indices_[citer]);
+    const auto  thread_level =
+        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+
+    if constexpr (std::is_default_constructible_v<IndexType> &&
+                  ! std::is_same_v<IndexType, bool>)  {
+        if (thread_level > 2)  {
+            new_index.resize(col_indices.size());
+            gather_by_idx_(indices_, col_indices, new_index, true);
+        }
+    }
+    if (new_index.size() != col_indices.size())  {
+        new_index.reserve(col_indices.size());
+        for (const auto &citer: col_indices) [[likely]]
+            new_index.push_back(indices_[citer]);
+    }
     ret_df.load_index(std::move(new_index));
 
     const SpinGuard guard(lock_);
@@ -1059,10 +1914,11 @@ data_by_sel_common_(const StlVecType<size_type> &col_indices,
         data_[idx].change(functor);
     }
 
-    const auto  thread_level =
-        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
-
-    if (thread_level > 2)  {
+    // With enough columns, each thread gathers whole columns. Otherwise,
+    // the columns are gathered one at a time by all the threads.
+    //
+    if (thread_level > 2 &&
+        column_list_.size() >= size_type(thread_level))  {
         auto    lbd =
             [&col_indices = std::as_const(col_indices), idx_s, &ret_df, this]
             (const auto &begin, const auto &end) -> void  {
@@ -1086,10 +1942,12 @@ data_by_sel_common_(const StlVecType<size_type> &col_indices,
     }
     else  {
         for (const auto &[name, idx] : column_list_) [[likely]]  {
-            sel_load_functor_<res_t, size_type, Ts ...> functor(name.c_str(),
-                                                                col_indices,
-                                                                idx_s,
-                                                                ret_df);
+            sel_load_functor_<res_t, size_type, Ts ...> functor(
+                name.c_str(),
+                col_indices,
+                idx_s,
+                ret_df,
+                thread_level > 2);
 
             data_[idx].change(functor);
         }
@@ -1475,7 +2333,11 @@ struct  ColVectorPushBack_  {
             value.clear();
             _get_token_from_file_(file, delim, value,
                                   file_type == io_format::json ? ']' : '\0');
-            vec.push_back(static_cast<T>(converter(value.c_str(), nullptr)));
+            if constexpr (std::is_floating_point_v<T>)
+                vec.push_back(_from_chars_<T>(value));
+            else
+                vec.push_back(
+                    static_cast<T>(converter(value.c_str(), nullptr)));
         }
     }
 };
@@ -1538,17 +2400,7 @@ struct  ColVectorPushBack_<DateTime, StlVecType<DateTime>, Dummy>  {
             _get_token_from_file_(file, delim, value,
                                   file_type == io_format::json ? ']' : '\0');
 
-            time_t      t;
-            int         n;
-            DateTime    dt;
-
-#ifdef _MSC_VER
-            ::sscanf(value.c_str(), "%lld.%d", &t, &n);
-#else
-            ::sscanf(value.c_str(), "%ld.%d", &t, &n);
-#endif // _MSC_VER
-            dt.set_time(t, n);
-            vec.emplace_back(std::move(dt));
+            vec.push_back(_get_dt_from_epoch_value_(value));
         }
     }
 };
@@ -1785,6 +2637,24 @@ struct  IdxParserFunctor_<DateTime, Dummy>  {
 
 // ----------------------------------------------------------------------------
 
+template<typename Dummy>
+struct  IdxParserFunctor_<Timestamp, Dummy>  {
+
+    inline void operator()(StlVecType<Timestamp> &vec,
+                           std::istream &file,
+                           io_format file_type,
+                           char delim) const  {
+
+        col_vector_push_back_func_(
+            [](const char *tok, int len) -> Timestamp  {
+                return (_get_ts_from_epoch_value_(std::string_view(tok, len)));
+            },
+            file, vec, file_type, delim);
+    }
+};
+
+// ----------------------------------------------------------------------------
+
 template<typename Dummy>
 struct  IdxParserFunctor_<bool, Dummy>  {
 
@@ -1882,11 +2752,13 @@ struct  GenerateTSIndex_  {
 
 // ----------------------------------------------------------------------------
 
-template<typename Dummy>
-struct  GenerateTSIndex_<DateTime, Dummy>  {
+// Timestamps are converted from the DateTime as they are generated
+//
+template<DateTime_or_Timestamp T>
+struct  GenerateTSIndex_<T, void>  {
 
     inline void
-    operator ()(StlVecType<DateTime> &index_vec,
+    operator ()(StlVecType<T> &index_vec,
                 DateTime &start_di,
                 const DateTime &end_di,
                 time_frequency t_freq,
@@ -1896,7 +2768,7 @@ struct  GenerateTSIndex_<DateTime, Dummy>  {
         case time_frequency::annual:
             {
                 while (start_di < end_di)  {
-                    index_vec.push_back(start_di);
+                    index_vec.emplace_back(start_di);
                     start_di.add_years(increment);
                 }
             }
@@ -1904,7 +2776,7 @@ struct  GenerateTSIndex_<DateTime, Dummy>  {
         case time_frequency::monthly:
             {
                 while (start_di < end_di)  {
-                    index_vec.push_back(start_di);
+                    index_vec.emplace_back(start_di);
                     start_di.add_months(increment);
                 }
             }
@@ -1912,7 +2784,7 @@ struct  GenerateTSIndex_<DateTime, Dummy>  {
         case time_frequency::weekly:
             {
                 while (start_di < end_di)  {
-                    index_vec.push_back(start_di);
+                    index_vec.emplace_back(start_di);
                     start_di.add_days(increment * 7);
                 }
             }
@@ -1920,7 +2792,7 @@ struct  GenerateTSIndex_<DateTime, Dummy>  {
         case time_frequency::daily:
             {
                 while (start_di < end_di)  {
-                    index_vec.push_back(start_di);
+                    index_vec.emplace_back(start_di);
                     start_di.add_days(increment);
                 }
             }
@@ -1928,7 +2800,7 @@ struct  GenerateTSIndex_<DateTime, Dummy>  {
         case time_frequency::hourly:
             {
                 while (start_di < end_di)  {
-                    index_vec.push_back(start_di);
+                    index_vec.emplace_back(start_di);
                     start_di.add_seconds(increment * 60 * 60);
                 }
             }
@@ -1936,7 +2808,7 @@ struct  GenerateTSIndex_<DateTime, Dummy>  {
         case time_frequency::minutely:
             {
                 while (start_di < end_di)  {
-                    index_vec.push_back(start_di);
+                    index_vec.emplace_back(start_di);
                     start_di.add_seconds(increment * 60);
                 }
             }
@@ -1944,7 +2816,7 @@ struct  GenerateTSIndex_<DateTime, Dummy>  {
         case time_frequency::secondly:
             {
                 while (start_di < end_di)  {
-                    index_vec.push_back(start_di);
+                    index_vec.emplace_back(start_di);
                     start_di.add_seconds(increment);
                 }
             }
@@ -1952,7 +2824,7 @@ struct  GenerateTSIndex_<DateTime, Dummy>  {
         case time_frequency::millisecondly:
             {
                 while (start_di < end_di)  {
-                    index_vec.push_back(start_di);
+                    index_vec.emplace_back(start_di);
                     start_di.add_nanoseconds(increment * 1000000);
                 }
             }
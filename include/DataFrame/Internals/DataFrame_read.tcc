@@ -37,7 +37,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <any>
 #include <cstdlib>
 #include <cstring>
+#include <future>
+#include <numeric>
 #include <sstream>
+#include <string_view>
 
 // ----------------------------------------------------------------------------
 
@@ -455,6 +458,22 @@ void DataFrame<I, H>::read_json_(S &stream, bool columns_only)  {
                     slug(vec, stream, converter, io_format::json, delim);
                     break;
                 }
+                case file_dtypes::TIMESTAMP: {
+                    StlVecType<Timestamp>   &vec =
+                        create_column<Timestamp>(col_name.c_str(), false);
+
+                    vec.reserve(col_size);
+                    col_vector_push_back_func_(
+                        [](const char *tok, int len) -> Timestamp  {
+                            return (_get_ts_from_epoch_value_(
+                                        std::string_view(tok, len)));
+                        },
+                        stream,
+                        vec,
+                        io_format::json,
+                        delim);
+                    break;
+                }
                 default:  {
                     String1K    err;
 
@@ -867,6 +886,23 @@ void DataFrame<I, H>::read_csv_(S &stream, bool columns_only, char delim)  {
                     slug (vec, stream, converter, io_format::csv, delim);
                     break;
                 }
+                case file_dtypes::TIMESTAMP: {
+                    StlVecType<Timestamp>   &vec =
+                        create_column<Timestamp>(col_name.c_str(), false);
+
+                    vec.reserve(_atoi_<size_type>(value.c_str(),
+                                                  value.size()));
+                    col_vector_push_back_func_(
+                        [](const char *tok, int len) -> Timestamp  {
+                            return (_get_ts_from_epoch_value_(
+                                        std::string_view(tok, len)));
+                        },
+                        stream,
+                        vec,
+                        io_format::csv,
+                        delim);
+                    break;
+                }
                 case file_dtypes::STR_DBL_PAIR: {
                     using val_t = std::pair<std::string, double>;
 
@@ -1000,10 +1036,11 @@ void DataFrame<I, H>::read_csv_(S &stream, bool columns_only, char delim)  {
 
 struct _col_data_spec_  {
 
-    std::any    col_vec { };
-    file_dtypes type_spec { 0 };
-    String64    col_name { };
-    int         col_idx { -1 };
+    std::any                col_vec { };
+    file_dtypes             type_spec { 0 };
+    String64                col_name { };
+    int                     col_idx { -1 };
+    DateTime::DateCache     dt_cache { };  // Last date of DateTime strings
 
     template<typename V>
     _col_data_spec_(V cv,
@@ -1019,6 +1056,662 @@ struct _col_data_spec_  {
 
 // --------------------------------------
 
+// It calls func with a std::type_identity of the column vector type that
+// holds the given file type
+//
+template<template<typename> class V, typename F>
+inline static void
+_csv2_type_dispatch_(file_dtypes type, F &&func)  {
+
+    switch(type)  {
+        case file_dtypes::FLOAT:
+            func(std::type_identity<V<float>> { });  break;
+        case file_dtypes::DOUBLE:
+            func(std::type_identity<V<double>> { });  break;
+        case file_dtypes::LONG_DOUBLE:
+            func(std::type_identity<V<long double>> { });  break;
+        case file_dtypes::SHORT:
+            func(std::type_identity<V<short>> { });  break;
+        case file_dtypes::USHORT:
+            func(std::type_identity<V<unsigned short>> { });  break;
+        case file_dtypes::INT:
+            func(std::type_identity<V<int>> { });  break;
+        case file_dtypes::UINT:
+            func(std::type_identity<V<unsigned int>> { });  break;
+        case file_dtypes::LONG:
+            func(std::type_identity<V<long>> { });  break;
+        case file_dtypes::ULONG:
+            func(std::type_identity<V<unsigned long>> { });  break;
+        case file_dtypes::LONG_LONG:
+            func(std::type_identity<V<long long>> { });  break;
+        case file_dtypes::ULONG_LONG:
+            func(std::type_identity<V<unsigned long long>> { });  break;
+        case file_dtypes::CHAR:
+            func(std::type_identity<V<char>> { });  break;
+        case file_dtypes::UCHAR:
+            func(std::type_identity<V<unsigned char>> { });  break;
+        case file_dtypes::BOOL:
+            func(std::type_identity<V<bool>> { });  break;
+        case file_dtypes::STRING:
+            func(std::type_identity<V<std::string>> { });  break;
+        case file_dtypes::VSTR8:
+            func(std::type_identity<V<String8>> { });  break;
+        case file_dtypes::VSTR16:
+            func(std::type_identity<V<String16>> { });  break;
+        case file_dtypes::VSTR32:
+            func(std::type_identity<V<String32>> { });  break;
+        case file_dtypes::VSTR64:
+            func(std::type_identity<V<String64>> { });  break;
+        case file_dtypes::VSTR128:
+            func(std::type_identity<V<String128>> { });  break;
+        case file_dtypes::VSTR512:
+            func(std::type_identity<V<String512>> { });  break;
+        case file_dtypes::VSTR1K:
+            func(std::type_identity<V<String1K>> { });  break;
+        case file_dtypes::VSTR2K:
+            func(std::type_identity<V<String2K>> { });  break;
+        case file_dtypes::DATETIME:
+        case file_dtypes::DATETIME_AME:
+        case file_dtypes::DATETIME_EUR:
+        case file_dtypes::DATETIME_ISO:
+            func(std::type_identity<V<DateTime>> { });  break;
+        case file_dtypes::TIMESTAMP:
+            func(std::type_identity<V<Timestamp>> { });  break;
+        case file_dtypes::STR_DBL_PAIR:
+            func(std::type_identity<
+                     V<std::pair<std::string, double>>> { });
+            break;
+        case file_dtypes::STR_STR_PAIR:
+            func(std::type_identity<
+                     V<std::pair<std::string, std::string>>> { });
+            break;
+        case file_dtypes::DBL_DBL_PAIR:
+            func(std::type_identity<V<std::pair<double, double>>> { });
+            break;
+        case file_dtypes::DBL_VEC:
+            func(std::type_identity<V<std::vector<double>>> { });  break;
+        case file_dtypes::STR_VEC:
+            func(std::type_identity<V<std::vector<std::string>>> { });
+            break;
+        case file_dtypes::DBL_SET:
+            func(std::type_identity<V<std::set<double>>> { });  break;
+        case file_dtypes::STR_SET:
+            func(std::type_identity<V<std::set<std::string>>> { });  break;
+        case file_dtypes::STR_DBL_MAP:
+            func(std::type_identity<V<std::map<std::string, double>>> { });
+            break;
+        case file_dtypes::STR_DBL_UNOMAP:
+            func(std::type_identity<
+                     V<std::unordered_map<std::string, double>>> { });
+            break;
+    }
+}
+
+// --------------------------------------
+
+// It returns how many rows to reserve for a column, given the row count in
+// the header/schema (0 if unknown) and the number of rows the caller asked for
+//
+inline static std::size_t
+_csv2_reserve_rows_(std::size_t hint, std::size_t num_rows)  {
+
+    if (num_rows == std::numeric_limits<std::size_t>::max())
+        return (hint);
+    return (hint > 0 ? std::min(hint, num_rows) : num_rows);
+}
+
+// --------------------------------------
+
+template<template<typename> class V, typename SV>
+inline static void
+_read_csv2_schema_(const std::vector<ReadSchema> &schema,
+                   std::size_t num_rows,
+                   SV &spec_vec,
+                   int &requested_col_count)  {
+
+    requested_col_count = static_cast<int>(schema.size());
+    for (const auto &entry : schema)  {
+        if (entry.col_idx < 0)
+            throw DataFrameError(
+                "DataFrame::read_csv2_(): ERROR: In ReadSchema "
+                "the column index (col_idx) must be specified");
+        _csv2_type_dispatch_<V>(
+            entry.col_type,
+            [&spec_vec, &entry, num_rows](auto tag) -> void  {
+                spec_vec.emplace_back(
+                    typename decltype(tag)::type { },
+                    entry.col_type,
+                    entry.col_name.c_str(),
+                    _csv2_reserve_rows_(entry.num_rows, num_rows),
+                    entry.col_idx);
+            });
+    }
+}
+
+// --------------------------------------
+
+template<template<typename> class V, typename SV>
+inline static void
+_read_csv2_header_(const char *line,
+                   char delim,
+                   std::size_t num_rows,
+                   SV &spec_vec,
+                   int &requested_col_count)  {
+
+    std::stringstream   sstream (line);
+    std::string         type_str;
+    std::string         col_name;
+    std::string         value;
+    std::string         token;
+
+    type_str.reserve(14);
+    col_name.reserve(32);
+    value.reserve(32);
+    token.reserve(32);
+    while (std::getline(sstream, token, delim))  {
+        const std::size_t   token_s = token.size();
+        std::size_t         token_idx { 0 };
+
+        if (token_s > 0 &&
+            (token[token_s - 1] == '\r' ||
+             token[token_s - 1] == '\n')) [[unlikely]]
+            token.pop_back();
+        value.clear();
+        col_name.clear();
+        type_str.clear();
+        _get_token_from_string_(token, token_idx, ':', col_name);
+        _get_token_from_string_(token, token_idx, ':', value); // size
+        if (token_idx >= token_s || token[token_idx] != '<') [[unlikely]]
+            throw DataFrameError(
+                "DataFrame::read_csv2_(): ERROR: Expected "
+                "'<' char to specify column type");
+        token_idx += 1;  // Get rid of <
+        _get_token_from_string_(token, token_idx, '>', type_str);
+
+        const std::size_t   nrows =
+            _csv2_reserve_rows_(_from_chars_<std::size_t>(value), num_rows);
+        const auto          citer = _typename_id_.find(type_str);
+
+        if (citer == _typename_id_.end())
+            throw DataFrameError("DataFrame::read_csv2_(): ERROR: "
+                                 "Unknown column type");
+
+        _csv2_type_dispatch_<V>(
+            citer->second,
+            [&](auto tag) -> void  {
+                spec_vec.emplace_back(typename decltype(tag)::type { },
+                                      citer->second,
+                                      col_name.c_str(),
+                                      nrows,
+                                      requested_col_count++);
+            });
+    }
+}
+
+// --------------------------------------
+
+template<template<typename> class V>
+inline static void
+_read_csv2_value_(_col_data_spec_ &col_spec,
+                  std::string_view value,
+                  std::string &scratch)  {
+
+    const auto  val_size = value.size();
+
+        switch(col_spec.type_spec)  {
+            case file_dtypes::FLOAT: {
+                if (val_size > 0) [[likely]]
+                    std::any_cast<V<float> &>
+                        (col_spec.col_vec).push_back(
+                             _from_chars_<float>(value));
+                else
+                    std::any_cast<V<float> &>
+                        (col_spec.col_vec).push_back(get_nan<float>());
+                break;
+            }
+            case file_dtypes::DOUBLE: {
+                if (val_size > 0) [[likely]]
+                    std::any_cast<V<double> &>
+                        (col_spec.col_vec).push_back(
+                             _from_chars_<double>(value));
+                else
+                    std::any_cast<V<double> &>
+                        (col_spec.col_vec).push_back(
+                             get_nan<double>());
+                break;
+            }
+            case file_dtypes::LONG_DOUBLE: {
+                if (val_size > 0) [[likely]]
+                    std::any_cast<V<long double> &>
+                        (col_spec.col_vec).push_back(
+                             _from_chars_<long double>(value));
+                else
+                    std::any_cast<V<long double> &>
+                        (col_spec.col_vec).push_back(
+                             get_nan<long double>());
+                break;
+            }
+            case file_dtypes::SHORT: {
+                std::any_cast<V<short> &>
+                    (col_spec.col_vec).push_back(
+                        _from_chars_<short>(value));
+                break;
+            }
+            case file_dtypes::USHORT: {
+                std::any_cast<V<unsigned short> &>
+                    (col_spec.col_vec).push_back(
+                        _from_chars_<unsigned short>(value));
+                break;
+            }
+            case file_dtypes::INT: {
+                std::any_cast<V<int> &>
+                    (col_spec.col_vec).push_back(
+                        _from_chars_<int>(value));
+                break;
+            }
+            case file_dtypes::UINT: {
+                std::any_cast<V<unsigned int> &>
+                    (col_spec.col_vec).push_back(
+                        _from_chars_<unsigned int>(value));
+                break;
+            }
+            case file_dtypes::LONG: {
+                std::any_cast<V<long> &>
+                    (col_spec.col_vec).push_back(
+                        _from_chars_<long>(value));
+                break;
+            }
+            case file_dtypes::ULONG: {
+                std::any_cast<V<unsigned long> &>
+                    (col_spec.col_vec).push_back(
+                        _from_chars_<unsigned long>(value));
+                break;
+            }
+            case file_dtypes::LONG_LONG: {
+                std::any_cast<V<long long> &>
+                    (col_spec.col_vec).push_back(
+                        _from_chars_<long long>(value));
+                break;
+            }
+            case file_dtypes::ULONG_LONG: {
+                std::any_cast<V<unsigned long long> &>
+                    (col_spec.col_vec).push_back(
+                        _from_chars_<unsigned long long>(value));
+                break;
+            }
+            case file_dtypes::CHAR: {
+                if (val_size > 1)  {
+                    std::any_cast<V<char> &>
+                        (col_spec.col_vec).push_back(
+                            static_cast<char>(
+                                _from_chars_<int>(value)));
+                }
+                else if (val_size > 0)  {
+                    std::any_cast<V<char> &>
+                        (col_spec.col_vec).push_back(value[0]);
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<char> &>
+                        (col_spec.col_vec).push_back(get_nan<char>());
+                }
+                break;
+            }
+            case file_dtypes::UCHAR: {
+                if (val_size > 1)  {
+                    std::any_cast<V<unsigned char> &>
+                        (col_spec.col_vec).push_back(
+                            static_cast<unsigned char>(
+                                _from_chars_<int>(value)));
+                }
+                else if (val_size > 0)  {
+                    std::any_cast<V<unsigned char> &>
+                            (col_spec.col_vec).push_back(
+                            static_cast<unsigned char>(value[0]));
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<unsigned char> &>
+                        (col_spec.col_vec).push_back(
+                             get_nan<unsigned char>());
+                }
+                break;
+            }
+            case file_dtypes::BOOL: {
+                if (val_size > 0) [[likely]]  {
+                    const bool          v =
+                        static_cast<bool>
+                            (_from_chars_<unsigned long>(value));
+                    V<bool>   &vec =
+                        std::any_cast<V<bool> &>
+                            (col_spec.col_vec);
+
+                    vec.push_back(v);
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<bool> &>
+                        (col_spec.col_vec).push_back(get_nan<bool>());
+                }
+                break;
+            }
+            case file_dtypes::STRING: {
+                std::any_cast<V<std::string> &>
+                    (col_spec.col_vec).emplace_back(value);
+                break;
+            }
+            case file_dtypes::VSTR8: {
+                std::any_cast<V<String8> &>
+                    (col_spec.col_vec).emplace_back(
+                        scratch.assign(value).c_str());
+                break;
+            }
+            case file_dtypes::VSTR16: {
+                std::any_cast<V<String16> &>
+                    (col_spec.col_vec).emplace_back(
+                        scratch.assign(value).c_str());
+                break;
+            }
+            case file_dtypes::VSTR32: {
+                std::any_cast<V<String32> &>
+                    (col_spec.col_vec).emplace_back(
+                        scratch.assign(value).c_str());
+                break;
+            }
+            case file_dtypes::VSTR64: {
+                std::any_cast<V<String64> &>
+                    (col_spec.col_vec).emplace_back(
+                        scratch.assign(value).c_str());
+                break;
+            }
+            case file_dtypes::VSTR128: {
+                std::any_cast<V<String128> &>
+                    (col_spec.col_vec).emplace_back(
+                        scratch.assign(value).c_str());
+                break;
+            }
+            case file_dtypes::VSTR512: {
+                std::any_cast<V<String512> &>
+                    (col_spec.col_vec).emplace_back(
+                        scratch.assign(value).c_str());
+                break;
+            }
+            case file_dtypes::VSTR1K: {
+                std::any_cast<V<String1K> &>
+                    (col_spec.col_vec).emplace_back(
+                        scratch.assign(value).c_str());
+                break;
+            }
+            case file_dtypes::VSTR2K: {
+                std::any_cast<V<String2K> &>
+                    (col_spec.col_vec).emplace_back(
+                        scratch.assign(value).c_str());
+                break;
+            }
+            case file_dtypes::DATETIME: {
+                if (val_size > 0) [[likely]]  {
+                    std::any_cast<V<DateTime> &>
+                        (col_spec.col_vec).push_back(
+                            _get_dt_from_epoch_value_(value));
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<DateTime> &>
+                        (col_spec.col_vec).push_back(
+                             get_nan<DateTime>());
+                }
+                break;
+            }
+            case file_dtypes::DATETIME_AME: {
+                if (val_size > 0) [[likely]]  {
+                    std::any_cast<V<DateTime> &>
+                        (col_spec.col_vec).emplace_back(
+                            value,
+                            DT_DATE_STYLE::AME_STYLE,
+                            DT_TIME_ZONE::LOCAL,
+                            col_spec.dt_cache);
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<DateTime> &>
+                        (col_spec.col_vec).push_back(
+                             get_nan<DateTime>());
+                }
+                break;
+            }
+            case file_dtypes::DATETIME_EUR: {
+                if (val_size > 0) [[likely]]  {
+                    std::any_cast<V<DateTime> &>
+                        (col_spec.col_vec).emplace_back(
+                            value,
+                            DT_DATE_STYLE::EUR_STYLE,
+                            DT_TIME_ZONE::LOCAL,
+                            col_spec.dt_cache);
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<DateTime> &>
+                        (col_spec.col_vec).push_back(
+                             get_nan<DateTime>());
+                }
+                break;
+            }
+            case file_dtypes::DATETIME_ISO: {
+                if (val_size > 0) [[likely]]  {
+                    std::any_cast<V<DateTime> &>
+                        (col_spec.col_vec).emplace_back(
+                            value,
+                            DT_DATE_STYLE::ISO_STYLE,
+                            DT_TIME_ZONE::LOCAL,
+                            col_spec.dt_cache);
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<DateTime> &>
+                        (col_spec.col_vec).push_back(
+                             get_nan<DateTime>());
+                }
+                break;
+            }
+            case file_dtypes::TIMESTAMP: {
+                if (val_size > 0) [[likely]]  {
+                    std::any_cast<V<Timestamp> &>
+                        (col_spec.col_vec).push_back(
+                            _get_ts_from_epoch_value_(value));
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<Timestamp> &>
+                        (col_spec.col_vec).push_back(
+                             get_nan<Timestamp>());
+                }
+                break;
+            }
+            case file_dtypes::STR_DBL_PAIR: {
+                using val_t = std::pair<std::string, double>;
+
+                V<val_t>   &vec =
+                    std::any_cast<V<val_t> &>(
+                        col_spec.col_vec);
+
+                vec.push_back(std::move(_get_str_dbl_pair_from_value_(
+                                            scratch.assign(value).c_str())));
+                break;
+            }
+            case file_dtypes::STR_STR_PAIR: {
+                using val_t = std::pair<std::string, std::string>;
+
+                V<val_t>   &vec =
+                    std::any_cast<V<val_t> &>(
+                        col_spec.col_vec);
+
+                vec.push_back(std::move(_get_str_str_pair_from_value_(
+                                            scratch.assign(value).c_str())));
+                break;
+            }
+            case file_dtypes::DBL_DBL_PAIR: {
+                using val_t = std::pair<double, double>;
+
+                V<val_t>   &vec =
+                    std::any_cast<V<val_t> &>(
+                        col_spec.col_vec);
+
+                vec.push_back(std::move(_get_dbl_dbl_pair_from_value_(
+                                            scratch.assign(value).c_str())));
+                break;
+            }
+            case file_dtypes::DBL_VEC: {
+                if (val_size > 0) [[likely]]  {
+                    V<std::vector<double>>  &vec =
+                        std::any_cast<V<
+                            std::vector<double>> &>(col_spec.col_vec);
+
+                    vec.push_back(
+                        std::move(_get_dbl_vec_from_value_(
+                                      scratch.assign(value).c_str())));
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<std::vector<double>> &>
+                        (col_spec.col_vec).push_back
+                            (std::vector<double> { });
+                }
+                break;
+            }
+            case file_dtypes::STR_VEC: {
+                if (val_size > 0) [[likely]]  {
+                    V<std::vector<std::string>> &vec =
+                         std::any_cast<V<
+                             std::vector<std::string>> &>
+                                 (col_spec.col_vec);
+
+                    vec.push_back(
+                        std::move(_get_str_vec_from_value_(
+                                      scratch.assign(value).c_str())));
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<
+                        std::vector<std::string>> &>
+                            (col_spec.col_vec).push_back(
+                                std::vector<std::string> { });
+                }
+                break;
+            }
+            case file_dtypes::DBL_SET: {
+                using set_t = std::set<double>;
+
+                if (val_size > 0) [[likely]]  {
+                    V<set_t>   &vec =
+                        std::any_cast<V<set_t> &>
+                            (col_spec.col_vec);
+
+                    vec.push_back(std::move(_get_dbl_set_from_value_(
+                                      scratch.assign(value).c_str())));
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<set_t> &>
+                        (col_spec.col_vec).push_back(set_t { });
+                }
+                break;
+            }
+            case file_dtypes::STR_SET: {
+                using set_t = std::set<std::string>;
+
+                if (val_size > 0) [[likely]]  {
+                    V<set_t>   &vec =
+                        std::any_cast<V<set_t> &>
+                            (col_spec.col_vec);
+
+                    vec.push_back(std::move(_get_str_set_from_value_(
+                                      scratch.assign(value).c_str())));
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<set_t> &>
+                        (col_spec.col_vec).push_back(set_t { });
+                }
+                break;
+            }
+            case file_dtypes::STR_DBL_MAP: {
+                using map_t = std::map<std::string, double>;
+
+                if (val_size > 0) [[likely]]  {
+                    V<map_t>   &vec =
+                        std::any_cast<V<map_t> &>
+                            (col_spec.col_vec);
+
+                    vec.push_back(
+                        std::move(_get_str_dbl_map_from_value_<map_t>(
+                        scratch.assign(value).c_str())));
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<map_t> &>
+                        (col_spec.col_vec).push_back(map_t { });
+                }
+                break;
+            }
+            case file_dtypes::STR_DBL_UNOMAP: {
+                using map_t = std::unordered_map<std::string, double>;
+
+                if (val_size > 0) [[likely]]  {
+                    V<map_t>   &vec =
+                        std::any_cast<V<map_t> &>
+                            (col_spec.col_vec);
+
+                    vec.push_back(
+                        std::move(_get_str_dbl_map_from_value_<map_t>(
+                        scratch.assign(value).c_str())));
+                }
+                else [[unlikely]]  {
+                    std::any_cast<V<map_t> &>
+                        (col_spec.col_vec).push_back(map_t { });
+                }
+                break;
+            }
+        }
+}
+
+// --------------------------------------
+
+// It parses one data line into the column vectors in spec_vec.
+// Missing slots at the end of the line become NaN data points.
+// Tokens are views into line; scratch is only used by types that need a
+// null-terminated string.
+//
+template<template<typename> class V, typename SV>
+inline static void
+_read_csv2_row_(std::string_view line,
+                char delim,
+                int actual_col_count,
+                SV &spec_vec,
+                std::string &scratch)  {
+
+    const std::size_t   line_s = line.size();
+    std::size_t         pos { 0 };
+    std::size_t         spec_vec_idx { 0 };
+
+    for (int col_idx = 0; col_idx < actual_col_count; ++col_idx)  {
+        std::string_view    value { };
+
+        if (pos <= line_s) [[likely]]  {
+            const std::size_t   delim_pos = line.find(delim, pos);
+
+            if (delim_pos == std::string_view::npos)  {
+                value = line.substr(pos);
+                pos = line_s + 1;
+            }
+            else  {
+                value = line.substr(pos, delim_pos - pos);
+                pos = delim_pos + 1;
+            }
+        }
+        while (! value.empty() &&
+               (value.back() == '\r' || value.back() == '\n')) [[unlikely]]
+            value.remove_suffix(1);
+
+        if (spec_vec_idx >= spec_vec.size()) [[unlikely]]  break;
+
+        _col_data_spec_ &col_spec = spec_vec[spec_vec_idx];
+
+        if (col_idx != col_spec.col_idx) [[unlikely]] continue;
+
+        spec_vec_idx += 1;
+        _read_csv2_value_<V>(col_spec, value, scratch);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename S>
 void DataFrame<I, H>::
@@ -1034,16 +1727,15 @@ read_csv2_(S &stream,
 
     using SpecVec = StlVecType<_col_data_spec_>;
 
-    char                line[data_size];
-    std::string         value;
-    SpecVec             spec_vec;
-    bool                header_read { false };
-    int                 requested_col_count { 0 };
-    int                 actual_col_count { 0 };
-    size_type           data_rows_read { 0 };
-    size_type           row_cnt { 0 };
-    std::stringstream   sstream;
-    const bool          user_schema { ! schema.empty() };
+    char        line[data_size];
+    std::string value;
+    SpecVec     spec_vec;
+    bool        header_read { false };
+    int         requested_col_count { 0 };
+    int         actual_col_count { 0 };
+    size_type   data_rows_read { 0 };
+    size_type   row_cnt { 0 };
+    const bool  user_schema { ! schema.empty() };
 
     value.reserve(64);
     spec_vec.reserve(32);
@@ -1069,299 +1761,13 @@ read_csv2_(S &stream,
         if (line[0] == '\0' || line[0] == '#' ||
             line[0] == '\n' || line[0] == '\r') [[unlikely]]  continue;
 
-        sstream.clear();
-        sstream.str(line);
-
         // Is the caller specifying the schema
         //
         if ((! header_read) && user_schema)  {
-            requested_col_count = static_cast<int>(schema.size());
-            for (const auto &entry : schema)  {
-                if (entry.col_idx < 0)
-                    throw DataFrameError(
-                        "DataFrame::read_csv2_(): ERROR: In ReadSchema "
-                        "the column index (col_idx) must be specified");
-                switch(entry.col_type)  {
-                    case file_dtypes::FLOAT: {
-                        spec_vec.emplace_back(StlVecType<float>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::DOUBLE: {
-                        spec_vec.emplace_back(StlVecType<double>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::LONG_DOUBLE: {
-                        spec_vec.emplace_back(StlVecType<long double>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::SHORT: {
-                        spec_vec.emplace_back(StlVecType<short>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::USHORT: {
-                        spec_vec.emplace_back(StlVecType<unsigned short>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::INT: {
-                        spec_vec.emplace_back(StlVecType<int>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::UINT: {
-                        spec_vec.emplace_back(StlVecType<unsigned int>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::LONG: {
-                        spec_vec.emplace_back(StlVecType<long>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::ULONG: {
-                        spec_vec.emplace_back(StlVecType<unsigned long>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::LONG_LONG: {
-                        spec_vec.emplace_back(StlVecType<long long>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::ULONG_LONG: {
-                        spec_vec.emplace_back(
-                            StlVecType<unsigned long long>{ },
-                            entry.col_type,
-                            entry.col_name.c_str(),
-                            entry.num_rows,
-                            entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::CHAR: {
-                        spec_vec.emplace_back(StlVecType<char>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::UCHAR: {
-                        spec_vec.emplace_back(StlVecType<unsigned char>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::BOOL: {
-                        spec_vec.emplace_back(StlVecType<bool>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::STRING: {
-                        spec_vec.emplace_back(StlVecType<std::string>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::VSTR8: {
-                        spec_vec.emplace_back(StlVecType<String8>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::VSTR16: {
-                        spec_vec.emplace_back(StlVecType<String16>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::VSTR32: {
-                        spec_vec.emplace_back(StlVecType<String32>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::VSTR64: {
-                        spec_vec.emplace_back(StlVecType<String64>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::VSTR128: {
-                        spec_vec.emplace_back(StlVecType<String128>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::VSTR512: {
-                        spec_vec.emplace_back(StlVecType<String512>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::VSTR1K: {
-                        spec_vec.emplace_back(StlVecType<String1K>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::VSTR2K: {
-                        spec_vec.emplace_back(StlVecType<String2K>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::DATETIME:
-                    case file_dtypes::DATETIME_AME:
-                    case file_dtypes::DATETIME_EUR:
-                    case file_dtypes::DATETIME_ISO: {
-                        spec_vec.emplace_back(StlVecType<DateTime>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::STR_DBL_PAIR: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::pair<std::string, double>>{ },
-                            entry.col_type,
-                            entry.col_name.c_str(),
-                            entry.num_rows,
-                            entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::STR_STR_PAIR: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::pair<std::string, std::string>>{ },
-                            entry.col_type,
-                            entry.col_name.c_str(),
-                            entry.num_rows,
-                            entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::DBL_DBL_PAIR: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::pair<double, double>>{ },
-                            entry.col_type,
-                            entry.col_name.c_str(),
-                            entry.num_rows,
-                            entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::DBL_VEC: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::vector<double>>{ },
-                            entry.col_type,
-                            entry.col_name.c_str(),
-                            entry.num_rows,
-                            entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::STR_VEC: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::vector<std::string>>{ },
-                            entry.col_type,
-                            entry.col_name.c_str(),
-                            entry.num_rows,
-                            entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::DBL_SET: {
-                        spec_vec.emplace_back(StlVecType<std::set<double>>{ },
-                                              entry.col_type,
-                                              entry.col_name.c_str(),
-                                              entry.num_rows,
-                                              entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::STR_SET: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::set<std::string>>{ },
-                            entry.col_type,
-                            entry.col_name.c_str(),
-                            entry.num_rows,
-                            entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::STR_DBL_MAP: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::map<std::string, double>>{ },
-                            entry.col_type,
-                            entry.col_name.c_str(),
-                            entry.num_rows,
-                            entry.col_idx);
-                        break;
-                    }
-                    case file_dtypes::STR_DBL_UNOMAP: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::unordered_map<std::string,
-                                                          double>>{ },
-                            entry.col_type,
-                            entry.col_name.c_str(),
-                            entry.num_rows,
-                            entry.col_idx);
-                        break;
-                    }
-                }
-            }
-
+            _read_csv2_schema_<StlVecType>(schema,
+                                           num_rows,
+                                           spec_vec,
+                                           requested_col_count);
             header_read = true;
             if (skip_first_line)  continue;
         }
@@ -1369,341 +1775,24 @@ read_csv2_(S &stream,
         // The schema/header comes from the file
         //
         if (! header_read) [[unlikely]]  {
-            std::string type_str;
-            std::string col_name;
-            std::string token;
-
-            type_str.reserve(14);
-            col_name.reserve(32);
-            token.reserve(32);
-            while (std::getline(sstream, token, delim))  {
-                const size_type token_s = token.size();
-                size_type       token_idx { 0 };
-
-                if (token_s > 0 &&
-                    (token[token_s - 1] == '\r' ||
-                     token[token_s - 1] == '\n')) [[unlikely]]
-                    token.pop_back();
-                value.clear();
-                col_name.clear();
-                type_str.clear();
-                _get_token_from_string_(token, token_idx, ':', col_name);
-                _get_token_from_string_(token, token_idx, ':', value); // size
-                if (token_idx >= token_s ||
-                    token[token_idx] != '<') [[unlikely]]
-                    throw DataFrameError(
-                        "DataFrame::read_csv2_(): ERROR: Expected "
-                        "'<' char to specify column type");
-                token_idx += 1;  // Get rid of <
-                _get_token_from_string_(token, token_idx, '>', type_str);
-
-                const size_type nrows =
-                    num_rows == std::numeric_limits<size_type>::max()
-                        ? _atoi_<size_type>(value.c_str(), int(value.size()))
-                        : num_rows;
-                const auto      citer = _typename_id_.find(type_str);
-
-                if (citer == _typename_id_.end())
-                    throw DataFrameError("DataFrame::read_csv2_(): ERROR: "
-                                         "Unknown column type");
-
-                switch(citer->second)  {
-                    case file_dtypes::FLOAT: {
-                        spec_vec.emplace_back(StlVecType<float>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::DOUBLE: {
-                        spec_vec.emplace_back(StlVecType<double>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::LONG_DOUBLE: {
-                        spec_vec.emplace_back(StlVecType<long double>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::SHORT: {
-                        spec_vec.emplace_back(StlVecType<short>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::USHORT: {
-                        spec_vec.emplace_back(StlVecType<unsigned short>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::INT: {
-                        spec_vec.emplace_back(StlVecType<int>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::UINT: {
-                        spec_vec.emplace_back(StlVecType<unsigned int>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::LONG: {
-                        spec_vec.emplace_back(StlVecType<long>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::ULONG: {
-                        spec_vec.emplace_back(StlVecType<unsigned long>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::LONG_LONG: {
-                        spec_vec.emplace_back(StlVecType<long long>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::ULONG_LONG: {
-                        spec_vec.emplace_back(
-                            StlVecType<unsigned long long>{ },
-                            citer->second,
-                            col_name.c_str(),
-                            nrows,
-                            requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::CHAR: {
-                        spec_vec.emplace_back(StlVecType<char>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::UCHAR: {
-                        spec_vec.emplace_back(StlVecType<unsigned char>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::BOOL: {
-                        spec_vec.emplace_back(StlVecType<bool>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::STRING: {
-                        spec_vec.emplace_back(StlVecType<std::string>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::VSTR8: {
-                        spec_vec.emplace_back(StlVecType<String8>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::VSTR16: {
-                        spec_vec.emplace_back(StlVecType<String16>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::VSTR32: {
-                        spec_vec.emplace_back(StlVecType<String32>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::VSTR64: {
-                        spec_vec.emplace_back(StlVecType<String64>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::VSTR128: {
-                        spec_vec.emplace_back(StlVecType<String128>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::VSTR512: {
-                        spec_vec.emplace_back(StlVecType<String512>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::VSTR1K: {
-                        spec_vec.emplace_back(StlVecType<String1K>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::VSTR2K: {
-                        spec_vec.emplace_back(StlVecType<String2K>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::DATETIME:
-                    case file_dtypes::DATETIME_AME:
-                    case file_dtypes::DATETIME_EUR:
-                    case file_dtypes::DATETIME_ISO: {
-                        spec_vec.emplace_back(StlVecType<DateTime>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::STR_DBL_PAIR: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::pair<std::string, double>>{ },
-                            citer->second,
-                            col_name.c_str(),
-                            nrows,
-                            requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::STR_STR_PAIR: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::pair<std::string, std::string>>{ },
-                            citer->second,
-                            col_name.c_str(),
-                            nrows,
-                            requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::DBL_DBL_PAIR: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::pair<double, double>>{ },
-                            citer->second,
-                            col_name.c_str(),
-                            nrows,
-                            requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::DBL_VEC: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::vector<double>>{ },
-                            citer->second,
-                            col_name.c_str(),
-                            nrows,
-                            requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::STR_VEC: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::vector<std::string>>{ },
-                            citer->second,
-                            col_name.c_str(),
-                            nrows,
-                            requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::DBL_SET: {
-                        spec_vec.emplace_back(StlVecType<std::set<double>>{ },
-                                              citer->second,
-                                              col_name.c_str(),
-                                              nrows,
-                                              requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::STR_SET: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::set<std::string>>{ },
-                            citer->second,
-                            col_name.c_str(),
-                            nrows,
-                            requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::STR_DBL_MAP: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::map<std::string, double>>{ },
-                            citer->second,
-                            col_name.c_str(),
-                            nrows,
-                            requested_col_count++);
-                        break;
-                    }
-                    case file_dtypes::STR_DBL_UNOMAP: {
-                        spec_vec.emplace_back(
-                            StlVecType<std::unordered_map<std::string,
-                                                          double>>{ },
-                            citer->second,
-                            col_name.c_str(),
-                            nrows,
-                            requested_col_count++);
-                        break;
-                    }
-                }
-            }
+            _read_csv2_header_<StlVecType>(line,
+                                           delim,
+                                           num_rows,
+                                           spec_vec,
+                                           requested_col_count);
             header_read = true;
             continue;
         }
 
+        const std::string_view  line_view { line };
+
         // Now read data rows
         //
         if (actual_col_count <= 0) [[unlikely]]  {
-            if (user_schema)  {
-                const std::streampos    old_pos = sstream.tellg();
-
-                std::getline(sstream, value);
-                sstream.seekg(old_pos);
+            if (user_schema)
                 actual_col_count =
-                    static_cast<int>(
-                        std::count(value.begin(), value.end(), delim)) +
+                    static_cast<int>(std::ranges::count(line_view, delim)) +
                     1;
-            }
             else
                 actual_col_count = requested_col_count;
         }
@@ -1711,431 +1800,273 @@ read_csv2_(S &stream,
         if (row_cnt++ >= starting_row) [[likely]]  {
             if (data_rows_read++ >= num_rows) [[unlikely]]  break;
 
-            size_type   spec_vec_idx { 0 };
-
-            // Make sure we account for empty slots at the end of the line
-            // and create NaN data points
-            //
-            for (int col_idx = 0; col_idx < actual_col_count; ++col_idx)  {
-                value.clear();
-                if (! sstream.eof()) [[likely]]
-                    std::getline(sstream, value, delim);
+            _read_csv2_row_<StlVecType>(line_view,
+                                        delim,
+                                        actual_col_count,
+                                        spec_vec,
+                                        value);
+        }
+    }
 
-                const auto  val_size = value.size();
+    read_csv2_load_(spec_vec, columns_only);
+}
 
-                if (val_size > 0 &&
-                    (value[val_size - 1] == '\r' ||
-                     value[val_size - 1] == '\n')) [[unlikely]]
-                    value.pop_back();
-                if (spec_vec_idx >= spec_vec.size()) [[unlikely]]  break;
+// ----------------------------------------------------------------------------
 
-                _col_data_spec_ &col_spec = spec_vec[spec_vec_idx];
+template<typename I, typename H>
+void DataFrame<I, H>::
+read_csv2_mmap_(const char *file_name, const ReadParams &params)  {
 
-                if (col_idx != col_spec.col_idx) [[unlikely]] continue;
+    using SpecVec = StlVecType<_col_data_spec_>;
+    using ChunkVec = StlVecType<std::pair<const char *, const char *>>;
 
-                spec_vec_idx += 1;
+    const IOMmapOpti    io_mmap (file_name);
+    const char          *cur = io_mmap.data;
+    const char          *const file_end = io_mmap.data + io_mmap.size;
+    std::string         value;
+    SpecVec             spec_vec;
+    bool                header_read { false };
+    int                 requested_col_count { 0 };
+    int                 actual_col_count { 0 };
 
-                switch(col_spec.type_spec)  {
-                    case file_dtypes::FLOAT: {
-                        if (val_size > 0) [[likely]]
-                            std::any_cast<StlVecType<float> &>
-                                (col_spec.col_vec).push_back(
-                                     std::strtof(value.c_str(), nullptr));
-                        else
-                            std::any_cast<StlVecType<float> &>
-                                (col_spec.col_vec).push_back(get_nan<float>());
-                        break;
-                    }
-                    case file_dtypes::DOUBLE: {
-                        if (val_size > 0) [[likely]]
-                            std::any_cast<StlVecType<double> &>
-                                (col_spec.col_vec).push_back(
-                                     std::strtod(value.c_str(), nullptr));
-                        else
-                            std::any_cast<StlVecType<double> &>
-                                (col_spec.col_vec).push_back(
-                                     get_nan<double>());
-                        break;
-                    }
-                    case file_dtypes::LONG_DOUBLE: {
-                        if (val_size > 0) [[likely]]
-                            std::any_cast<StlVecType<long double> &>
-                                (col_spec.col_vec).push_back(
-                                     std::strtold(value.c_str(), nullptr));
-                        else
-                            std::any_cast<StlVecType<long double> &>
-                                (col_spec.col_vec).push_back(
-                                     get_nan<long double>());
-                        break;
-                    }
-                    case file_dtypes::SHORT: {
-                        std::any_cast<StlVecType<short> &>
-                            (col_spec.col_vec).push_back(
-                                _atoi_<short>(value.c_str(), int(val_size)));
-                        break;
-                    }
-                    case file_dtypes::USHORT: {
-                        std::any_cast<StlVecType<unsigned short> &>
-                            (col_spec.col_vec).push_back(
-                                _atoi_<unsigned short>(value.c_str(),
-                                                       int(val_size)));
-                        break;
-                    }
-                    case file_dtypes::INT: {
-                        std::any_cast<StlVecType<int> &>
-                            (col_spec.col_vec).push_back(
-                                _atoi_<int>(value.c_str(), int(val_size)));
-                        break;
-                    }
-                    case file_dtypes::UINT: {
-                        std::any_cast<StlVecType<unsigned int> &>
-                            (col_spec.col_vec).push_back(
-                                _atoi_<unsigned int>(value.c_str(),
-                                                     int(val_size)));
-                        break;
-                    }
-                    case file_dtypes::LONG: {
-                        std::any_cast<StlVecType<long> &>
-                            (col_spec.col_vec).push_back(
-                                _atoi_<long>(value.c_str(), int(val_size)));
-                        break;
-                    }
-                    case file_dtypes::ULONG: {
-                        std::any_cast<StlVecType<unsigned long> &>
-                            (col_spec.col_vec).push_back(
-                                _atoi_<unsigned long>(value.c_str(),
-                                                      int(val_size)));
-                        break;
-                    }
-                    case file_dtypes::LONG_LONG: {
-                        std::any_cast<StlVecType<long long> &>
-                            (col_spec.col_vec).push_back(
-                                _atoi_<long long>(value.c_str(),
-                                                  int(val_size)));
-                        break;
-                    }
-                    case file_dtypes::ULONG_LONG: {
-                        std::any_cast<StlVecType<unsigned long long> &>
-                            (col_spec.col_vec).push_back(
-                                _atoi_<unsigned long long>(value.c_str(),
-                                                           int(val_size)));
-                        break;
-                    }
-                    case file_dtypes::CHAR: {
-                        if (val_size > 1)  {
-                            std::any_cast<StlVecType<char> &>
-                                (col_spec.col_vec).push_back(
-                                    static_cast<char>(
-                                        _atoi_<int>(value.c_str(),
-                                                    value.size())));
-                        }
-                        else if (val_size > 0)  {
-                            std::any_cast<StlVecType<char> &>
-                                (col_spec.col_vec).push_back(value[0]);
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<char> &>
-                                (col_spec.col_vec).push_back(get_nan<char>());
-                        }
-                        break;
-                    }
-                    case file_dtypes::UCHAR: {
-                        if (val_size > 1)  {
-                            std::any_cast<StlVecType<unsigned char> &>
-                                (col_spec.col_vec).push_back(
-                                    static_cast<unsigned char>(
-                                        _atoi_<int>(value.c_str(),
-                                                    value.size())));
-                        }
-                        else if (val_size > 0)  {
-                            std::any_cast<StlVecType<unsigned char> &>
-                                    (col_spec.col_vec).push_back(
-                                    static_cast<unsigned char>(value[0]));
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<unsigned char> &>
-                                (col_spec.col_vec).push_back(
-                                     get_nan<unsigned char>());
-                        }
-                        break;
-                    }
-                    case file_dtypes::BOOL: {
-                        if (val_size > 0) [[likely]]  {
-                            const bool          v =
-                                static_cast<bool>
-                                    (strtoul(value.c_str(), nullptr, 0));
-                            StlVecType<bool>   &vec =
-                                std::any_cast<StlVecType<bool> &>
-                                    (col_spec.col_vec);
-
-                            vec.push_back(v);
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<bool> &>
-                                (col_spec.col_vec).push_back(get_nan<bool>());
-                        }
-                        break;
-                    }
-                    case file_dtypes::STRING: {
-                        if (val_size > 0 &&
-                            (value.back() == '\n' || value.back() == '\r')) {
-                            value.pop_back();
-                        }
-                        std::any_cast<StlVecType<std::string> &>
-                            (col_spec.col_vec).emplace_back(value);
-                        break;
-                    }
-                    case file_dtypes::VSTR8: {
-                        std::any_cast<StlVecType<String8> &>
-                            (col_spec.col_vec).emplace_back(value.c_str());
-                        break;
-                    }
-                    case file_dtypes::VSTR16: {
-                        std::any_cast<StlVecType<String16> &>
-                            (col_spec.col_vec).emplace_back(value.c_str());
-                        break;
-                    }
-                    case file_dtypes::VSTR32: {
-                        std::any_cast<StlVecType<String32> &>
-                            (col_spec.col_vec).emplace_back(value.c_str());
-                        break;
-                    }
-                    case file_dtypes::VSTR64: {
-                        std::any_cast<StlVecType<String64> &>
-                            (col_spec.col_vec).emplace_back(value.c_str());
-                        break;
-                    }
-                    case file_dtypes::VSTR128: {
-                        std::any_cast<StlVecType<String128> &>
-                            (col_spec.col_vec).emplace_back(value.c_str());
-                        break;
-                    }
-                    case file_dtypes::VSTR512: {
-                        std::any_cast<StlVecType<String512> &>
-                            (col_spec.col_vec).emplace_back(value.c_str());
-                        break;
-                    }
-                    case file_dtypes::VSTR1K: {
-                        std::any_cast<StlVecType<String1K> &>
-                            (col_spec.col_vec).emplace_back(value.c_str());
-                        break;
-                    }
-                    case file_dtypes::VSTR2K: {
-                        std::any_cast<StlVecType<String2K> &>
-                            (col_spec.col_vec).emplace_back(value.c_str());
-                        break;
-                    }
-                    case file_dtypes::DATETIME: {
-                        if (val_size > 0) [[likely]]  {
-                            time_t      t;
-                            int         n;
-                            DateTime    dt;
-
-#ifdef _MSC_VER
-                            ::sscanf(value.c_str(), "%lld.%d", &t, &n);
-#else
-                            ::sscanf(value.c_str(), "%ld.%d", &t, &n);
-#endif // _MSC_VER
-                            dt.set_time(t, n);
-                            std::any_cast<StlVecType<DateTime> &>
-                                (col_spec.col_vec).emplace_back(std::move(dt));
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<DateTime> &>
-                                (col_spec.col_vec).push_back(
-                                     get_nan<DateTime>());
-                        }
-                        break;
-                    }
-                    case file_dtypes::DATETIME_AME: {
-                        if (val_size > 0) [[likely]]  {
-                            while (value.back() == '\r' || value.back() == '\n')
-                                value.pop_back();
-                            std::any_cast<StlVecType<DateTime> &>
-                                (col_spec.col_vec).emplace_back(
-                                    value.c_str(), DT_DATE_STYLE::AME_STYLE);
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<DateTime> &>
-                                (col_spec.col_vec).push_back(
-                                     get_nan<DateTime>());
-                        }
-                        break;
-                    }
-                    case file_dtypes::DATETIME_EUR: {
-                        if (val_size > 0) [[likely]]  {
-                            while (value.back() == '\r' || value.back() == '\n')
-                                value.pop_back();
-                            std::any_cast<StlVecType<DateTime> &>
-                                (col_spec.col_vec).emplace_back(
-                                    value.c_str(), DT_DATE_STYLE::EUR_STYLE);
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<DateTime> &>
-                                (col_spec.col_vec).push_back(
-                                     get_nan<DateTime>());
-                        }
-                        break;
-                    }
-                    case file_dtypes::DATETIME_ISO: {
-                        if (val_size > 0) [[likely]]  {
-                            while (value.back() == '\r' || value.back() == '\n')
-                                value.pop_back();
-                            std::any_cast<StlVecType<DateTime> &>
-                                (col_spec.col_vec).emplace_back(
-                                    value.c_str(), DT_DATE_STYLE::ISO_STYLE);
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<DateTime> &>
-                                (col_spec.col_vec).push_back(
-                                     get_nan<DateTime>());
-                        }
-                        break;
-                    }
-                    case file_dtypes::STR_DBL_PAIR: {
-                        using val_t = std::pair<std::string, double>;
+    // It returns the next line and advances begin past it
+    //
+    auto    next_line =
+        [](const char *&begin, const char *end) -> std::string_view  {
+            const char  *eol = static_cast<const char *>(
+                std::memchr(begin, '\n', std::size_t(end - begin)));
 
-                        StlVecType<val_t>   &vec =
-                            std::any_cast<StlVecType<val_t> &>(
-                                col_spec.col_vec);
+            if (! eol)  eol = end;
 
-                        vec.push_back(std::move(_get_str_dbl_pair_from_value_(
-                                                    value.c_str())));
-                        break;
-                    }
-                    case file_dtypes::STR_STR_PAIR: {
-                        using val_t = std::pair<std::string, std::string>;
+            const std::string_view  line (begin, std::size_t(eol - begin));
 
-                        StlVecType<val_t>   &vec =
-                            std::any_cast<StlVecType<val_t> &>(
-                                col_spec.col_vec);
+            begin = eol < end ? eol + 1 : end;
+            return (line);
+        };
+    auto    is_skipped =
+        [](std::string_view line) -> bool  {
+            return (line.empty() || line[0] == '\0' ||
+                    line[0] == '#' || line[0] == '\r');
+        };
 
-                        vec.push_back(std::move(_get_str_str_pair_from_value_(
-                                                    value.c_str())));
-                        break;
-                    }
-                    case file_dtypes::DBL_DBL_PAIR: {
-                        using val_t = std::pair<double, double>;
+    // Read the schema/header serially
+    //
+    value.reserve(64);
+    spec_vec.reserve(32);
+    while (cur < file_end && ! header_read)  {
+        const char              *line_begin = cur;
+        const std::string_view  line = next_line(cur, file_end);
+
+        if (is_skipped(line)) [[unlikely]]  continue;
+
+        if (! params.schema.empty())  {
+            _read_csv2_schema_<StlVecType>(params.schema,
+                                           params.num_rows,
+                                           spec_vec,
+                                           requested_col_count);
+            if (! params.skip_first_line)  cur = line_begin;
+        }
+        else  {
+            value.assign(line);
+            _read_csv2_header_<StlVecType>(value.c_str(),
+                                           params.delim,
+                                           params.num_rows,
+                                           spec_vec,
+                                           requested_col_count);
+        }
+        header_read = true;
+    }
+    if (spec_vec.empty())  return;
 
-                        StlVecType<val_t>   &vec =
-                            std::any_cast<StlVecType<val_t> &>(
-                                col_spec.col_vec);
+    if (! params.schema.empty())  {
+        for (const char *peek = cur; peek < file_end; )  {
+            const std::string_view  line = next_line(peek, file_end);
 
-                        vec.push_back(std::move(_get_dbl_dbl_pair_from_value_(
-                                                    value.c_str())));
-                        break;
-                    }
-                    case file_dtypes::DBL_VEC: {
-                        if (val_size > 0) [[likely]]  {
-                            StlVecType<std::vector<double>>  &vec =
-                                std::any_cast<StlVecType<
-                                    std::vector<double>> &>(col_spec.col_vec);
-
-                            vec.push_back(
-                                std::move(_get_dbl_vec_from_value_(
-                                              value.c_str())));
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<std::vector<double>> &>
-                                (col_spec.col_vec).push_back
-                                    (std::vector<double> { });
-                        }
-                        break;
-                    }
-                    case file_dtypes::STR_VEC: {
-                        if (val_size > 0) [[likely]]  {
-                            StlVecType<std::vector<std::string>> &vec =
-                                 std::any_cast<StlVecType<
-                                     std::vector<std::string>> &>
-                                         (col_spec.col_vec);
-
-                            vec.push_back(
-                                std::move(_get_str_vec_from_value_(
-                                              value.c_str())));
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<
-                                std::vector<std::string>> &>
-                                    (col_spec.col_vec).push_back(
-                                        std::vector<std::string> { });
-                        }
-                        break;
-                    }
-                    case file_dtypes::DBL_SET: {
-                        using set_t = std::set<double>;
+            if (! is_skipped(line))  {
+                actual_col_count =
+                    static_cast<int>(
+                        std::ranges::count(line, params.delim)) + 1;
+                break;
+            }
+        }
+    }
+    else
+        actual_col_count = requested_col_count;
 
-                        if (val_size > 0) [[likely]]  {
-                            StlVecType<set_t>   &vec =
-                                std::any_cast<StlVecType<set_t> &>
-                                    (col_spec.col_vec);
+    // Estimate the average row length from a sample of lines, so each
+    // chunk can reserve its column vectors up front
+    //
+    size_type   sample_rows { 0 };
+    const char  *sample_end = cur;
 
-                            vec.push_back(std::move(_get_dbl_set_from_value_(
-                                              value.c_str())));
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<set_t> &>
-                                (col_spec.col_vec).push_back(set_t { });
-                        }
-                        break;
-                    }
-                    case file_dtypes::STR_SET: {
-                        using set_t = std::set<std::string>;
+    while (sample_end < file_end && sample_rows < 128)  {
+        next_line(sample_end, file_end);
+        sample_rows += 1;
+    }
 
-                        if (val_size > 0) [[likely]]  {
-                            StlVecType<set_t>   &vec =
-                                std::any_cast<StlVecType<set_t> &>
-                                    (col_spec.col_vec);
+    const size_type row_bytes =
+        sample_rows > 0
+            ? std::max(size_type(sample_end - cur) / sample_rows, size_type(1))
+            : size_type(1);
 
-                            vec.push_back(std::move(_get_str_set_from_value_(
-                                              value.c_str())));
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<set_t> &>
-                                (col_spec.col_vec).push_back(set_t { });
-                        }
-                        break;
-                    }
-                    case file_dtypes::STR_DBL_MAP: {
-                        using map_t = std::map<std::string, double>;
+    // Split the data section into chunks at line boundaries
+    //
+    const size_type chunk_size = std::max(params.chunk_size, size_type(1));
+    ChunkVec        chunks;
+
+    chunks.reserve(size_type(file_end - cur) / chunk_size + 1);
+    while (cur < file_end)  {
+        const char  *chunk_end =
+            cur + std::min(chunk_size, size_type(file_end - cur));
+
+        if (chunk_end < file_end)  {
+            chunk_end = static_cast<const char *>(
+                std::memchr(chunk_end, '\n', size_type(file_end - chunk_end)));
+            chunk_end = chunk_end ? chunk_end + 1 : file_end;
+        }
+        chunks.emplace_back(cur, chunk_end);
+        cur = chunk_end;
+    }
 
-                        if (val_size > 0) [[likely]]  {
-                            StlVecType<map_t>   &vec =
-                                std::any_cast<StlVecType<map_t> &>
-                                    (col_spec.col_vec);
+    const size_type             chunk_cnt = chunks.size();
+    StlVecType<SpecVec>         chunk_specs (chunk_cnt, spec_vec);
+    StlVecType<size_type>       chunk_rows (chunk_cnt, 0);
+    const char                  delim = params.delim;
+    auto                        parse_chunk =
+        [&](size_type chunk_idx) -> void  {
+            const char  *begin = chunks[chunk_idx].first;
+            const char  *end = chunks[chunk_idx].second;
+            std::string local_value;
+            size_type   rows { 0 };
+
+            local_value.reserve(64);
+            for (auto &col_spec : chunk_specs[chunk_idx])
+                _csv2_type_dispatch_<StlVecType>(
+                    col_spec.type_spec,
+                    [&col_spec, n = size_type(end - begin) / row_bytes + 1]
+                    (auto tag) -> void  {
+                        using vec_t = typename decltype(tag)::type;
+
+                        std::any_cast<vec_t &>(col_spec.col_vec).reserve(n);
+                    });
+            while (begin < end)  {
+                const std::string_view  line = next_line(begin, end);
+
+                if (is_skipped(line)) [[unlikely]]  continue;
+                _read_csv2_row_<StlVecType>(line,
+                                            delim,
+                                            actual_col_count,
+                                            chunk_specs[chunk_idx],
+                                            local_value);
+                rows += 1;
+            }
+            chunk_rows[chunk_idx] = rows;
+        };
+    const auto                  thread_level =
+        params.num_threads > 0
+            ? std::min(size_type(get_thread_level()), params.num_threads)
+            : size_type(get_thread_level());
+
+    if (thread_level > 2 && chunk_cnt > 1)  {
+        const size_type                 task_cnt =
+            std::min(thread_level, chunk_cnt);
+        std::vector<std::future<void>>  futures;
+
+        futures.reserve(task_cnt);
+        for (size_type t = 0; t < task_cnt; ++t)
+            futures.emplace_back(
+                thr_pool_.dispatch(
+                    false,
+                    [&parse_chunk, task_cnt, chunk_cnt, t]() -> void  {
+                        for (size_type c = t; c < chunk_cnt; c += task_cnt)
+                            parse_chunk(c);
+                    }));
+        for (auto &fut : futures)  fut.get();
+    }
+    else  {
+        for (size_type c = 0; c < chunk_cnt; ++c)
+            parse_chunk(c);
+    }
 
-                            vec.push_back(
-                                std::move(_get_str_dbl_map_from_value_<map_t>(
-                                value.c_str())));
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<map_t> &>
-                                (col_spec.col_vec).push_back(map_t { });
+    // Concatenate the chunk pieces in order, honoring starting_row and
+    // num_rows the same way the serial reader does
+    //
+    const size_type first_row = params.starting_row;
+    const size_type last_row =
+        params.num_rows > std::numeric_limits<size_type>::max() - first_row
+            ? std::numeric_limits<size_type>::max()
+            : first_row + params.num_rows;
+    const size_type total_rows =
+        std::accumulate(chunk_rows.begin(), chunk_rows.end(), size_type(0));
+    const size_type result_rows =
+        std::min(total_rows, last_row) - std::min(total_rows, first_row);
+    auto            concat_col =
+        [&](size_type col) -> void  {
+            _col_data_spec_ &col_spec = spec_vec[col];
+
+            _csv2_type_dispatch_<StlVecType>(
+                col_spec.type_spec,
+                [&](auto tag) -> void  {
+                    using vec_t = typename decltype(tag)::type;
+
+                    vec_t       &dst =
+                        std::any_cast<vec_t &>(col_spec.col_vec);
+                    size_type   row_offset { 0 };
+
+                    dst.reserve(result_rows);
+
+                    for (size_type c = 0; c < chunk_cnt; ++c)  {
+                        vec_t           &src =
+                            std::any_cast<vec_t &>(
+                                chunk_specs[c][col].col_vec);
+                        const size_type lo = std::max(row_offset, first_row);
+                        const size_type hi =
+                            std::min(row_offset + chunk_rows[c], last_row);
+
+                        if (lo < hi)  {
+                            const size_type skip =
+                                std::min(lo - row_offset, src.size());
+                            const size_type take =
+                                std::min(hi - lo, src.size() - skip);
+
+                            dst.insert(dst.end(),
+                                       std::make_move_iterator(
+                                           src.begin() + skip),
+                                       std::make_move_iterator(
+                                           src.begin() + (skip + take)));
                         }
-                        break;
+                        vec_t().swap(src);
+                        row_offset += chunk_rows[c];
                     }
-                    case file_dtypes::STR_DBL_UNOMAP: {
-                        using map_t = std::unordered_map<std::string, double>;
+                });
+        };
+    const size_type spec_s = spec_vec.size();
 
-                        if (val_size > 0) [[likely]]  {
-                            StlVecType<map_t>   &vec =
-                                std::any_cast<StlVecType<map_t> &>
-                                    (col_spec.col_vec);
+    if (thread_level > 2 && spec_s > 1)  {
+        auto    futures =
+            thr_pool_.parallel_loop<double>(
+                size_type(0), spec_s,
+                [&concat_col](size_type begin, size_type end) -> void  {
+                    for (size_type col = begin; col < end; ++col)
+                        concat_col(col);
+                });
 
-                            vec.push_back(
-                                std::move(_get_str_dbl_map_from_value_<map_t>(
-                                value.c_str())));
-                        }
-                        else [[unlikely]]  {
-                            std::any_cast<StlVecType<map_t> &>
-                                (col_spec.col_vec).push_back(map_t { });
-                        }
-                        break;
-                    }
-                }
-            }
-        }
+        for (auto &fut : futures)  fut.get();
+    }
+    else  {
+        for (size_type col = 0; col < spec_s; ++col)
+            concat_col(col);
     }
 
+    read_csv2_load_(spec_vec, params.columns_only);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename V>
+void DataFrame<I, H>::read_csv2_load_(V &spec_vec, bool columns_only)  {
+
     const size_type spec_s = spec_vec.size();
 
     // Now load the data into the DataFrame
@@ -2154,294 +2085,18 @@ read_csv2_(S &stream,
             spec_vec[0].col_name == DF_INDEX_COL_NAME ? 1 : 0;
 
         for (size_type i = begin; i < spec_s; ++i) [[likely]]  {
-            _col_data_spec_ col_spec = spec_vec[i];
+            _col_data_spec_ &col_spec = spec_vec[i];
 
-            switch(col_spec.type_spec)  {
-                case file_dtypes::FLOAT: {
-                    load_column<float>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<float> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::DOUBLE: {
-                    load_column<double>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<double> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::LONG_DOUBLE: {
-                    load_column<long double>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<long double> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::SHORT: {
-                    load_column<short>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<short> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::USHORT: {
-                    load_column<unsigned short>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<unsigned short> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::INT: {
-                    load_column<int>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<int> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::UINT: {
-                    load_column<unsigned int>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<unsigned int> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::LONG: {
-                    load_column<long>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<long> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::ULONG: {
-                    load_column<unsigned long>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<unsigned long>&>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::LONG_LONG: {
-                    load_column<long long>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<long long> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::ULONG_LONG: {
-                    load_column<unsigned long long>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<
-                                      StlVecType<unsigned long long> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::CHAR: {
-                    load_column<char>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<char> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::UCHAR: {
-                    load_column<unsigned char>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<unsigned char> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::BOOL: {
-                    load_column<bool>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<bool> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::STRING: {
-                    load_column<std::string>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<std::string> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::VSTR8: {
-                    load_column<String8>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<String8> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::VSTR16: {
-                    load_column<String16>(
+            _csv2_type_dispatch_<StlVecType>(
+                col_spec.type_spec,
+                [this, &col_spec](auto tag) -> void  {
+                    using vec_t = typename decltype(tag)::type;
+
+                    this->template load_column<typename vec_t::value_type>(
                         col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<String16> &>
-                            (col_spec.col_vec)),
+                        std::move(std::any_cast<vec_t &>(col_spec.col_vec)),
                         nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::VSTR32: {
-                    load_column<String32>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<String32> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::VSTR64: {
-                    load_column<String64>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<String64> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::VSTR128: {
-                    load_column<String128>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<String128> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::VSTR512: {
-                    load_column<String512>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<String512> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::VSTR1K: {
-                    load_column<String1K>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<String1K> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::VSTR2K: {
-                    load_column<String2K>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<String2K> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::DATETIME:
-                case file_dtypes::DATETIME_AME:
-                case file_dtypes::DATETIME_EUR:
-                case file_dtypes::DATETIME_ISO: {
-                    load_column<DateTime>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<DateTime> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::STR_DBL_PAIR: {
-                    using val_t = std::pair<std::string, double>;
-
-                    load_column<val_t>(col_spec.col_name.c_str(),
-                                       std::move(std::any_cast<
-                                           StlVecType<val_t> &>
-                                               (col_spec.col_vec)),
-                                       nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::STR_STR_PAIR: {
-                    using val_t = std::pair<std::string, std::string>;
-
-                    load_column<val_t>(col_spec.col_name.c_str(),
-                                       std::move(std::any_cast<
-                                           StlVecType<val_t> &>
-                                               (col_spec.col_vec)),
-                                       nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::DBL_DBL_PAIR: {
-                    using val_t = std::pair<double, double>;
-
-                    load_column<val_t>(col_spec.col_name.c_str(),
-                                       std::move(std::any_cast<
-                                           StlVecType<val_t> &>
-                                               (col_spec.col_vec)),
-                                       nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::DBL_VEC: {
-                    load_column<std::vector<double>>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<
-                            std::vector<double>> &>(col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::STR_VEC: {
-                    load_column<std::vector<std::string>>(
-                        col_spec.col_name.c_str(),
-                        std::move(
-                            std::any_cast<StlVecType<
-                                std::vector<std::string>> &>
-                                    (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::DBL_SET: {
-                    using set_t = std::set<double>;
-
-                    load_column<set_t>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<set_t> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::STR_SET: {
-                    using set_t = std::set<std::string>;
-
-                    load_column<set_t>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<set_t> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::STR_DBL_MAP: {
-                    using map_t = std::map<std::string, double>;
-
-                    load_column<map_t>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<map_t> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-                case file_dtypes::STR_DBL_UNOMAP: {
-                    using map_t = std::unordered_map<std::string, double>;
-
-                    load_column<map_t>(
-                        col_spec.col_name.c_str(),
-                        std::move(std::any_cast<StlVecType<map_t> &>
-                            (col_spec.col_vec)),
-                        nan_policy::dont_pad_with_nans);
-                    break;
-                }
-            }
+                });
         }
     }
 }
@@ -2484,362 +2139,541 @@ read_binary_(S &stream,
 
         stream.read(col_type, sizeof(col_type));
 
-        IndexVecType    idx_vec;
-
-        if constexpr (std::is_same_v<IndexType, std::string>)
-            _read_binary_string_<std::string>(stream, idx_vec, needs_flipping,
-                                              starting_row, num_rows);
-        else if constexpr (std::is_same_v<IndexType, String8>)
-            _read_binary_string_<String8>(stream, idx_vec, needs_flipping,
-                                          starting_row, num_rows);
-        else if constexpr (std::is_same_v<IndexType, String16>)
-            _read_binary_string_<String16>(stream, idx_vec, needs_flipping,
-                                           starting_row, num_rows);
-        else if constexpr (std::is_same_v<IndexType, String32>)
-            _read_binary_string_<String32>(stream, idx_vec, needs_flipping,
-                                           starting_row, num_rows);
-        else if constexpr (std::is_same_v<IndexType, String64>)
-            _read_binary_string_<String64>(stream, idx_vec, needs_flipping,
-                                           starting_row, num_rows);
-        else if constexpr (std::is_same_v<IndexType, String128>)
-            _read_binary_string_<String128>(stream, idx_vec, needs_flipping,
-                                            starting_row, num_rows);
-        else if constexpr (std::is_same_v<IndexType, String512>)
-            _read_binary_string_<String512>(stream, idx_vec, needs_flipping,
-                                            starting_row, num_rows);
-        else if constexpr (std::is_same_v<IndexType, String1K>)
-            _read_binary_string_<String1K>(stream, idx_vec, needs_flipping,
-                                           starting_row, num_rows);
-        else if constexpr (std::is_same_v<IndexType, String2K>)
-            _read_binary_string_<String2K>(stream, idx_vec, needs_flipping,
-                                           starting_row, num_rows);
-        else if constexpr (std::is_same_v<IndexType, DateTime>)
-            _read_binary_datetime_(stream, idx_vec, needs_flipping,
-                                   starting_row, num_rows);
-        else
-            _read_binary_data_(stream, idx_vec, needs_flipping,
-                               starting_row, num_rows);
-        load_index(std::move(idx_vec));
+        read_binary_index_(stream, needs_flipping, starting_row, num_rows);
     }
 
     for (uint16_t i = 0; i < col_num; ++i)  {
         stream.read(col_name, sizeof(col_name));
         stream.read(col_type, sizeof(col_type));
 
-        const auto  citer = _typename_id_.find(col_type);
+        read_binary_column_(stream,
+                            col_name,
+                            col_type,
+                            needs_flipping,
+                            starting_row,
+                            num_rows);
+    }
+}
 
-        if (citer == _typename_id_.end())  {
-            String1K    err;
+// ----------------------------------------------------------------------------
 
-            err.printf("read_binary_(): ERROR: Type '%s' is not supported",
-                       col_type);
-            throw DataFrameError(err.c_str());
-        }
+template<typename I, typename H>
+template<typename S>
+void DataFrame<I, H>::
+read_binary_index_(S &stream,
+                   bool needs_flipping,
+                   size_type starting_row,
+                   size_type num_rows)  {
 
-        switch(citer->second)  {
-            case file_dtypes::FLOAT: {
-                ColumnVecType<float>    vec;
+    IndexVecType    idx_vec;
 
-                _read_binary_data_(stream, vec, needs_flipping,
+    if constexpr (std::is_same_v<IndexType, std::string>)
+        _read_binary_string_<std::string>(stream, idx_vec, needs_flipping,
+                                          starting_row, num_rows);
+    else if constexpr (std::is_same_v<IndexType, String8>)
+        _read_binary_string_<String8>(stream, idx_vec, needs_flipping,
+                                      starting_row, num_rows);
+    else if constexpr (std::is_same_v<IndexType, String16>)
+        _read_binary_string_<String16>(stream, idx_vec, needs_flipping,
+                                       starting_row, num_rows);
+    else if constexpr (std::is_same_v<IndexType, String32>)
+        _read_binary_string_<String32>(stream, idx_vec, needs_flipping,
+                                       starting_row, num_rows);
+    else if constexpr (std::is_same_v<IndexType, String64>)
+        _read_binary_string_<String64>(stream, idx_vec, needs_flipping,
+                                       starting_row, num_rows);
+    else if constexpr (std::is_same_v<IndexType, String128>)
+        _read_binary_string_<String128>(stream, idx_vec, needs_flipping,
+                                        starting_row, num_rows);
+    else if constexpr (std::is_same_v<IndexType, String512>)
+        _read_binary_string_<String512>(stream, idx_vec, needs_flipping,
+                                        starting_row, num_rows);
+    else if constexpr (std::is_same_v<IndexType, String1K>)
+        _read_binary_string_<String1K>(stream, idx_vec, needs_flipping,
+                                       starting_row, num_rows);
+    else if constexpr (std::is_same_v<IndexType, String2K>)
+        _read_binary_string_<String2K>(stream, idx_vec, needs_flipping,
+                                       starting_row, num_rows);
+    else if constexpr (std::is_same_v<IndexType, DateTime>)
+        _read_binary_datetime_(stream, idx_vec, needs_flipping,
                                starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::DOUBLE: {
-                ColumnVecType<double>   vec;
+    else
+        _read_binary_data_(stream, idx_vec, needs_flipping,
+                           starting_row, num_rows);
+    load_index(std::move(idx_vec));
+}
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::SHORT: {
-                ColumnVecType<short int>    vec;
+// ----------------------------------------------------------------------------
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::USHORT: {
-                ColumnVecType<unsigned short int>   vec;
+template<typename I, typename H>
+template<typename S>
+void DataFrame<I, H>::
+read_binary_column_(S &stream,
+                    const char *col_name,
+                    const char *col_type,
+                    bool needs_flipping,
+                    size_type starting_row,
+                    size_type num_rows)  {
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::INT: {
-                ColumnVecType<int>  vec;
+    const auto  citer = _typename_id_.find(col_type);
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::UINT: {
-                ColumnVecType<unsigned int> vec;
+    if (citer == _typename_id_.end())  {
+        String1K    err;
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::LONG: {
-                ColumnVecType<long int> vec;
+        err.printf("read_binary_(): ERROR: Type '%s' is not supported",
+                   col_type);
+        throw DataFrameError(err.c_str());
+    }
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::ULONG: {
-                ColumnVecType<unsigned long int>    vec;
+    switch(citer->second)  {
+        case file_dtypes::FLOAT: {
+            ColumnVecType<float>    vec;
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::LONG_LONG: {
-                ColumnVecType<long long int>    vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                           starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::DOUBLE: {
+            ColumnVecType<double>   vec;
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::ULONG_LONG: {
-                ColumnVecType<unsigned long long int>   vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::SHORT: {
+            ColumnVecType<short int>    vec;
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::CHAR: {
-                ColumnVecType<char> vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::USHORT: {
+            ColumnVecType<unsigned short int>   vec;
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::UCHAR: {
-                ColumnVecType<unsigned char>    vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::INT: {
+            ColumnVecType<int>  vec;
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::BOOL: {
-                ColumnVecType<bool> vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::UINT: {
+            ColumnVecType<unsigned int> vec;
 
-                _read_binary_data_(stream, vec, needs_flipping,
-                                   starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::STRING: {
-                ColumnVecType<std::string>  vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::LONG: {
+            ColumnVecType<long int> vec;
 
-                _read_binary_string_<std::string>(stream, vec, needs_flipping,
-                                                  starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::VSTR8: {
-                ColumnVecType<String8>  vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::ULONG: {
+            ColumnVecType<unsigned long int>    vec;
 
-                _read_binary_string_<String8>(stream, vec, needs_flipping,
-                                              starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::VSTR16: {
-                ColumnVecType<String16> vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::LONG_LONG: {
+            ColumnVecType<long long int>    vec;
 
-                _read_binary_string_<String16>(stream, vec, needs_flipping,
-                                               starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::VSTR32: {
-                ColumnVecType<String32> vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::ULONG_LONG: {
+            ColumnVecType<unsigned long long int>   vec;
 
-                _read_binary_string_<String32>(stream, vec, needs_flipping,
-                                               starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::VSTR64: {
-                ColumnVecType<String64> vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::CHAR: {
+            ColumnVecType<char> vec;
 
-                _read_binary_string_<String64>(stream, vec, needs_flipping,
-                                               starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::VSTR128: {
-                ColumnVecType<String128>    vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::UCHAR: {
+            ColumnVecType<unsigned char>    vec;
 
-                _read_binary_string_<String128>(stream, vec, needs_flipping,
-                                               starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::VSTR512: {
-                ColumnVecType<String512>    vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::BOOL: {
+            ColumnVecType<bool> vec;
 
-                _read_binary_string_<String512>(stream, vec, needs_flipping,
-                                               starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::VSTR1K: {
-                ColumnVecType<String1K> vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::STRING: {
+            ColumnVecType<std::string>  vec;
 
-                _read_binary_string_<String1K>(stream, vec, needs_flipping,
-                                               starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::VSTR2K: {
-                ColumnVecType<String2K> vec;
+            _read_binary_string_<std::string>(stream, vec, needs_flipping,
+                                              starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::VSTR8: {
+            ColumnVecType<String8>  vec;
 
-                _read_binary_string_<String2K>(stream, vec, needs_flipping,
-                                               starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::DATETIME: {
-                ColumnVecType<DateTime> vec;
+            _read_binary_string_<String8>(stream, vec, needs_flipping,
+                                          starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::VSTR16: {
+            ColumnVecType<String16> vec;
 
-                _read_binary_datetime_(stream, vec, needs_flipping,
-                                       starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::STR_DBL_PAIR: {
-                using val_t = std::pair<std::string, double>;
+            _read_binary_string_<String16>(stream, vec, needs_flipping,
+                                           starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::VSTR32: {
+            ColumnVecType<String32> vec;
 
-                ColumnVecType<val_t>    vec;
+            _read_binary_string_<String32>(stream, vec, needs_flipping,
+                                           starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::VSTR64: {
+            ColumnVecType<String64> vec;
 
-                _read_binary_str_dbl_pair_(stream, vec, needs_flipping,
+            _read_binary_string_<String64>(stream, vec, needs_flipping,
                                            starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::STR_STR_PAIR: {
-                using val_t = std::pair<std::string, std::string>;
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::VSTR128: {
+            ColumnVecType<String128>    vec;
 
-                ColumnVecType<val_t>    vec;
+            _read_binary_string_<String128>(stream, vec, needs_flipping,
+                                           starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::VSTR512: {
+            ColumnVecType<String512>    vec;
 
-                _read_binary_str_str_pair_(stream, vec, needs_flipping,
+            _read_binary_string_<String512>(stream, vec, needs_flipping,
                                            starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::DBL_DBL_PAIR: {
-                using val_t = std::pair<double, double>;
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::VSTR1K: {
+            ColumnVecType<String1K> vec;
 
-                ColumnVecType<val_t>    vec;
+            _read_binary_string_<String1K>(stream, vec, needs_flipping,
+                                           starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::VSTR2K: {
+            ColumnVecType<String2K> vec;
 
-                _read_binary_dbl_dbl_pair_(stream, vec, needs_flipping,
+            _read_binary_string_<String2K>(stream, vec, needs_flipping,
                                            starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::DBL_VEC: {
-                ColumnVecType<std::vector<double>>  vec;
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::DATETIME: {
+            ColumnVecType<DateTime> vec;
 
-                _read_binary_dbl_vec_(stream, vec, needs_flipping,
-                                      starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::STR_VEC: {
-                ColumnVecType<std::vector<std::string>> vec;
+            _read_binary_datetime_(stream, vec, needs_flipping,
+                                   starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::TIMESTAMP: {
+            ColumnVecType<Timestamp>    vec;
 
-                _read_binary_str_vec_(stream, vec, needs_flipping,
-                                      starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::DBL_SET: {
-                ColumnVecType<std::set<double>> vec;
+            _read_binary_data_(stream, vec, needs_flipping,
+                               starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::STR_DBL_PAIR: {
+            using val_t = std::pair<std::string, double>;
+
+            ColumnVecType<val_t>    vec;
 
-                _read_binary_dbl_set_(stream, vec, needs_flipping,
+            _read_binary_str_dbl_pair_(stream, vec, needs_flipping,
+                                       starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::STR_STR_PAIR: {
+            using val_t = std::pair<std::string, std::string>;
+
+            ColumnVecType<val_t>    vec;
+
+            _read_binary_str_str_pair_(stream, vec, needs_flipping,
+                                       starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::DBL_DBL_PAIR: {
+            using val_t = std::pair<double, double>;
+
+            ColumnVecType<val_t>    vec;
+
+            _read_binary_dbl_dbl_pair_(stream, vec, needs_flipping,
+                                       starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::DBL_VEC: {
+            ColumnVecType<std::vector<double>>  vec;
+
+            _read_binary_dbl_vec_(stream, vec, needs_flipping,
+                                  starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::STR_VEC: {
+            ColumnVecType<std::vector<std::string>> vec;
+
+            _read_binary_str_vec_(stream, vec, needs_flipping,
+                                  starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::DBL_SET: {
+            ColumnVecType<std::set<double>> vec;
+
+            _read_binary_dbl_set_(stream, vec, needs_flipping,
+                                  starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::STR_SET: {
+            ColumnVecType<std::set<std::string>>    vec;
+
+            _read_binary_str_set_(stream, vec, needs_flipping,
+                                  starting_row, num_rows);
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::STR_DBL_MAP: {
+            ColumnVecType<std::map<std::string, double>>    vec;
+
+            _read_binary_str_dbl_map_(stream, vec, needs_flipping,
                                       starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::STR_SET: {
-                ColumnVecType<std::set<std::string>>    vec;
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        case file_dtypes::STR_DBL_UNOMAP: {
+            ColumnVecType<std::unordered_map<std::string, double>>  vec;
 
-                _read_binary_str_set_(stream, vec, needs_flipping,
+            _read_binary_str_dbl_map_(stream, vec, needs_flipping,
                                       starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::STR_DBL_MAP: {
-                ColumnVecType<std::map<std::string, double>>    vec;
+            load_column(col_name, std::move(vec),
+                        nan_policy::dont_pad_with_nans);
+            break;
+        }
+        default:  {
+            String1K    err;
 
-                _read_binary_str_dbl_map_(stream, vec, needs_flipping,
-                                          starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            case file_dtypes::STR_DBL_UNOMAP: {
-                ColumnVecType<std::unordered_map<std::string, double>>  vec;
+            err.printf("read_binary_(): ERROR: Type '%s' is not supported",
+                       col_type);
+            throw DataFrameError(err.c_str());
+        }
+    }
+}
 
-                _read_binary_str_dbl_map_(stream, vec, needs_flipping,
-                                          starting_row, num_rows);
-                load_column(col_name, std::move(vec),
-                            nan_policy::dont_pad_with_nans);
-                break;
-            }
-            default:  {
-                String1K    err;
+// ----------------------------------------------------------------------------
 
-                err.printf("read_binary_(): ERROR: Type '%s' is not supported",
-                           col_type);
-                throw DataFrameError(err.c_str());
-            }
+template<typename I, typename H>
+void DataFrame<I, H>::
+read_mmap_binary_(const char *file_name, const ReadParams &params)  {
+
+    auto        mapped = std::make_shared<MappedColumns_>(file_name);
+    const char  *data = mapped->mmap.data;
+    const auto  file_size = mapped->mmap.size;
+    auto        throw_bad_file =
+        [file_name](const char *what) -> void  {
+            String1K    err;
+
+            err.printf("DataFrame::read_mmap_binary_(): ERROR: '%s' %s",
+                       file_name, what);
+            throw DataFrameError(err.c_str());
+        };
+
+    if (file_size < sizeof(_mmap_binary_header_) +
+                    sizeof(_mmap_binary_trailer_)) [[unlikely]]
+        throw_bad_file("is not a mmap_binary file");
+
+    _mmap_binary_header_    header;
+    _mmap_binary_trailer_   trailer;
+
+    std::memcpy(&header, data, sizeof(header));
+    std::memcpy(&trailer,
+                data + (file_size - sizeof(trailer)),
+                sizeof(trailer));
+    if (std::memcmp(header.magic, _mmap_binary_magic_, sizeof(header.magic))
+        || std::memcmp(trailer.magic,
+                       _mmap_binary_magic_,
+                       sizeof(trailer.magic))) [[unlikely]]
+        throw_bad_file("is not a mmap_binary file");
+
+    const bool                          needs_flipping =
+        header.endian != get_system_endian();
+    const SwapBytes<uint64_t, sizeof(uint64_t)> swaper { };
+    const SwapBytes<uint32_t, sizeof(uint32_t)> swaper32 { };
+
+    if (needs_flipping)  {
+        header.version = swaper32(header.version);
+        trailer.dir_size = swaper(trailer.dir_size);
+        trailer.dir_offset = swaper(trailer.dir_offset);
+    }
+    if (header.version > _mmap_binary_version_) [[unlikely]]
+        throw_bad_file("has an unsupported format version");
+    if (trailer.dir_offset > file_size - sizeof(trailer) ||
+        trailer.dir_size >
+            (file_size - sizeof(trailer) - trailer.dir_offset) /
+                sizeof(_mmap_binary_dir_entry_)) [[unlikely]]
+        throw_bad_file("has a corrupted column directory");
+
+    mapped->needs_flipping = needs_flipping;
+    mapped->starting_row = params.starting_row;
+    mapped->num_rows = params.num_rows;
+    for (uint64_t i = 0; i < trailer.dir_size; ++i)  {
+        _mmap_binary_dir_entry_ entry;
+
+        std::memcpy(&entry,
+                    data + (trailer.dir_offset + i * sizeof(entry)),
+                    sizeof(entry));
+        if (needs_flipping)  {
+            entry.offset = swaper(entry.offset);
+            entry.length = swaper(entry.length);
+        }
+        if (entry.offset > trailer.dir_offset ||
+            entry.length < MAX_COL_NAME_SIZE + sizeof(entry.col_type) ||
+            entry.length > trailer.dir_offset - entry.offset) [[unlikely]]
+            throw_bad_file("has a corrupted column directory");
+
+        const bool  is_index = ! std::strcmp(entry.col_name, DF_INDEX_COL_NAME);
+
+        if (i == 0 && ! is_index && ! params.columns_only) [[unlikely]]  {
+            String1K    err;
+
+            err.printf("DataFrame::read_mmap_binary_(): ERROR: "
+                       "Expecting name '%s'",
+                       DF_INDEX_COL_NAME);
+            throw DataFrameError(err.c_str());
         }
+        if (is_index && params.columns_only)  continue;
+
+        // The stream starts after the column name and type
+        //
+        const size_type rec_skip =
+            MAX_COL_NAME_SIZE + sizeof(entry.col_type);
+        MemStreamBuf    buf (data + (entry.offset + rec_skip),
+                             entry.length - rec_skip);
+        std::istream    stream (&buf);
+
+        if (is_index)
+            read_binary_index_(stream,
+                               needs_flipping,
+                               params.starting_row,
+                               params.num_rows);
+        else if (params.lazy_load)
+            mapped->columns.emplace(
+                entry.col_name,
+                typename MappedColumns_::Entry {
+                    entry.col_type, entry.offset, entry.length });
+        else
+            read_binary_column_(stream,
+                                entry.col_name,
+                                entry.col_type,
+                                needs_flipping,
+                                params.starting_row,
+                                params.num_rows);
     }
+    if (params.lazy_load)  mapped_cols_ = std::move(mapped);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+void DataFrame<I, H>::load_mapped_column_(const char *col_name)  {
+
+    const auto      iter = mapped_cols_->columns.find(col_name);
+    const auto      entry = iter->second;
+    const size_type rec_skip =
+        MAX_COL_NAME_SIZE + sizeof(_mmap_binary_dir_entry_::col_type);
+    MemStreamBuf    buf (mapped_cols_->mmap.data + (entry.offset + rec_skip),
+                         entry.length - rec_skip);
+    std::istream    stream (&buf);
+
+    read_binary_column_(stream,
+                        col_name,
+                        entry.type_name.c_str(),
+                        mapped_cols_->needs_flipping,
+                        mapped_cols_->starting_row,
+                        mapped_cols_->num_rows);
+
+    // Once it is loaded, it is a regular column
+    //
+    mapped_cols_->columns.erase(iter);
 }
 
 // ----------------------------------------------------------------------------
@@ -2851,7 +2685,13 @@ read(const char *file_name, io_format iof, const ReadParams params)  {
     static_assert(std::is_base_of<HeteroVector<align_value>, DataVec>::value,
                   "Only a StdDataFrame can call read()");
 
-    if (iof == io_format::csv2)  {
+    if (iof == io_format::csv2 && params.chunk_size > 0)  {
+        read_csv2_mmap_(file_name, params);
+    }
+    else if (iof == io_format::mmap_binary)  {
+        read_mmap_binary_(file_name, params);
+    }
+    else if (iof == io_format::csv2)  {
         IOFileOpti  io_opti(file_name);
 
         read_csv2_(io_opti.file,
@@ -2913,6 +2753,9 @@ read(S &in_s, io_format iof, const ReadParams params)  {
                      params.starting_row,
                      params.num_rows);
     }
+    else if (iof == io_format::mmap_binary)
+        throw NotImplemented("read(): io_format::mmap_binary can only be "
+                             "read from a file");
     else
         throw NotImplemented("read(): This io_format is not implemented");
 
@@ -699,10 +699,6 @@ remove_duplicates (const char *name,
                    bool include_index,
                    remove_dup_spec rds) const  {
 
-    using data_tuple = std::tuple<const T &, const IndexType &>;
-    using count_vec = StlVecType<size_type>;
-    using map_t = DFUnorderedMap<data_tuple, count_vec, TupleHash>;
-
     const ColumnVecType<T>  *vec { nullptr };
     const auto              &index = get_index();
 
@@ -714,23 +710,11 @@ remove_duplicates (const char *name,
         vec = (const ColumnVecType<T> *) &(get_column<T>(name));
 
     const size_type col_s = std::min(vec->size(), index.size());
-    map_t           row_table;
-    count_vec       dummy_vec;
-    const IndexType dummy_idx { };
-
-    row_table.reserve(col_s);
-    for (size_type i = 0; i < col_s; ++i) [[likely]]  {
-        const auto  insert_res =
-            row_table.emplace(
-                std::forward_as_tuple((*vec)[i],
-                                      include_index ? index[i] : dummy_idx),
-                dummy_vec);
-
-        if (insert_res.second)  insert_res.first->second.reserve(8);
-        insert_res.first->second.push_back(i);
-    }
+    const auto      row_groups =
+        dup_row_groups_(col_s, include_index, index, *vec);
 
-    return(remove_dups_common_<map_t, Ts ...>(*this, rds, row_table, index));
+    return (remove_dups_common_<Ts ...>(*this, rds, row_groups,
+                                        index.size()));
 }
 
 // ----------------------------------------------------------------------------
@@ -743,10 +727,6 @@ remove_duplicates (const char *name1,
                    bool include_index,
                    remove_dup_spec rds) const  {
 
-    using data_tuple = std::tuple<const T1 &, const T2 &, const IndexType &>;
-    using count_vec = StlVecType<size_type>;
-    using map_t = DFUnorderedMap<data_tuple, count_vec, TupleHash>;
-
     SpinGuard               guard (lock_);
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
@@ -756,24 +736,11 @@ remove_duplicates (const char *name1,
     const auto      &index = get_index();
     const size_type col_s =
         std::min<size_type>({ vec1.size(), vec2.size(), index.size() });
-    map_t           row_table;
-    count_vec       dummy_vec;
-    const IndexType dummy_idx { };
-
-    row_table.reserve(col_s);
-    for (size_type i = 0; i < col_s; ++i) [[likely]]  {
-        const auto  insert_res =
-            row_table.emplace(
-                std::forward_as_tuple(vec1[i], vec2[i],
-                                      include_index ? index[i] : dummy_idx),
-                dummy_vec);
-
-        if (insert_res.second)
-            insert_res.first->second.reserve(8);
-        insert_res.first->second.push_back(i);
-    }
+    const auto      row_groups =
+        dup_row_groups_(col_s, include_index, index, vec1, vec2);
 
-    return(remove_dups_common_<map_t, Ts ...>(*this, rds, row_table, index));
+    return (remove_dups_common_<Ts ...>(*this, rds, row_groups,
+                                        index.size()));
 }
 
 // ----------------------------------------------------------------------------
@@ -788,11 +755,6 @@ remove_duplicates (const char *name1,
                    bool include_index,
                    remove_dup_spec rds) const  {
 
-    using data_tuple =
-        std::tuple<const T1 &, const T2 &, const T3 &, const IndexType &>;
-    using count_vec = StlVecType<size_type>;
-    using map_t = DFUnorderedMap<data_tuple, count_vec, TupleHash>;
-
     SpinGuard               guard (lock_);
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
@@ -804,24 +766,11 @@ remove_duplicates (const char *name1,
     const size_type col_s =
         std::min<size_type>(
             { vec1.size(), vec2.size(), vec3.size(), index.size() });
-    map_t           row_table;
-    count_vec       dummy_vec;
-    const IndexType dummy_idx { };
-
-    row_table.reserve(col_s);
-    for (size_type i = 0; i < col_s; ++i) [[likely]]  {
-        const auto  insert_res =
-            row_table.emplace(
-                std::forward_as_tuple(vec1[i], vec2[i], vec3[i],
-                                      include_index ? index[i] : dummy_idx),
-                dummy_vec);
-
-        if (insert_res.second)
-            insert_res.first->second.reserve(8);
-        insert_res.first->second.push_back(i);
-    }
+    const auto      row_groups =
+        dup_row_groups_(col_s, include_index, index, vec1, vec2, vec3);
 
-    return(remove_dups_common_<map_t, Ts ...>(*this, rds, row_table, index));
+    return (remove_dups_common_<Ts ...>(*this, rds, row_groups,
+                                        index.size()));
 }
 
 // ----------------------------------------------------------------------------
@@ -838,12 +787,6 @@ remove_duplicates (const char *name1,
                    bool include_index,
                    remove_dup_spec rds) const  {
 
-    using data_tuple = std::tuple<const T1 &, const T2 &,
-                                  const T3 &, const T4 &,
-                                  const IndexType &>;
-    using count_vec = StlVecType<size_type>;
-    using map_t = DFUnorderedMap<data_tuple, count_vec, TupleHash>;
-
     SpinGuard               guard (lock_);
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
@@ -857,24 +800,11 @@ remove_duplicates (const char *name1,
         std::min<size_type>(
             { vec1.size(), vec2.size(), vec3.size(), vec4.size(),
               index.size() });
-    map_t           row_table;
-    count_vec       dummy_vec;
-    const IndexType dummy_idx { };
-
-    row_table.reserve(col_s);
-    for (size_type i = 0; i < col_s; ++i) [[likely]]  {
-        const auto  insert_res =
-            row_table.emplace(
-                std::forward_as_tuple(vec1[i], vec2[i], vec3[i], vec4[i],
-                                      include_index ? index[i] : dummy_idx),
-                dummy_vec);
-
-        if (insert_res.second)
-            insert_res.first->second.reserve(8);
-        insert_res.first->second.push_back(i);
-    }
+    const auto      row_groups =
+        dup_row_groups_(col_s, include_index, index, vec1, vec2, vec3, vec4);
 
-    return(remove_dups_common_<map_t, Ts ...>(*this, rds, row_table, index));
+    return (remove_dups_common_<Ts ...>(*this, rds, row_groups,
+                                        index.size()));
 }
 
 // ----------------------------------------------------------------------------
@@ -892,12 +822,6 @@ remove_duplicates (const char *name1,
                    bool include_index,
                    remove_dup_spec rds) const  {
 
-    using data_tuple = std::tuple<const T1 &, const T2 &,
-                                  const T3 &, const T4 &, const T5 &,
-                                  const IndexType &>;
-    using count_vec = StlVecType<size_type>;
-    using map_t = DFUnorderedMap<data_tuple, count_vec, TupleHash>;
-
     SpinGuard               guard (lock_);
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
@@ -912,25 +836,12 @@ remove_duplicates (const char *name1,
         std::min<size_type>(
             { vec1.size(), vec2.size(), vec3.size(), vec4.size(), vec5.size(),
               index.size() });
-    map_t           row_table;
-    count_vec       dummy_vec;
-    const IndexType dummy_idx { };
-
-    row_table.reserve(col_s);
-    for (size_type i = 0; i < col_s; ++i) [[likely]]  {
-        const auto  insert_res =
-            row_table.emplace(
-                std::forward_as_tuple(vec1[i], vec2[i], vec3[i],
-                                      vec4[i], vec5[i],
-                                      include_index ? index[i] : dummy_idx),
-                dummy_vec);
-
-        if (insert_res.second)
-            insert_res.first->second.reserve(8);
-        insert_res.first->second.push_back(i);
-    }
+    const auto      row_groups =
+        dup_row_groups_(col_s, include_index, index,
+                        vec1, vec2, vec3, vec4, vec5);
 
-    return(remove_dups_common_<map_t, Ts ...>(*this, rds, row_table, index));
+    return (remove_dups_common_<Ts ...>(*this, rds, row_groups,
+                                        index.size()));
 }
 
 // ----------------------------------------------------------------------------
@@ -949,13 +860,6 @@ remove_duplicates (const char *name1,
                    bool include_index,
                    remove_dup_spec rds) const  {
 
-    using data_tuple = std::tuple<const T1 &, const T2 &,
-                                  const T3 &, const T4 &,
-                                  const T5 &, const T6 &,
-                                  const IndexType &>;
-    using count_vec = StlVecType<size_type>;
-    using map_t = DFUnorderedMap<data_tuple, count_vec, TupleHash>;
-
     SpinGuard               guard (lock_);
     const ColumnVecType<T1> &vec1 = get_column<T1>(name1, false);
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
@@ -972,25 +876,12 @@ remove_duplicates (const char *name1,
             { vec1.size(), vec2.size(), vec3.size(), vec4.size(),
               vec5.size(), vec6.size(),
               index.size() });
-    map_t           row_table;
-    count_vec       dummy_vec;
-    const IndexType dummy_idx { };
-
-    row_table.reserve(col_s);
-    for (size_type i = 0; i < col_s; ++i) [[likely]]  {
-        const auto  insert_res =
-            row_table.emplace(
-                std::forward_as_tuple(vec1[i], vec2[i], vec3[i],
-                                      vec4[i], vec5[i], vec6[i],
-                                      include_index ? index[i] : dummy_idx),
-                dummy_vec);
-
-        if (insert_res.second)
-            insert_res.first->second.reserve(8);
-        insert_res.first->second.push_back(i);
-    }
+    const auto      row_groups =
+        dup_row_groups_(col_s, include_index, index,
+                        vec1, vec2, vec3, vec4, vec5, vec6);
 
-    return(remove_dups_common_<map_t, Ts ...>(*this, rds, row_table, index));
+    return (remove_dups_common_<Ts ...>(*this, rds, row_groups,
+                                        index.size()));
 }
 
 } // namespace hmdf
@@ -308,6 +308,89 @@ gen_datetime_index(const char *start_datetime,
         throw NotFeasible ("ERROR: gen_datetime_index()");
     }
 
+    // Hourly and finer steps have a fixed length. So, every timestamp can
+    // be computed from its position, and big indices are filled in
+    // parallel. DateTime conversions don't share any state, so this is safe.
+    //
+    using LongTimeType = DateTime::LongTimeType;
+
+    const LongTimeType  step_secs =
+        t_freq == time_frequency::hourly
+            ? increment * 60 * 60
+            : t_freq == time_frequency::minutely
+                ? increment * 60
+                : t_freq == time_frequency::secondly ? increment : 0;
+    const LongTimeType  step_ns =
+        t_freq == time_frequency::millisecondly
+            ? LongTimeType(increment) * 1000000LL
+            : step_secs * 1000000000LL;
+
+    if (step_ns > 0 && start_di < end_di)  {
+        const size_type count =
+            size_type((end_di.long_time() - start_di.long_time() +
+                       step_ns - 1) / step_ns);
+        const auto      thread_level =
+            (count < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+
+        if (thread_level > 2)  {
+            const LongTimeType  start_time = start_di.time();
+            const LongTimeType  start_ns = start_di.long_time();
+            auto                lbd =
+                [&index_vec, &start_di = std::as_const(start_di),
+                 step_secs, step_ns, start_time, start_ns]
+                (auto begin, auto end) -> void  {
+                    for (auto i = begin; i < end; ++i)  {
+                        const LongTimeType  secs =
+                            start_time + LongTimeType(i) * step_secs;
+                        const LongTimeType  nanos =
+                            start_ns + LongTimeType(i) * step_ns;
+
+                        if constexpr (std::is_same_v<IndexType, DateTime>)  {
+                            DateTime    &dt = index_vec[i];
+
+                            dt = start_di;
+                            if (step_secs > 0)
+                                dt.set_time(DateTime::EpochType(secs),
+                                            start_di.nanosec());
+                            else
+                                dt.set_time(
+                                    DateTime::EpochType(nanos / 1000000000LL),
+                                    DateTime::NanosecondType(
+                                        nanos % 1000000000LL));
+                        }
+                        else if constexpr (std::is_same_v<IndexType,
+                                                          Timestamp>)  {
+                            index_vec[i] = Timestamp(nanos);
+                        }
+                        else  {
+                            index_vec[i] =
+                                static_cast<IndexType>(
+                                    step_secs > 0 ? secs : nanos);
+                        }
+                    }
+                };
+
+            index_vec.resize(count);
+
+            auto    futures =
+                thr_pool_.parallel_loop<IndexType>(size_type(0), count,
+                                                   std::move(lbd));
+
+            for (auto &fut : futures)  fut.get();
+            return (index_vec);
+        }
+        else if constexpr (std::is_same_v<IndexType, Timestamp>)  {
+            // Timestamps are nanoseconds since epoch. So, fixed steps are
+            // plain additions without going through DateTime
+            //
+            const LongTimeType  start_ns = start_di.long_time();
+
+            for (size_type i = 0; i < count; ++i)
+                index_vec.emplace_back(start_ns + LongTimeType(i) * step_ns);
+            return (index_vec);
+        }
+    }
+
     const GenerateTSIndex_<IndexType>   slug;
 
     slug(index_vec, start_di, end_di, t_freq, increment);
@@ -336,6 +419,108 @@ gen_sequence_index (const IndexType &start_value,
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+typename DataFrame<I, H>::template ColumnVecType<DateTime>
+DataFrame<I, H>::
+parse_datetime_column(std::span<const std::string_view> strs,
+                      DT_DATE_STYLE ds,
+                      DT_TIME_ZONE tz)  {
+
+    const size_type         col_s = strs.size();
+    ColumnVecType<DateTime> result(col_s, DateTime(19700101, 0, 0, 0, 0, tz));
+    const auto              thread_level =
+        (col_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+
+    if (thread_level > 2)  {
+        auto    futures =
+            thr_pool_.parallel_loop<DateTime>(
+                size_type(0),
+                col_s,
+                [strs, &result, ds, tz]
+                (auto begin, auto end) -> void  {
+                    DateTime::parse_range(
+                        strs.subspan(begin, end - begin),
+                        std::span<DateTime>(result.data() + begin,
+                                            end - begin),
+                        ds, tz);
+                });
+
+        for (auto &fut : futures)  fut.get();
+    }
+    else  {
+        DateTime::parse_range(strs, std::span<DateTime>(result), ds, tz);
+    }
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+void
+DataFrame<I, H>::
+format_datetime_column(std::span<const DateTime> dts,
+                       DT_FORMAT format,
+                       std::string &buffer,
+                       StlVecType<size_type> &offsets)  {
+
+    const size_type col_s = dts.size();
+    const auto      thread_level =
+        (col_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
+
+    buffer.clear();
+    offsets.resize(col_s + 1);
+    offsets[0] = 0;
+    if (thread_level > 2)  {
+
+        // Each thread formats its chunk into its own buffer. Then they are
+        // concatenated in order and offsets are shifted.
+        //
+        using chunk_t = std::pair<size_type, std::string>;
+
+        auto    futures =
+            thr_pool_.parallel_loop<DateTime>(
+                size_type(0),
+                col_s,
+                [dts, &offsets, format]
+                (auto begin, auto end) -> chunk_t  {
+                    std::string buf;
+
+                    DateTime::format_range(
+                        dts.subspan(begin, end - begin),
+                        format,
+                        buf,
+                        std::span<size_type>(offsets.data() + begin + 1,
+                                             end - begin));
+                    return (chunk_t(begin, std::move(buf)));
+                });
+        std::vector<chunk_t>    chunks;
+
+        chunks.reserve(futures.size());
+        for (auto &fut : futures)  chunks.push_back(fut.get());
+
+        size_type   total { 0 };
+
+        for (const auto &[begin, buf] : chunks)  total += buf.size();
+        buffer.reserve(total);
+        for (size_type c = 0; c < chunks.size(); ++c)  {
+            const size_type shift = buffer.size();
+            const size_type end =
+                c + 1 < chunks.size() ? chunks[c + 1].first : col_s;
+
+            buffer += chunks[c].second;
+            for (size_type i = chunks[c].first; i < end; ++i)
+                offsets[i + 1] += shift;
+        }
+    }
+    else  {
+        DateTime::format_range(dts, format, buffer,
+                               std::span<size_type>(offsets.data() + 1,
+                                                    col_s));
+    }
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename ITR>
 typename DataFrame<I, H>::size_type
@@ -715,6 +900,25 @@ load_column (const char *name,
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<column_expression E>
+typename DataFrame<I, H>::size_type
+DataFrame<I, H>::
+load_column (const char *name,
+             const E &expr,
+             nan_policy padding,
+             bool do_lock)  {
+
+    using value_t = typename E::value_type;
+
+    return (load_column<value_t>(name,
+                                 eval_expr_for(expr, *this),
+                                 padding,
+                                 do_lock));
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename T, typename ITR>
 typename DataFrame<I, H>::size_type
@@ -105,72 +105,15 @@ get_data_by_idx(const StlVecType<IndexType> &values) const  {
 
     static_assert(hashable<I>, "Index type must be hash-able");
 
-    using res_t = DataFrame<I, HeteroVector<std::size_t(H::align_value)>>;
-
     const DFUnorderedSet<IndexType> val_table (values.begin(), values.end());
-    typename res_t::IndexVecType    new_index;
-    StlVecType<size_type>           locations;
-    const size_type                 values_s = values.size();
     const size_type                 idx_s = indices_.size();
+    const StlVecType<size_type>     locations =
+        sel_indices_(idx_s,
+                     [&val_table, this](size_type i) -> bool  {
+                         return (val_table.contains(this->indices_[i]));
+                     });
 
-    new_index.reserve(values_s);
-    locations.reserve(values_s);
-    for (size_type i = 0; i < idx_s; ++i)
-        if (val_table.contains(indices_[i]))  {
-            new_index.push_back(indices_[i]);
-            locations.push_back(i);
-        }
-
-    res_t   df;
-
-    df.load_index(std::move(new_index));
-
-    const SpinGuard guard(lock_);
-
-    for (const auto &[name, idx] : column_list_) [[likely]]  {
-        create_col_functor_<res_t, Ts ...>  functor(name.c_str(), df);
-
-        data_[idx].change(functor);
-    }
-
-    const auto  thread_level =
-        (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
-
-    if (thread_level > 2)  {
-        auto    lbd =
-            [&locations = std::as_const(locations), idx_s, &df, this]
-            (const auto &begin, const auto &end) -> void  {
-                for (auto citer = begin; citer < end; ++citer)  {
-                    sel_load_functor_<res_t, size_type, Ts ...> functor(
-                        citer->first.c_str(),
-                        locations,
-                        idx_s,
-                        df);
-
-                    this->data_[citer->second].change(functor);
-                }
-            };
-
-        auto    futuers =
-            thr_pool_.parallel_loop<double>(column_list_.begin(),
-                                            column_list_.end(),
-                                            std::move(lbd));
-
-        for (auto &fut : futuers)  fut.get();
-    }
-    else  {
-        for (const auto &[name, idx] : column_list_) [[likely]]  {
-            sel_load_functor_<res_t, size_type, Ts ...> functor(
-                name.c_str(),
-                locations,
-                idx_s,
-                df);
-
-            data_[idx].change(functor);
-        }
-    }
-
-    return (df);
+    return (data_by_sel_common_<Ts ...>(locations, idx_s));
 }
 
 // ----------------------------------------------------------------------------
@@ -689,10 +632,11 @@ std::same_as<std::invoke_result_t<F, const IndexType &, const T &>, bool>  {
     const size_type         col_s { vec.size() };
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i { 0 }; i < col_s; ++i)
-        if (sel_functor(indices_[i], vec[i]))
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec[i]));
+                     });
 
     return (data_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -711,10 +655,11 @@ std::same_as<std::invoke_result_t<F, const IndexType &, const T &>, bool>  {
     const size_type         col_s { vec.size() };
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i { 0 }; i < col_s; ++i) [[likely]]
-        if (sel_functor (indices_[i], vec[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec[i]));
+                     });
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
@@ -733,16 +678,56 @@ std::same_as<std::invoke_result_t<F, const IndexType &, const T &>, bool>  {
     const size_type         col_s { vec.size() };
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i { 0 }; i < col_s; ++i) [[likely]]
-        if (sel_functor (indices_[i], vec[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec[i]));
+                     });
 
     return (view_by_sel_common_<Ts ...>(col_indices, idx_s));
 }
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<comparable T, typename ... Ts>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
+get_data_by_sel (const char *name, compare_op op, const T &value) const  {
+
+    const ColumnVecType<T>  &vec { get_column<T>(name) };
+
+    return (data_by_sel_common_<Ts ...>(cmp_sel_indices_(vec, op, value),
+                                        indices_.size()));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<comparable T, typename ... Ts>
+typename DataFrame<I, H>::PtrView DataFrame<I, H>::
+get_view_by_sel (const char *name, compare_op op, const T &value)  {
+
+    const ColumnVecType<T>  &vec { get_column<T>(name) };
+
+    return (view_by_sel_common_<Ts ...>(cmp_sel_indices_(vec, op, value),
+                                        indices_.size()));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<comparable T, typename ... Ts>
+typename DataFrame<I, H>::ConstPtrView DataFrame<I, H>::
+get_view_by_sel (const char *name, compare_op op, const T &value) const  {
+
+    const ColumnVecType<T>  &vec { get_column<T>(name) };
+
+    return (view_by_sel_common_<Ts ...>(cmp_sel_indices_(vec, op, value),
+                                        indices_.size()));
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename T1, typename T2, typename F, typename ... Ts>
 DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
@@ -761,10 +746,11 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
     const size_type         min_col_s = std::min(col_s1, col_s2);
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor (indices_[i],
                          i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -794,10 +780,11 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
     const size_type         min_col_s = std::min(col_s1, col_s2);
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor (indices_[i],
                          i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -828,10 +815,11 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
     const size_type         min_col_s = std::min(col_s1, col_s2);
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor (indices_[i],
                          i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -866,10 +854,12 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
     const size_type         min_col_s = std::min({ col_s1, col_s2, col_s3 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i], vec3[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor (indices_[i],
                          i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1096,10 +1086,12 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
     const size_type         min_col_s = std::min({ col_s1, col_s2, col_s3 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i], vec3[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor (indices_[i],
                          i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1136,10 +1128,12 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
     const size_type         min_col_s = std::min({ col_s1, col_s2, col_s3 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i], vec1[i], vec2[i], vec3[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor (indices_[i],
                          i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1181,11 +1175,12 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
         std::min({ col_s1, col_s2, col_s3, col_s4 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i], vec4[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1228,11 +1223,12 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
         std::min({ col_s1, col_s2, col_s3, col_s4 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i], vec4[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1276,11 +1272,12 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
         std::min({ col_s1, col_s2, col_s3, col_s4 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i], vec4[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1328,12 +1325,12 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
         std::min({ col_s1, col_s2, col_s3, col_s4, col_s5 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i],
-                        vec4[i], vec5[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i], vec4[i], vec5[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1397,13 +1394,14 @@ get_data_by_sel(const char *name1,
                    col_s11 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i) [[likely]]
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i],
-                        vec6[i], vec7[i], vec8[i], vec9[i], vec10[i],
-                        vec11[i])) [[unlikely]]
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i], vec4[i], vec5[i],
+                                             vec6[i], vec7[i], vec8[i],
+                                             vec9[i], vec10[i], vec11[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i) [[likely]]
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1476,13 +1474,15 @@ get_data_by_sel(const char *name1,
                    col_s11, col_s12 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i],
-                        vec6[i], vec7[i], vec8[i], vec9[i], vec10[i],
-                        vec11[i], vec12[i]))
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i], vec4[i], vec5[i],
+                                             vec6[i], vec7[i], vec8[i],
+                                             vec9[i], vec10[i], vec11[i],
+                                             vec12[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i)
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1559,13 +1559,15 @@ get_data_by_sel(const char *name1,
                    col_s11, col_s12, col_s13 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i],
-                        vec6[i], vec7[i], vec8[i], vec9[i], vec10[i],
-                        vec11[i], vec12[i], vec13[i]))
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i], vec4[i], vec5[i],
+                                             vec6[i], vec7[i], vec8[i],
+                                             vec9[i], vec10[i], vec11[i],
+                                             vec12[i], vec13[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i)
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1622,11 +1624,12 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
         std::min({ col_s1, col_s2, col_s3, col_s4, col_s5 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i]))
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i], vec4[i], vec5[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i)
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1676,11 +1679,12 @@ std::same_as<std::invoke_result_t<F, const IndexType &,
         std::min({ col_s1, col_s2, col_s3, col_s4, col_s5 });
     StlVecType<size_type>   col_indices;
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i]))
-            col_indices.push_back(i);
+    col_indices =
+        sel_indices_(min_col_s,
+                     [&](size_type i) -> bool  {
+                         return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                             vec3[i], vec4[i], vec5[i]));
+                     });
     for (size_type i = min_col_s; i < idx_s; ++i)
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -3545,15 +3549,16 @@ get_view_by_mshift(const char *col_name,
 
 template<typename I, typename H>
 template<typename ... Ts>
-DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
 DataFrame<I, H>::
 get_data_at_times(DateTime::HourType hr,
                   DateTime::MinuteType mn,
                   DateTime::SecondType sc,
                   DateTime::MillisecondType msc) const  {
 
-    static_assert(std::is_base_of<DateTime, I>::value,
-                  "Index type must be DateTime to call get_data_at_time()");
+    static_assert(DateTime_or_Timestamp<I>,
+                  "Index type must be DateTime or Timestamp to call "
+                  "get_data_at_time()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3578,8 +3583,9 @@ get_view_at_times(DateTime::HourType hr,
                   DateTime::SecondType sc,
                   DateTime::MillisecondType msc)  {
 
-    static_assert(std::is_base_of<DateTime, I>::value,
-                  "Index type must be DateTime to call get_view_at_times()");
+    static_assert(DateTime_or_Timestamp<I>,
+                  "Index type must be DateTime or Timestamp to call "
+                  "get_view_at_times()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3604,8 +3610,9 @@ get_view_at_times(DateTime::HourType hr,
                   DateTime::SecondType sc,
                   DateTime::MillisecondType msc) const  {
 
-    static_assert(std::is_base_of<DateTime, I>::value,
-                  "Index type must be DateTime to call get_view_at_times()");
+    static_assert(DateTime_or_Timestamp<I>,
+                  "Index type must be DateTime or Timestamp to call "
+                  "get_view_at_times()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3670,7 +3677,7 @@ _DT_after_times_(DateTime::HourType b_hr,
 
 template<typename I, typename H>
 template<typename ... Ts>
-DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
 DataFrame<I, H>::
 get_data_before_times(DateTime::HourType hr,
                       DateTime::MinuteType mn,
@@ -3678,8 +3685,9 @@ get_data_before_times(DateTime::HourType hr,
                       DateTime::MillisecondType msc) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_data_before_time()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_data_before_time()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3707,8 +3715,9 @@ get_view_before_times(DateTime::HourType hr,
                       DateTime::MillisecondType msc)  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_before_times()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_before_times()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3736,8 +3745,9 @@ get_view_before_times(DateTime::HourType hr,
                       DateTime::MillisecondType msc) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_before_times()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_before_times()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3758,7 +3768,7 @@ get_view_before_times(DateTime::HourType hr,
 
 template<typename I, typename H>
 template<typename ... Ts>
-DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
 DataFrame<I, H>::
 get_data_after_times(DateTime::HourType hr,
                      DateTime::MinuteType mn,
@@ -3766,8 +3776,9 @@ get_data_after_times(DateTime::HourType hr,
                      DateTime::MillisecondType msc) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_data_after_time()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_data_after_time()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3795,8 +3806,9 @@ get_view_after_times(DateTime::HourType hr,
                      DateTime::MillisecondType msc)  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_after_times()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_after_times()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3824,8 +3836,9 @@ get_view_after_times(DateTime::HourType hr,
                      DateTime::MillisecondType msc) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_after_times()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_after_times()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3846,7 +3859,7 @@ get_view_after_times(DateTime::HourType hr,
 
 template<typename I, typename H>
 template<typename ... Ts>
-DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
 DataFrame<I, H>::
 get_data_between_times(DateTime::HourType start_hr,
                        DateTime::HourType end_hr,
@@ -3859,8 +3872,9 @@ get_data_between_times(DateTime::HourType start_hr,
                        inclusiveness incld) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_data_between_time()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_data_between_time()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3913,8 +3927,9 @@ get_view_between_times(DateTime::HourType start_hr,
                        inclusiveness incld)  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_between_times()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_between_times()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -3967,8 +3982,9 @@ get_view_between_times(DateTime::HourType start_hr,
                        inclusiveness incld) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_between_times()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_between_times()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -4009,13 +4025,14 @@ get_view_between_times(DateTime::HourType start_hr,
 
 template<typename I, typename H>
 template<typename ... Ts>
-DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
 DataFrame<I, H>::
 get_data_on_days(const std::vector<DT_WEEKDAY> &days) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_data_on_days()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_data_on_days()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -4037,8 +4054,9 @@ DataFrame<I, H>::
 get_view_on_days(const std::vector<DT_WEEKDAY> &days)  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_on_days()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_on_days()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -4061,8 +4079,9 @@ DataFrame<I, H>::
 get_view_on_days(const std::vector<DT_WEEKDAY> &days) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_on_days()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_on_days()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -4079,14 +4098,15 @@ get_view_on_days(const std::vector<DT_WEEKDAY> &days) const  {
 
 template<typename I, typename H>
 template<typename ... Ts>
-DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
 DataFrame<I, H>::
 get_data_on_days_in_month(
     const std::vector<DateTime::DatePartType> &days) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_data_on_days_in_month()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_data_on_days_in_month()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -4109,8 +4129,9 @@ get_view_on_days_in_month(
     const std::vector<DateTime::DatePartType> &days)  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_on_days_in_month()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_on_days_in_month()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -4132,8 +4153,9 @@ get_view_on_days_in_month(
     const std::vector<DateTime::DatePartType> &days) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_on_days_in_month()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_on_days_in_month()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -4150,13 +4172,14 @@ get_view_on_days_in_month(
 
 template<typename I, typename H>
 template<typename ... Ts>
-DataFrame<DateTime, HeteroVector<std::size_t(H::align_value)>>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
 DataFrame<I, H>::
 get_data_in_months(const std::vector<DT_MONTH> &months) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_data_in_months()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_data_in_months()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -4178,8 +4201,9 @@ DataFrame<I, H>::
 get_view_in_months(const std::vector<DT_MONTH> &months)  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_in_months()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_in_months()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
@@ -4200,8 +4224,9 @@ DataFrame<I, H>::
 get_view_in_months(const std::vector<DT_MONTH> &months) const  {
 
     static_assert(
-        std::is_base_of<DateTime, I>::value,
-        "Index type must be DateTime to call get_view_in_months()");
+        DateTime_or_Timestamp<I>,
+        "Index type must be DateTime or Timestamp to call "
+        "get_view_in_months()");
 
     const size_type         idx_s = indices_.size();
     StlVecType<size_type>   col_indices;
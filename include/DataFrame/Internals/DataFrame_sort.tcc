@@ -56,6 +56,13 @@ permutation_vec(const char *name, sort_spec dir) const  {
     const auto              thread_level =
         (col_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
 
+    if constexpr (radix_sortable<T>)  {
+        if (col_s >= ThreadPool::MUL_THR_THHOLD)  {
+            radix_sort_perm_<T>(*vec, dir, result);
+            return (result);
+        }
+    }
+
     std::iota(result.begin(), result.end(), 0);
     if (dir == sort_spec::ascen)  {
         auto    a =
@@ -155,7 +162,10 @@ sort(const char *name, sort_spec dir, bool ignore_index)  {
     const auto  thread_level =
         (idx_s < ThreadPool::MUL_THR_THHOLD) ? 0L : get_thread_level();
 
-    if (dir == sort_spec::ascen)  {
+    if (radix_sort_col_<T>(*vec, dir, ignore_index, sorting_idxs))  {
+        // Numeric and DateTime keys of big columns are radix sorted
+    }
+    else if (dir == sort_spec::ascen)  {
         if (thread_level > 2)  {
             if (! ignore_index)
                 thr_pool_.parallel_sort(zip_idx.begin(), zip_idx.end(), a);
@@ -212,29 +222,7 @@ sort(const char *name, sort_spec dir, bool ignore_index)  {
         }
     }
 
-    if (((column_list_.size() - 1) > 1) && get_thread_level() > 2)  {
-        auto    lbd = [name,
-                       &sorting_idxs = std::as_const(sorting_idxs),
-                       idx_s, this]
-                      (const auto &begin, const auto &end) -> void  {
-            sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-            for (auto citer = begin; citer < end; ++citer)
-                if (citer->first != name)
-                    this->data_[citer->second].change(functor);
-        };
-        auto    futures =
-            thr_pool_.parallel_loop<double>(
-                column_list_.begin(), column_list_.end(), std::move(lbd));
-
-        for (auto &fut : futures)  fut.get();
-    }
-    else  {
-        sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-        for (const auto &[this_name, idx] : column_list_) [[likely]]
-            if (this_name != name)  data_[idx].change(functor);
-    }
+    permute_columns_<Ts ...>(sorting_idxs, { name });
     return;
 }
 
@@ -603,30 +591,7 @@ sort(const char *name1, sort_spec dir1,
         }
     }
 
-    if (((column_list_.size() - 2) > 1) && get_thread_level() > 2)  {
-        auto    lbd = [name1, name2,
-                       &sorting_idxs = std::as_const(sorting_idxs),
-                       idx_s, this]
-                      (const auto &begin, const auto &end) -> void  {
-            sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-            for (auto citer = begin; citer < end; ++citer)
-                if (citer->first != name1 && citer->first != name2)
-                    this->data_[citer->second].change(functor);
-        };
-        auto    futures =
-            thr_pool_.parallel_loop<double>(
-                column_list_.begin(), column_list_.end(), std::move(lbd));
-
-        for (auto &fut : futures)  fut.get();
-    }
-    else  {
-        sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-        for (const auto &[name, idx] : column_list_) [[likely]]
-            if (name != name1 && name != name2)
-                data_[idx].change(functor);
-    }
+    permute_columns_<Ts ...>(sorting_idxs, { name1, name2 });
     return;
 }
 
@@ -1018,34 +983,7 @@ sort(const char *name1, sort_spec dir1,
             std::ranges::sort(zip, cf);
     }
 
-    if (((column_list_.size() - 3) > 1) && get_thread_level() > 2)  {
-        auto    lbd = [name1, name2, name3,
-                       &sorting_idxs = std::as_const(sorting_idxs),
-                       idx_s, this]
-                      (const auto &begin, const auto &end) -> void  {
-            sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-            for (auto citer = begin; citer < end; ++citer)
-                if (citer->first != name1 &&
-                    citer->first != name2 &&
-                    citer->first != name3)
-                    this->data_[citer->second].change(functor);
-        };
-        auto    futures =
-            thr_pool_.parallel_loop<double>(
-                column_list_.begin(), column_list_.end(), std::move(lbd));
-
-        for (auto &fut : futures)  fut.get();
-    }
-    else  {
-        sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-        for (const auto &citer : column_list_) [[likely]]
-            if (citer.first != name1 &&
-                citer.first != name2 &&
-                citer.first != name3)
-                data_[citer.second].change(functor);
-    }
+    permute_columns_<Ts ...>(sorting_idxs, { name1, name2, name3 });
     return;
 }
 
@@ -1326,36 +1264,7 @@ sort(const char *name1, sort_spec dir1,
             std::ranges::sort(zip, cf);
     }
 
-    if (((column_list_.size() - 4) > 1) && get_thread_level() > 2)  {
-        auto    lbd = [name1, name2, name3, name4,
-                       &sorting_idxs = std::as_const(sorting_idxs),
-                       idx_s, this]
-                      (const auto &begin, const auto &end) -> void  {
-            sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-            for (auto citer = begin; citer < end; ++citer)
-                if (citer->first != name1 &&
-                    citer->first != name2 &&
-                    citer->first != name3 &&
-                    citer->first != name4)
-                    this->data_[citer->second].change(functor);
-        };
-        auto    futures =
-            thr_pool_.parallel_loop<double>(
-                column_list_.begin(), column_list_.end(), std::move(lbd));
-
-        for (auto &fut : futures)  fut.get();
-    }
-    else  {
-        sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-        for (const auto &citer : column_list_) [[likely]]
-            if (citer.first != name1 &&
-                citer.first != name2 &&
-                citer.first != name3 &&
-                citer.first != name4)
-                data_[citer.second].change(functor);
-    }
+    permute_columns_<Ts ...>(sorting_idxs, { name1, name2, name3, name4 });
     return;
 }
 
@@ -1559,38 +1468,8 @@ sort(const char *name1, sort_spec dir1,
             std::ranges::sort(zip, cf);
     }
 
-    if (((column_list_.size() - 5) > 1) && get_thread_level() > 2)  {
-        auto    lbd = [name1, name2, name3, name4, name5,
-                       &sorting_idxs = std::as_const(sorting_idxs),
-                       idx_s, this]
-                      (const auto &begin, const auto &end) -> void  {
-            sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-            for (auto citer = begin; citer < end; ++citer)
-                if (citer->first != name1 &&
-                    citer->first != name2 &&
-                    citer->first != name3 &&
-                    citer->first != name4 &&
-                    citer->first != name5)
-                    this->data_[citer->second].change(functor);
-        };
-        auto    futures =
-            thr_pool_.parallel_loop<double>(
-                column_list_.begin(), column_list_.end(), std::move(lbd));
-
-        for (auto &fut : futures)  fut.get();
-    }
-    else  {
-        sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-        for (const auto &citer : column_list_) [[likely]]
-            if (citer.first != name1 &&
-                citer.first != name2 &&
-                citer.first != name3 &&
-                citer.first != name4 &&
-                citer.first != name5)
-                data_[citer.second].change(functor);
-    }
+    permute_columns_<Ts ...>(sorting_idxs,
+                             { name1, name2, name3, name4, name5 });
     return;
 }
 
@@ -1855,29 +1734,7 @@ sort_freq(const char *name, sort_spec dir, bool ignore_index)  {
         }
     }
 
-    if ((column_list_.size() > 3) && get_thread_level() > 2)  {
-        auto    lbd = [name,
-                       &sorting_idxs = std::as_const(sorting_idxs),
-                       idx_s, this]
-                      (const auto &begin, const auto &end) -> void  {
-            sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-            for (auto citer = begin; citer < end; ++citer)
-                if (citer->first != name)
-                    this->data_[citer->second].change(functor);
-        };
-        auto    futures =
-            thr_pool_.parallel_loop<double>(
-                column_list_.begin(), column_list_.end(), std::move(lbd));
-
-        for (auto &fut : futures)  fut.get();
-    }
-    else  {
-        sort_functor_<Ts ...>   functor (sorting_idxs, idx_s);
-
-        for (const auto &[this_name, idx] : column_list_) [[likely]]
-            if (this_name != name)  data_[idx].change(functor);
-    }
+    permute_columns_<Ts ...>(sorting_idxs, { name });
 
     return;
 }
@@ -37,6 +37,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Utils/Threads/ThreadGranularity.h>
 
 #include <cctype>
+#include <charconv>
 #include <cstdlib>
 #include <cstring>
 #include <future>
@@ -46,6 +47,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ranges>
 #include <set>
 #include <sstream>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -122,6 +124,7 @@ std::unordered_map<_TypeInfoRef_,
     // DateTime
     //
     { typeid(DateTime), "DateTime" },
+    { typeid(Timestamp), "Timestamp" },
 
     // Pairs
     //
@@ -181,6 +184,7 @@ std::unordered_map<std::string, file_dtypes>    _typename_id_  {
     { "DateTimeAME", file_dtypes::DATETIME_AME },
     { "DateTimeEUR", file_dtypes::DATETIME_EUR },
     { "DateTimeISO", file_dtypes::DATETIME_ISO },
+    { "Timestamp", file_dtypes::TIMESTAMP },
 
     // Pairs
     //
@@ -1119,48 +1123,102 @@ _load_bucket_data_(const DF &source,
 
 // ----------------------------------------------------------------------------
 
-template<typename S, typename T>
-inline static S &_write_json_df_index_(S &o, const T &value)  {
-
-    return (o << value);
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename S>
-inline static S &_write_json_df_index_(S &o, const DateTime &value)  {
-
-    return (o << value.time() << '.' << value.nanosec());
-}
+// It appends value to out exactly as "ss << value" would. plain tells
+// whether ss has default flags and the classic locale. If so, integral and
+// floating-point values are converted with std::to_chars, which is many
+// times faster than going through a stream. Everything else goes through ss,
+// which the caller reuses across calls.
+//
+template<typename T>
+inline static void
+_append_text_value_(std::string &out,
+                    const T &value,
+                    std::ostringstream &ss,
+                    bool plain)  {
+
+    constexpr bool  is_char =
+        std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+        std::is_same_v<T, unsigned char> || std::is_same_v<T, wchar_t> ||
+        std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> ||
+        std::is_same_v<T, char32_t>;
+
+    if constexpr (std::is_same_v<T, bool>)  {
+        if (plain)  {
+            out += value ? '1' : '0';
+            return;
+        }
+    }
+    else if constexpr (std::is_floating_point_v<T> ||
+                       (std::is_integral_v<T> && ! is_char))  {
+        if (plain)  {
+            char                    buffer[128];
+            std::to_chars_result    res;
 
-// ----------------------------------------------------------------------------
+            if constexpr (std::is_floating_point_v<T>)  {
+                // Streams use the default precision for negative values
+                //
+                const std::streamsize   prec = ss.precision();
 
-template<typename S>
-inline static S &_write_json_df_index_(S &o, const std::string &value)  {
+                res = std::to_chars(buffer, buffer + sizeof(buffer), value,
+                                    std::chars_format::general,
+                                    prec < 0 ? 6 : int(prec));
+            }
+            else
+                res = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            if (res.ec == std::errc { }) [[likely]]  {
+                out.append(buffer, res.ptr);
+                return;
+            }
+        }
+    }
+    else if constexpr (std::is_convertible_v<const T &, std::string_view>)  {
+        out += std::string_view(value);
+        return;
+    }
 
-    return (o << '"' << value << '"');
+    ss.str(std::string { });
+    ss << value;
+    out += ss.view();
 }
 
 // ----------------------------------------------------------------------------
 
-template<typename S>
-inline static S &_write_json_df_index_(S &o, char value)  {
-
-    if (std::isprint(value))
-        return (o << value);
-    else
-        return (o << static_cast<int>(value));
-}
-
-// ----------------------------------------------------------------------------
+// These append one value to out the same way it is written into the "D"
+// array of a json file
+//
+template<typename T>
+inline static void
+_append_json_cell_(std::string &out,
+                   const T &value,
+                   std::ostringstream &ss,
+                   bool plain)  {
 
-template<typename S>
-inline static S &_write_json_df_index_(S &o, unsigned char value)  {
+    if constexpr (std::is_same_v<T, DateTime>)  {
+        char    buffer[DateTime::FORMAT_BUF_SIZE];
 
-    if (std::isprint(value))
-        return (o << value);
+        out.append(buffer, value.format_to(buffer, DT_FORMAT::DT_PRECISE));
+    }
+    // Timestamps are always written as their raw epoch nanoseconds
+    //
+    else if constexpr (std::is_same_v<T, Timestamp>)
+        _append_text_value_(out, value.long_time(), ss, plain);
+    else if constexpr (std::is_same_v<T, std::string>)  {
+        out += '"';
+        out += value;
+        out += '"';
+    }
+    else if constexpr (std::is_same_v<T, char>)  {
+        if (std::isprint(value))  out += value;
+        else  _append_text_value_(out, static_cast<int>(value), ss, plain);
+    }
+    else if constexpr (std::is_same_v<T, unsigned char>)  {
+        if (std::isprint(value))  out += static_cast<char>(value);
+        else
+            _append_text_value_(out, static_cast<unsigned int>(value),
+                                ss, plain);
+    }
     else
-        return (o << static_cast<unsigned int>(value));
+        _append_text_value_(out, value, ss, plain);
 }
 
 // ----------------------------------------------------------------------------
@@ -1531,6 +1589,40 @@ _write_json_df_header_(S &o, const char *col_name, std::size_t col_size)  {
 
 // ----------------------------------------------------------------------------
 
+// These append one value to out the same way it is written into a csv2
+// file
+//
+template<typename T>
+inline static void
+_append_csv2_cell_(std::string &out,
+                   const T &value,
+                   DT_FORMAT dt_format,
+                   std::ostringstream &ss,
+                   bool plain)  {
+
+    if constexpr (std::is_same_v<T, DateTime>)  {
+        char    buffer[DateTime::FORMAT_BUF_SIZE];
+
+        out.append(buffer, value.format_to(buffer, dt_format));
+    }
+    else if constexpr (std::is_same_v<T, Timestamp>)
+        _append_text_value_(out, value.long_time(), ss, plain);
+    else if constexpr (std::is_same_v<T, char>)  {
+        if (std::isprint(value))  out += value;
+        else  _append_text_value_(out, static_cast<int>(value), ss, plain);
+    }
+    else if constexpr (std::is_same_v<T, unsigned char>)  {
+        if (std::isprint(value))  out += static_cast<char>(value);
+        else
+            _append_text_value_(out, static_cast<unsigned int>(value),
+                                ss, plain);
+    }
+    else
+        _append_text_value_(out, value, ss, plain);
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename S, typename T>
 inline static S &_write_csv_df_index_(S &o, const T &value)  {
 
@@ -1543,10 +1635,18 @@ template<typename S>
 inline static S &
 _write_csv_df_index_(S &o, const DateTime &value, DT_FORMAT format)  {
 
-    String128   buffer;
+    char                buffer[DateTime::FORMAT_BUF_SIZE];
+    const std::size_t   len = value.format_to(buffer, format);
+
+    return (o << std::string_view(buffer, len));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename S>
+inline static S &_write_csv_df_index_(S &o, const Timestamp &value)  {
 
-    value.date_to_str(format, buffer);
-    return (o << buffer);
+    return (o << value.long_time());
 }
 
 // ----------------------------------------------------------------------------
@@ -1573,6 +1673,55 @@ inline static S &_write_csv_df_index_(S &o, unsigned char value)  {
 
 // ----------------------------------------------------------------------------
 
+// Layout of io_format::mmap_binary files:
+//
+//   Header:         Magic, format version and endianness of the writer
+//   Column records: Each record is a column exactly as io_format::binary
+//                   writes it (name, type, size and data). Records are
+//                   padded in front, so their data starts at a
+//                   _mmap_binary_align_ boundary
+//   Directory:      One _mmap_binary_dir_entry_ per column record
+//   Trailer:        Number of directory entries, directory offset and magic
+//
+inline static constexpr std::size_t _mmap_binary_align_ { 64 };
+inline static constexpr uint32_t    _mmap_binary_version_ { 1 };
+inline static constexpr char        _mmap_binary_magic_[8] = "HMDFMMB";
+
+// Column name, type name and number of rows come before the column data
+//
+inline static constexpr std::size_t _mmap_binary_rec_hdr_size_ {
+    MAX_COL_NAME_SIZE + 32 + sizeof(uint64_t) };
+
+struct  _mmap_binary_header_  {
+
+    char        magic[8];
+    uint32_t    version;
+    endians     endian;
+    char        reserved[_mmap_binary_align_ - 13];
+};
+
+struct  _mmap_binary_dir_entry_  {
+
+    char        col_name[MAX_COL_NAME_SIZE];
+    char        col_type[32];
+    uint64_t    offset;    // Of the column record from the start of file
+    uint64_t    length;    // Of the column record in bytes
+    uint64_t    num_rows;
+    uint64_t    reserved;
+};
+
+struct  _mmap_binary_trailer_  {
+
+    uint64_t    dir_size;  // Number of directory entries
+    uint64_t    dir_offset;
+    char        magic[8];
+};
+
+static_assert(sizeof(_mmap_binary_header_) == _mmap_binary_align_);
+static_assert(sizeof(_mmap_binary_dir_entry_) == 128);
+
+// ----------------------------------------------------------------------------
+
 template<typename STRM, typename V>
 inline static void
 _write_binary_common_(STRM &strm, [[maybe_unused]] const V &vec,
@@ -2908,6 +3057,63 @@ static inline T _atoi_(const char *str, int len)  {
 
 // ----------------------------------------------------------------------------
 
+// It parses an arithmetic value out of a token without allocating or
+// requiring a null terminator. Leading white spaces and a leading '+' are
+// skipped. Like strtod/strtol, a malformed token yields 0. Integers that
+// from_chars rejects (e.g. a negative value into an unsigned type) fall back
+// to _atoi_
+//
+template<typename T>
+static inline T _from_chars_(std::string_view token)  {
+
+    while (! token.empty() && ::isspace(token.front()))
+        token.remove_prefix(1);
+    if (! token.empty() && token.front() == '+')  token.remove_prefix(1);
+
+    const char  *first = token.data();
+    const char  *last = first + token.size();
+    T           value { 0 };
+
+    if constexpr (std::is_floating_point_v<T>)  {
+        std::from_chars(first, last, value);
+    }
+    else  {
+        if (std::from_chars(first, last, value).ec != std::errc { })
+        [[unlikely]]
+            if (! token.empty())
+                value = _atoi_<T>(first, int(token.size()));
+    }
+    return (value);
+}
+
+// ----------------------------------------------------------------------------
+
+// It parses a DateTime written as <epoch seconds>.<nanoseconds>
+//
+static inline DateTime _get_dt_from_epoch_value_(std::string_view token)  {
+
+    const std::size_t   dot = token.find('.');
+    DateTime            dt { DateTime::DateType(19700101) };  // Not now()
+
+    if (dot == std::string_view::npos)
+        dt.set_time(_from_chars_<time_t>(token), 0);
+    else
+        dt.set_time(_from_chars_<time_t>(token.substr(0, dot)),
+                    _from_chars_<int>(token.substr(dot + 1)));
+    return (dt);
+}
+
+// ----------------------------------------------------------------------------
+
+// It parses a Timestamp written as integer epoch nanoseconds
+//
+static inline Timestamp _get_ts_from_epoch_value_(std::string_view token)  {
+
+    return (Timestamp(_from_chars_<Timestamp::LongTimeType>(token)));
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename V, typename N>
 static inline std::pair<N, N>
 _get_inclusive_indices_(const V &vec, N begin, N end, inclusiveness incld)  {
@@ -27,6 +27,9 @@ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <array>
+#include <chrono>
+#include <cstring>
 #include <future>
 #include <ranges>
 #include <tuple>
@@ -87,26 +90,201 @@ apply(const char *col_name1, const char *col_name2, const char *col_name3,
 
 // ----------------------------------------------------------------------------
 
+// Feeds visitor rows [begin, end), padding with NaN's past the end of column
+//
+template<typename T, typename V, typename IV, typename CV>
+static inline void
+_visit_block_(V &visitor,
+              const IV &indices,
+              const CV &column,
+              std::size_t begin,
+              std::size_t end)  {
+
+    const std::size_t   min_e =
+        std::min(end, std::max<std::size_t>(column.size(), begin));
+    std::size_t         i = begin;
+
+    // The copy tells the compiler that visitor's state doesn't alias the
+    // value
+    //
+    for (; i < min_e; ++i)  {
+        const T val = column[i];
+
+        visitor (indices[i], val);
+    }
+    if (i < end)  {
+        const T nan_val = get_nan<T>();
+
+        for (; i < end; ++i)
+            visitor (indices[i], nan_val);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// Splits rows [0, n) into fixed size chunks. Each chunk is fed, by
+// feed(part, begin, end), to its own copy of visitor on the thread pool.
+// Then the copies are reduced into visitor in chunk order (See
+// reduce_visitor concept). The result only depends on n, not on the number
+// of threads.
+//
+template<typename V, typename F>
+static inline void
+_reduce_visit_(V &visitor, std::size_t n, F &&feed)  {
+
+    constexpr std::size_t   chunk_s = 1 << 16;
+
+    const std::size_t   chunk_cnt = (n + chunk_s - 1) / chunk_s;
+    std::vector<V>      parts (chunk_cnt, visitor);
+    auto                futures =
+        ThreadGranularity::thr_pool_.parallel_loop<std::size_t>(
+            std::size_t(0), chunk_cnt,
+            [&parts, &feed, n](std::size_t begin, std::size_t end) -> void  {
+                for (std::size_t c = begin; c < end; ++c)  {
+                    parts[c].pre();
+                    feed(parts[c],
+                         c * chunk_s, std::min(n, (c + 1) * chunk_s));
+                }
+            });
+
+    for (auto &fut : futures)  {
+        while (fut.wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::timeout)
+            ThreadGranularity::thr_pool_.run_task();
+        fut.get();
+    }
+
+    visitor.pre();
+    for (const auto &part : parts)
+        visitor.reduce(part);
+    visitor.post();
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename ... Ts>
 void DataFrame<I, H>::multi_visit (Ts ... args)  {
 
-    auto    args_tuple = std::tuple<Ts ...>(args ...);
-    auto    fc = [this](auto &pa) mutable -> void {
-        auto &functor = *(pa.second);
+    constexpr size_type visit_cnt = sizeof...(Ts);
 
+    // Number of rows each visitor is fed before moving to the next visitor.
+    // It keeps a block of every visited column in cache, while all the
+    // visitors on that column go through it.
+    //
+    constexpr size_type block_s = 4096;
+
+    auto            args_tuple = std::tuple<Ts ...>(args ...);
+    const size_type idx_s = indices_.size();
+    const auto      col_of = [this](auto &pa)  {
         using T =
             typename std::remove_reference<
-                decltype(functor)>::type::value_type;
-        using V =
-            typename std::remove_const<
-                typename std::remove_reference<decltype(functor)>::type>::type;
+                decltype(*(pa.second))>::type::value_type;
 
-        this->visit<T, V>(pa.first, functor);
+        return (&(this->get_column<T>(pa.first)));
+    };
+    const auto      columns = std::apply(
+        [&col_of](auto & ... pa)  {
+            return (std::make_tuple(col_of(pa) ...));
+        }, args_tuple);
+
+    // Visitors on the same column form a group
+    //
+    const std::array<const char *, visit_cnt>   names { args.first ... };
+    std::array<size_type, visit_cnt>            groups { };
+    size_type                                   group_cnt = 0;
+
+    for (size_type i = 0; i < visit_cnt; ++i)  {
+        groups[i] = group_cnt;
+        for (size_type j = 0; j < i; ++j)
+            if (! std::strcmp(names[i], names[j]))  {
+                groups[i] = groups[j];
+                break;
+            }
+        if (groups[i] == group_cnt)  group_cnt += 1;
+    }
+
+    // Applies func to every visitor in group g, or to all visitors if g is
+    // group_cnt
+    //
+    const auto  for_group =
+        [&args_tuple, &columns, &groups, group_cnt]
+        (size_type g, auto &&func) -> void  {
+            [&]<std::size_t ... Is>(std::index_sequence<Is ...>)  {
+                ((g == group_cnt || groups[Is] == g
+                      ? func(std::get<Is>(args_tuple),
+                             *std::get<Is>(columns))
+                      : void()), ...);
+            }(std::make_index_sequence<visit_cnt>());
+        };
+
+    // Visitors that would only buffer the column are given all of it at
+    // once and visitors that can reduce partial results run in parallel
+    // chunks, as visit() does
+    //
+    const auto  by_visit = [idx_s](const auto &visitor, const auto &vec)  {
+        using V = std::remove_cvref_t<decltype(visitor)>;
+
+        if constexpr (obo_port_visitor<V>)
+            if (vec.size() >= idx_s)  return (true);
+        if constexpr (reduce_visitor<V>)
+            if (idx_s >= ThreadPool::MUL_THR_THHOLD &&
+                get_thread_level() > 2 &&
+                visitor.can_reduce())
+                return (true);
+        return (false);
     };
 
-    for_each_in_tuple (args_tuple, fc);
-    return;
+    // It walks the rest of the group's columns once, block by block
+    //
+    const auto  visit_group =
+        [this, &for_group, &by_visit, idx_s](size_type g)  {
+            for_group(g, [this, &by_visit](auto &pa, auto &vec) -> void  {
+                auto    &visitor = *(pa.second);
+
+                using V =
+                    typename std::remove_reference<decltype(visitor)>::type;
+                using T = typename V::value_type;
+
+                if (by_visit(visitor, vec))
+                    this->visit<T, V>(pa.first, visitor);
+                else
+                    visitor.pre();
+            });
+            for (size_type b = 0; b < idx_s; b += block_s)  {
+                const size_type e = std::min(b + block_s, idx_s);
+
+                for_group(g, [this, &by_visit, b, e]
+                             (auto &pa, auto &vec) -> void  {
+                    auto    &visitor = *(pa.second);
+
+                    using T = typename std::remove_reference<
+                        decltype(visitor)>::type::value_type;
+
+                    if (! by_visit(visitor, vec))
+                        _visit_block_<T>(visitor, indices_, vec, b, e);
+                });
+            }
+            for_group(g, [&by_visit](auto &pa, auto &vec) -> void  {
+                auto    &visitor = *(pa.second);
+
+                if (! by_visit(visitor, vec))  visitor.post();
+            });
+        };
+
+    if (group_cnt > 1 &&
+        idx_s >= ThreadPool::MUL_THR_THHOLD &&
+        get_thread_level() > 2)  {
+        std::vector<std::future<void>>  futures;
+
+        futures.reserve(group_cnt);
+        for (size_type g = 0; g < group_cnt; ++g)
+            futures.push_back(thr_pool_.dispatch(false, visit_group, g));
+        for (auto &fut : futures)  fut.get();
+    }
+    else  {
+        visit_group(group_cnt);
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -126,6 +304,45 @@ V &DataFrame<I, H>::visit (const char *name, V &visitor, bool in_reverse)  {
 
     auto            &vec = get_column<T>(name);
     const size_type idx_s = indices_.size();
+
+    // A buffering visitor would copy the column one value at a time and
+    // then run its bulk operator() on the copy. Give it the column instead,
+    // unless the column is short and must be padded with NaN's
+    //
+    if constexpr (obo_port_visitor<V>)  {
+        if (vec.size() >= idx_s)  {
+            visitor.pre();
+            if (! in_reverse) [[likely]]
+                visitor (indices_.begin(), indices_.end(),
+                         vec.begin(), vec.begin() + idx_s);
+            else
+                visitor (indices_.rbegin(), indices_.rend(),
+                         std::make_reverse_iterator(vec.begin() + idx_s),
+                         vec.rend());
+            visitor.post();
+            return (visitor);
+        }
+    }
+
+    // A long column is visited in parallel chunks, if the visitor can
+    // combine its partial results
+    //
+    if constexpr (reduce_visitor<V>)  {
+        if (! in_reverse &&
+            idx_s >= ThreadPool::MUL_THR_THHOLD &&
+            get_thread_level() > 2 &&
+            visitor.can_reduce())  {
+            _reduce_visit_(visitor, idx_s,
+                           [this, &vec](V &part,
+                                        size_type begin,
+                                        size_type end) -> void  {
+                               _visit_block_<T>(part, indices_, vec,
+                                                begin, end);
+                           });
+            return (visitor);
+        }
+    }
+
     const size_type min_s = std::min<size_type>(vec.size(), idx_s);
     size_type       i = 0;
     T               nan_val = get_nan<T>();
@@ -219,6 +436,28 @@ visit (const char *name1, const char *name2, V &visitor, bool in_reverse)  {
     T1              nan_val1 = get_nan<T1>();
     T2              nan_val2 = get_nan<T2>();
 
+    if constexpr (reduce_visitor<V>)  {
+        if (! in_reverse &&
+            idx_s >= ThreadPool::MUL_THR_THHOLD &&
+            get_thread_level() > 2 &&
+            visitor.can_reduce())  {
+            _reduce_visit_(
+                visitor, idx_s,
+                [&](V &part, size_type begin, size_type end) -> void  {
+                    const size_type min_e = std::min(end, min_s);
+                    size_type       j = begin;
+
+                    for (; j < min_e; ++j)
+                        part (indices_[j], vec1[j], vec2[j]);
+                    for (; j < end; ++j)
+                        part (indices_[j],
+                              j < data_s1 ? vec1[j] : nan_val1,
+                              j < data_s2 ? vec2[j] : nan_val2);
+                });
+            return (visitor);
+        }
+    }
+
     visitor.pre();
     if (! in_reverse) [[likely]]  {
         for (; i < min_s; ++i) [[likely]]
@@ -745,6 +984,24 @@ single_act_visit (const char *name, V &visitor, bool in_reverse)  {
 
     auto    &vec = get_column<T>(name);
 
+    if constexpr (reduce_visitor<V>)  {
+        if (! in_reverse &&
+            vec.size() >= ThreadPool::MUL_THR_THHOLD &&
+            get_thread_level() > 2 &&
+            visitor.can_reduce())  {
+            _reduce_visit_(visitor, vec.size(),
+                           [this, &vec](V &part,
+                                        size_type begin,
+                                        size_type end) -> void  {
+                               part (indices_.begin() + begin,
+                                     indices_.begin() + end,
+                                     vec.begin() + begin,
+                                     vec.begin() + end);
+                           });
+            return (visitor);
+        }
+    }
+
     visitor.pre();
     if (! in_reverse) [[likely]]
         visitor (indices_.begin(), indices_.end(), vec.begin(), vec.end());
@@ -815,6 +1072,27 @@ single_act_visit (const char *name1,
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
 
     guard.release();
+    if constexpr (reduce_visitor<V>)  {
+        if (! in_reverse &&
+            vec1.size() == vec2.size() &&
+            vec1.size() >= ThreadPool::MUL_THR_THHOLD &&
+            get_thread_level() > 2 &&
+            visitor.can_reduce())  {
+            _reduce_visit_(visitor, vec1.size(),
+                           [this, &vec1, &vec2](V &part,
+                                                size_type begin,
+                                                size_type end) -> void  {
+                               part (indices_.begin() + begin,
+                                     indices_.begin() + end,
+                                     vec1.begin() + begin,
+                                     vec1.begin() + end,
+                                     vec2.begin() + begin,
+                                     vec2.begin() + end);
+                           });
+            return (visitor);
+        }
+    }
+
     visitor.pre();
     if (! in_reverse) [[likely]]
         visitor (indices_.begin(), indices_.end(),
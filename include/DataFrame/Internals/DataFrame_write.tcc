@@ -32,7 +32,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Utils/PrettyPrint.h>
 #include <DataFrame/Utils/Utils.h>
 
+#include <chrono>
+#include <cstring>
 #include <format>
+#include <future>
+#include <sstream>
 #include <type_traits>
 
 // ----------------------------------------------------------------------------
@@ -46,7 +50,10 @@ bool DataFrame<I, H>::
 write(const char *file_name, io_format iof, const WriteParams<> params) const  {
 
     std::ofstream       stream;
-    const IOStreamOpti  io_opti(stream, file_name, iof == io_format::binary);
+    const IOStreamOpti  io_opti(stream,
+                                file_name,
+                                iof == io_format::binary ||
+                                iof == io_format::mmap_binary);
 
     write<std::ostream, Ts ...>(stream, iof, params);
     return (true);
@@ -96,7 +103,44 @@ write(S &o, io_format iof, const WriteParams<> params) const  {
 
     const std::ios_base::fmtflags   original_f { o.flags() };
 
-    if (iof != io_format::binary)  o.precision(params.precision);
+    // A DateTime index is formatted up front in one batch (in parallel, if
+    // it is big) instead of one value at a time in the csv loop below.
+    // The i'th row is in [dt_offsets[i], dt_offsets[i + 1]) of dt_buffer.
+    //
+    std::string             dt_buffer;
+    StlVecType<size_type>   dt_offsets;
+
+    if constexpr (std::same_as<IndexType, DateTime>)  {
+        if (iof == io_format::csv &&
+            ! params.columns_only && end_row > start_row)  {
+            const DT_FORMAT format = DT_FORMAT::DT_TM2;
+
+            if constexpr (std::is_base_of_v<HeteroVector<align_value>,
+                                            DataVec>)  {
+                format_datetime_column(
+                    std::span<const DateTime>(indices_.data() + start_row,
+                                              end_row - start_row),
+                    format, dt_buffer, dt_offsets);
+            }
+            else  {
+                const StlVecType<DateTime>  idx(indices_.begin() + start_row,
+                                                indices_.begin() + end_row);
+
+                format_datetime_column(idx, format, dt_buffer, dt_offsets);
+            }
+        }
+    }
+
+    const auto  dt_index_str =
+        [&dt_buffer, &dt_offsets, start_row](long row) -> std::string_view  {
+            const size_type i = row - start_row;
+
+            return (std::string_view(dt_buffer.data() + dt_offsets[i],
+                                     dt_offsets[i + 1] - dt_offsets[i]));
+        };
+
+    if (iof != io_format::binary && iof != io_format::mmap_binary)
+        o.precision(params.precision);
 
     if (iof == io_format::json)  {
         o << "{\n";
@@ -106,13 +150,16 @@ write(S &o, io_format iof, const WriteParams<> params) const  {
                                                  end_row - start_row);
 
             o << "\"D\":[";
-            if (end_row > start_row)  {
-                _write_json_df_index_(o, indices_[start_row]);
-                for (long i = start_row + 1; i < end_row; ++i)  {
-                    o << ',';
-                    _write_json_df_index_(o, indices_[i]);
-                }
-            }
+            write_text_chunks_(
+                o, start_row, end_row, params,
+                [this, start_row]
+                (text_chunk_ &chunk, long begin, long end) -> void  {
+                    for (long i = begin; i < end; ++i)  {
+                        if (i != start_row)  chunk.buffer += ',';
+                        _append_json_cell_(chunk.buffer, indices_[i],
+                                           chunk.ss, chunk.plain);
+                    }
+                });
             o << "]}";
             need_pre_comma = true;
         }
@@ -124,7 +171,9 @@ write(S &o, io_format iof, const WriteParams<> params) const  {
                                                  need_pre_comma,
                                                  o,
                                                  start_row,
-                                                 end_row);
+                                                 end_row,
+                                                 *this,
+                                                 params);
 
             data_[idx].change(functor);
             need_pre_comma = true;
@@ -139,8 +188,7 @@ write(S &o, io_format iof, const WriteParams<> params) const  {
 
             if constexpr (std::same_as<IndexType, DateTime>)  {
                 for (long i = start_row; i < end_row; ++i)
-                    _write_csv_df_index_(o, indices_[i], DT_FORMAT::DT_TM2)
-                        << params.delim;
+                    o << dt_index_str(i) << params.delim;
             }
             else  {
                 for (long i = start_row; i < end_row; ++i)
@@ -190,34 +238,49 @@ write(S &o, io_format iof, const WriteParams<> params) const  {
         }
         o << '\n';
 
-        need_pre_comma = false;
+        // Each column is bound once to the function that formats its
+        // values. Then rows are formatted in chunks, possibly in parallel.
+        //
+        StlVecType<csv2_cell_>  cells (column_list_.size());
+        const SpinGuard         guard_2(lock_);
 
-        const SpinGuard guard_2(lock_);
+        for (size_type c = 0; c < cells.size(); ++c)  {
+            csv2_cell_functor_<Ts ...>  functor (cells[c]);
 
-        for (long i = start_row; i < end_row; ++i)  {
-            size_type   count = 0;
-
-            if (! params.columns_only) [[likely]]  {
-                if constexpr (std::same_as<IndexType, DateTime>)
-                    _write_csv_df_index_(o, indices_[i], params.dt_format);
-                else
-                    o << indices_[i];
-
-                need_pre_comma = true;
-                count += 1;
-            }
-
-            for (auto citer = column_list_.begin();
-                 citer != column_list_.end(); ++citer, ++count)  {
-                print_csv2_data_functor_<S, Ts ...>  functor (
-                    i, o, params.dt_format);
-
-                if (need_pre_comma && count > 0)  o << params.delim;
-                else  need_pre_comma = true;
-                data_[citer->second].change(functor);
-            }
-            o << '\n';
+            data_[column_list_[c].second].change(functor);
         }
+
+        const DT_FORMAT dt_format = params.dt_format;
+        const bool      columns_only = params.columns_only;
+        const char      delim = params.delim;
+
+        write_text_chunks_(
+            o, start_row, end_row, params,
+            [this, &cells, dt_format, columns_only, delim]
+            (text_chunk_ &chunk, long begin, long end) -> void  {
+                for (long i = begin; i < end; ++i)  {
+                    bool    need_delim = false;
+
+                    if (! columns_only) [[likely]]  {
+                        if constexpr (std::same_as<IndexType, DateTime> ||
+                                      std::same_as<IndexType, Timestamp>)
+                            _append_csv2_cell_(chunk.buffer, indices_[i],
+                                               dt_format,
+                                               chunk.ss, chunk.plain);
+                        else
+                            _append_text_value_(chunk.buffer, indices_[i],
+                                                chunk.ss, chunk.plain);
+                        need_delim = true;
+                    }
+                    for (const auto &cell : cells)  {
+                        if (need_delim)  chunk.buffer += delim;
+                        else  need_delim = true;
+                        if (size_type(i) < cell.size)
+                            cell.append(cell.column, i, dt_format, chunk);
+                    }
+                    chunk.buffer += '\n';
+                }
+            });
     }
     else if (iof == io_format::binary)  {
         const auto  ed = get_system_endian();
@@ -246,6 +309,12 @@ write(S &o, io_format iof, const WriteParams<> params) const  {
             data_[idx].change(functor);
         }
     }
+    else if (iof == io_format::mmap_binary)  {
+        write_mmap_binary_<S, Ts ...>(o,
+                                      start_row,
+                                      end_row,
+                                      params.columns_only);
+    }
     else if (iof == io_format::pretty_prt ||
              iof == io_format::markdown ||
              iof == io_format::latex ||
@@ -442,6 +511,184 @@ write(S &o, io_format iof, const WriteParams<> params) const  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename S, typename F>
+void DataFrame<I, H>::
+write_text_chunks_(S &o,
+                   long start_row,
+                   long end_row,
+                   const WriteParams<> &params,
+                   F &&format) const  {
+
+    if (end_row <= start_row)  return;
+
+    const long  rows = end_row - start_row;
+    const long  chunk_s =
+        params.chunk_rows > 0 ? std::min(params.chunk_rows, rows) : rows;
+    const long  chunk_cnt = (rows + chunk_s - 1) / chunk_s;
+    long        thr_cnt = params.threads;
+
+    if (thr_cnt <= 0)  {
+        const auto  thread_level =
+            (size_type(rows) < ThreadPool::MUL_THR_THHOLD)
+                ? 0L : get_thread_level();
+
+        thr_cnt = thread_level > 2 ? long(thread_level) : 1L;
+    }
+
+    // std::to_chars is only equivalent to the stream, if the stream has
+    // default formatting flags and the classic locale
+    //
+    constexpr auto  fmt_mask =
+        std::ios_base::basefield | std::ios_base::floatfield |
+        std::ios_base::adjustfield | std::ios_base::boolalpha |
+        std::ios_base::showbase | std::ios_base::showpoint |
+        std::ios_base::showpos | std::ios_base::uppercase;
+    const bool      plain =
+        (o.flags() & fmt_mask) == std::ios_base::dec &&
+        o.getloc() == std::locale::classic();
+    const auto      init_chunk =
+        [&o, plain](text_chunk_ &chunk) -> void  {
+            chunk.ss.flags(o.flags());
+            chunk.ss.precision(o.precision());
+            chunk.ss.imbue(o.getloc());
+            chunk.plain = plain;
+        };
+
+    if (thr_cnt < 2 || chunk_cnt < 2)  {
+        text_chunk_ chunk;
+
+        init_chunk(chunk);
+        for (long begin = start_row; begin < end_row; begin += chunk_s)  {
+            chunk.buffer.clear();
+            format(chunk, begin, std::min(begin + chunk_s, end_row));
+            o.write(chunk.buffer.data(), chunk.buffer.size());
+        }
+        return;
+    }
+
+    // There are twice as many chunks in flight as threads, so the pool
+    // keeps formatting while the finished chunks are written in order.
+    // Chunk buffers are reused, so memory is bounded by the in-flight
+    // chunks regardless of the number of rows.
+    //
+    const long                      slot_cnt =
+        std::min(chunk_cnt, thr_cnt * 2);
+    std::vector<text_chunk_>        chunks (slot_cnt);
+    std::vector<std::future<void>>  futures (slot_cnt);
+    const auto                      flush =
+        [&o, &chunks, &futures](long slot) -> void  {
+            auto    &fut = futures[slot];
+
+            while (fut.wait_for(std::chrono::seconds(0)) ==
+                       std::future_status::timeout)
+                thr_pool_.run_task();
+            fut.get();
+            o.write(chunks[slot].buffer.data(), chunks[slot].buffer.size());
+        };
+
+    for (auto &chunk : chunks)  init_chunk(chunk);
+    for (long c = 0; c < chunk_cnt; ++c)  {
+        const long  slot = c % slot_cnt;
+        const long  begin = start_row + c * chunk_s;
+        const long  end = std::min(begin + chunk_s, end_row);
+        text_chunk_ &chunk = chunks[slot];
+
+        if (c >= slot_cnt)  flush(slot);
+        chunk.buffer.clear();
+        futures[slot] =
+            thr_pool_.dispatch(false,
+                               [&format, &chunk, begin, end]() -> void  {
+                                   format(chunk, begin, end);
+                               });
+    }
+    for (long c = std::max(0L, chunk_cnt - slot_cnt); c < chunk_cnt; ++c)
+        flush(c % slot_cnt);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename S, typename ... Ts>
+void DataFrame<I, H>::
+write_mmap_binary_(S &o, long start_row, long end_row, bool columns_only) const {
+
+    _mmap_binary_header_    header { };
+
+    std::memcpy(header.magic, _mmap_binary_magic_, sizeof(header.magic));
+    header.version = _mmap_binary_version_;
+    header.endian = get_system_endian();
+    o.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    // Each column record is first rendered into a buffer, so its directory
+    // entry and padding are known before it is written out
+    //
+    StlVecType<_mmap_binary_dir_entry_> dir;
+    uint64_t                            pos { sizeof(header) };
+    std::stringstream                   buffer (std::ios_base::out |
+                                                std::ios_base::binary);
+    const char                          padding[_mmap_binary_align_] { };
+    auto                                flush_rec =
+        [&o, &dir, &pos, &buffer, &padding]() -> void  {
+            const std::string       rec = std::move(buffer).str();
+            const uint64_t          pad =
+                (_mmap_binary_align_ -
+                 (pos + _mmap_binary_rec_hdr_size_) % _mmap_binary_align_) %
+                _mmap_binary_align_;
+            _mmap_binary_dir_entry_ entry { };
+
+            std::memcpy(entry.col_name, rec.data(), sizeof(entry.col_name));
+            std::memcpy(entry.col_type,
+                        rec.data() + MAX_COL_NAME_SIZE,
+                        sizeof(entry.col_type));
+            std::memcpy(&entry.num_rows,
+                        rec.data() + MAX_COL_NAME_SIZE + sizeof(entry.col_type),
+                        sizeof(entry.num_rows));
+            entry.col_name[sizeof(entry.col_name) - 1] = '\0';
+            entry.col_type[sizeof(entry.col_type) - 1] = '\0';
+            entry.offset = pos + pad;
+            entry.length = rec.size();
+            dir.push_back(entry);
+
+            o.write(padding, std::streamsize(pad));
+            o.write(rec.data(), std::streamsize(rec.size()));
+            pos += pad + rec.size();
+            buffer.str(std::string { });
+        };
+
+    if (! columns_only) [[likely]]  {
+        print_binary_functor_<Ts ...>   idx_functor (
+            DF_INDEX_COL_NAME, buffer, start_row, end_row);
+
+        idx_functor(indices_);
+        flush_rec();
+    }
+
+    const SpinGuard guard(lock_);
+
+    dir.reserve(dir.size() + column_list_.size());
+    for (const auto &[name, idx] : column_list_) [[likely]]  {
+        print_binary_functor_<Ts ...>   functor (name.c_str(),
+                                                 buffer,
+                                                 start_row,
+                                                 end_row);
+
+        data_[idx].change(functor);
+        flush_rec();
+    }
+
+    _mmap_binary_trailer_   trailer { };
+
+    trailer.dir_size = dir.size();
+    trailer.dir_offset = pos;
+    std::memcpy(trailer.magic, _mmap_binary_magic_, sizeof(trailer.magic));
+    o.write(reinterpret_cast<const char *>(dir.data()),
+            std::streamsize(dir.size() * sizeof(_mmap_binary_dir_entry_)));
+    o.write(reinterpret_cast<const char *>(&trailer), sizeof(trailer));
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename ... Ts>
 std::future<bool> DataFrame<I, H>::
@@ -28,24 +28,175 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <DataFrame/RandGen.h>
+#include <DataFrame/Utils/PhiloxEngine.h>
+#include <DataFrame/Utils/Threads/ThreadGranularity.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <numbers>
 
 // ----------------------------------------------------------------------------
 
 namespace hmdf
 {
 
+// Number of values generated from each Philox stream. It is fixed, so the
+// values do not depend on how chunks are spread over threads.
+//
+static constexpr std::size_t    _philox_chunk_ { 1 << 16 };
+
+// ----------------------------------------------------------------------------
+
+static inline std::uint64_t
+_philox_key_(unsigned int seed)  {
+
+    if (seed != static_cast<unsigned int>(-1))  return (seed);
+
+    std::random_device  rd;
+
+    return ((std::uint64_t(rd()) << 32) | rd());
+}
+
+// ----------------------------------------------------------------------------
+
+// It calls fill(gen, begin, end) for every _philox_chunk_ sized chunk of
+// [0, n). gen is the Philox stream of that chunk. Chunks are filled in
+// parallel, if n is big enough and the thread level allows.
+//
+template<typename F>
+static inline void
+_philox_chunks_(std::size_t n, std::uint64_t key, bool can_thread, F &&fill) {
+
+    const std::size_t   chunk_cnt = (n + _philox_chunk_ - 1) / _philox_chunk_;
+    const auto          run =
+        [n, key, &fill](std::size_t c_begin, std::size_t c_end) -> void  {
+            for (std::size_t c = c_begin; c < c_end; ++c)  {
+                PhiloxEngine    gen (key, c);
+
+                fill(gen,
+                     c * _philox_chunk_,
+                     std::min(n, (c + 1) * _philox_chunk_));
+            }
+        };
+
+    if (can_thread &&
+        n >= ThreadPool::MUL_THR_THHOLD &&
+        ThreadGranularity::get_thread_level() > 2)  {
+        auto    futures =
+            ThreadGranularity::thr_pool_.parallel_loop<std::size_t>(
+                std::size_t(0), chunk_cnt, run);
+
+        for (auto &fut : futures)  fut.get();
+    }
+    else
+        run(0, chunk_cnt);
+}
+
+// ----------------------------------------------------------------------------
+
+// It maps a 64-bit random value to [0, 1) with as many random bits as T
+// has digits
+//
+template<typename T>
+static inline T _philox_canonical_(std::uint64_t val) noexcept  {
+
+    constexpr int   bits { std::min(std::numeric_limits<T>::digits, 64) };
+    constexpr T     scale { T(1) / (T(std::uint64_t(1) << (bits - 1)) * 2) };
+
+    return (T(val >> (64 - bits)) * scale);
+}
+
+// ----------------------------------------------------------------------------
+
+// Philox version of the distribution transforms. Raw values are generated
+// into a small buffer and turned into results by tf(raw, out, cnt) in a
+// separate loop. cnt is always even, so tf can work in pairs. Both loops
+// are free of branches and dependencies between iterations, so compilers
+// can vectorize them.
+//
+template<typename T, std::size_t A, typename TF>
+static inline std::vector<T, typename allocator_declare<T, A>::type>
+_gen_philox_(std::size_t n, const RandGenParams<T> &params, TF &&tf)  {
+
+    std::vector<T, typename allocator_declare<T, A>::type>   result(n);
+
+    _philox_chunks_(
+        n, _philox_key_(params.seed), true,
+        [&result, &tf](PhiloxEngine &gen, std::size_t begin, std::size_t end)
+            -> void  {
+            constexpr std::size_t   buf_s { 512 };
+            std::uint64_t           raw[buf_s];
+            T                       out[buf_s];
+
+            while (begin < end)  {
+                const std::size_t   cnt = std::min(buf_s, end - begin);
+                const std::size_t   even_cnt = cnt + (cnt & 1);
+
+                gen.generate(raw, even_cnt);
+                tf(raw, out, even_cnt);
+                std::copy(out, out + cnt, result.begin() + begin);
+                begin += cnt;
+            }
+        });
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+// It produces pairs of standard normal values by the Box-Muller transform.
+// The two values of a pair go to the two halves of out.
+//
+template<typename T>
+static inline void
+_philox_std_normal_(const std::uint64_t *raw, T *out, std::size_t cnt)  {
+
+    constexpr T         two_pi { T(2) * std::numbers::pi_v<T> };
+    const std::size_t   half { cnt / 2 };
+
+    for (std::size_t i = 0; i < half; ++i)  {
+        // u1 is in (0, 1], so log(u1) is finite
+        //
+        const T u1 = T(1) - _philox_canonical_<T>(raw[i]);
+        const T u2 = _philox_canonical_<T>(raw[i + half]);
+        const T r = std::sqrt(T(-2) * std::log(u1));
+        const T theta = two_pi * u2;
+
+        out[i] = r * std::cos(theta);
+        out[i + half] = r * std::sin(theta);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename T, typename D, std::size_t A>
 static inline std::vector<T, typename allocator_declare<T, A>::type>
 _gen_rand_(std::size_t n, const RandGenParams<T> &params, D &&dist)  {
 
+    std::vector<T, typename allocator_declare<T, A>::type>   result(n);
+
+    if (params.engine == rand_engine::philox)  {
+
+        // Each chunk starts with a fresh copy of the distribution, so
+        // cached state (e.g. the second normal value) never crosses chunks.
+        // Bits of vector<bool> are shared in words, so it is done serially.
+        //
+        _philox_chunks_(
+            n, _philox_key_(params.seed), ! std::is_same_v<T, bool>,
+            [&result, &dist]
+            (PhiloxEngine &gen, std::size_t begin, std::size_t end) -> void  {
+                std::decay_t<D> chunk_dist (dist);
+
+                for (std::size_t i = begin; i < end; ++i)
+                    result[i] = chunk_dist(gen);
+            });
+        return (result);
+    }
+
     std::random_device  rd;
     std::mt19937_64     gen(rd());
 
     if (params.seed != static_cast<unsigned int>(-1))  gen.seed(params.seed);
 
-    std::vector<T, typename allocator_declare<T, A>::type>   result(n);
-
     for (auto iter = result.begin(); iter < result.end(); ++iter)
         *iter = dist(gen);
     return (result);
@@ -88,6 +239,20 @@ gen_uniform_real_dist(std::size_t n, const RandGenParams<T> &params) {
                   std::is_same<long double, T>::value,
                   "gen_uniform_real_dist() requires real number type");
 
+    if (params.engine == rand_engine::philox)  {
+        const T min_v = params.min_value;
+        const T range = params.max_value - params.min_value;
+
+        return (_gen_philox_<T, A>(
+                    n, params,
+                    [min_v, range]
+                    (const std::uint64_t *raw, T *out, std::size_t cnt)  {
+                        for (std::size_t i = 0; i < cnt; ++i)
+                            out[i] =
+                                min_v + _philox_canonical_<T>(raw[i]) * range;
+                    }));
+    }
+
     using D = std::uniform_real_distribution<T>;
 
     return (_gen_rand_<T, D, A>(
@@ -222,6 +387,23 @@ gen_exponential_dist(std::size_t n, const RandGenParams<T> &params)  {
                   std::is_same<long double, T>::value,
                   "gen_exponential_dist() requires real number type");
 
+    if (params.engine == rand_engine::philox)  {
+        const T lambda = T(params.lambda);
+
+        return (_gen_philox_<T, A>(
+                    n, params,
+                    [lambda]
+                    (const std::uint64_t *raw, T *out, std::size_t cnt)  {
+                        // 1 - u is in (0, 1], so the log is finite
+                        //
+                        for (std::size_t i = 0; i < cnt; ++i)
+                            out[i] =
+                                -std::log(T(1) -
+                                          _philox_canonical_<T>(raw[i])) /
+                                lambda;
+                    }));
+    }
+
     using D = std::exponential_distribution<T>;
 
     return (_gen_rand_<T, D, A>(
@@ -294,6 +476,20 @@ gen_normal_dist(std::size_t n, const RandGenParams<T> &params) {
                   std::is_same<long double, T>::value,
                   "gen_normal_dist() requires real number type");
 
+    if (params.engine == rand_engine::philox)  {
+        const T mean = T(params.mean);
+        const T std_dev = T(params.std);
+
+        return (_gen_philox_<T, A>(
+                    n, params,
+                    [mean, std_dev]
+                    (const std::uint64_t *raw, T *out, std::size_t cnt)  {
+                        _philox_std_normal_(raw, out, cnt);
+                        for (std::size_t i = 0; i < cnt; ++i)
+                            out[i] = mean + std_dev * out[i];
+                    }));
+    }
+
     using D = std::normal_distribution<T>;
 
     return (_gen_rand_<T, D, A>(
@@ -312,6 +508,20 @@ gen_lognormal_dist(std::size_t n, const RandGenParams<T> &params) {
                   std::is_same<long double, T>::value,
                   "gen_lognormal_dist() requires real number type");
 
+    if (params.engine == rand_engine::philox)  {
+        const T m = T(params.m);
+        const T s = T(params.s);
+
+        return (_gen_philox_<T, A>(
+                    n, params,
+                    [m, s]
+                    (const std::uint64_t *raw, T *out, std::size_t cnt)  {
+                        _philox_std_normal_(raw, out, cnt);
+                        for (std::size_t i = 0; i < cnt; ++i)
+                            out[i] = std::exp(m + s * out[i]);
+                    }));
+    }
+
     using D = std::lognormal_distribution<T>;
 
     return (_gen_rand_<T, D, A>(
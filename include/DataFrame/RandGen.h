@@ -44,6 +44,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace hmdf
 {
 
+// NOTE: The engine behind the gen_*_dist() functions is selected by the
+//       engine field of RandGenParams. See rand_engine in DataFrameTypes.h.
+//       With rand_engine::philox, the numbers for a given seed are the same
+//       regardless of the thread level.
+
+// ----------------------------------------------------------------------------
+
 // It generates n uniform integer distribution random numbers.
 //                  1
 // P(i|a,b) = --------------
@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <DataFrame/Utils/DateTime.h>
 #include <DataFrame/Utils/FixedSizeString.h>
+#include <DataFrame/Utils/Timestamp.h>
 
 #include <concepts>
 #include <functional>
@@ -163,6 +164,69 @@ concept visitor_t = requires (T t)  {
     t.post();
 };
 
+// Visitors that can update their result incrementally as values enter and
+// leave a rolling window. After pre(), roll_add()/roll_remove() may be
+// called in any order and post() computes the result of the current window.
+// can_roll() returns false, if the visitor's current settings don't support
+// it.
+//
+template<typename T>
+concept rolling_visitor = requires (T t,
+                                    const typename T::index_type &idx,
+                                    const typename T::value_type &val)  {
+    { t.can_roll() } -> std::convertible_to<bool>;
+    t.roll_add(idx, val);
+    t.roll_remove(idx, val);
+};
+
+// Same as above for visitors over two columns
+//
+template<typename T>
+concept rolling_visitor2 = requires (T t,
+                                     const typename T::index_type &idx,
+                                     const typename T::value_type &val1,
+                                     const typename T::value_type &val2)  {
+    { t.can_roll() } -> std::convertible_to<bool>;
+    t.roll_add(idx, val1, val2);
+    t.roll_remove(idx, val1, val2);
+};
+
+// Visitors whose one-by-one operator() only buffers the data for their bulk
+// operator(), which then runs in post(). See the OBO_PORT macros.
+// Such a visitor can be given a whole column directly.
+//
+template<typename T>
+concept obo_port_visitor = requires  {
+    requires T::obo_port;
+};
+
+// Visitors whose results over consecutive chunks of data can be combined.
+// Each chunk is visited by a copy of the visitor, after its pre(). Then the
+// visitor, after its own pre(), is given the copies in chunk order through
+// reduce() and post() computes the result.
+// can_reduce() returns false, if the visitor's current settings don't
+// support it.
+//
+template<typename T>
+concept reduce_visitor =
+    std::copy_constructible<T> &&
+    requires (T t, const T &other)  {
+        { t.can_reduce() } -> std::convertible_to<bool>;
+        t.reduce(other);
+    };
+
+// Lazy column and frame expressions (See DataFrameOperators.h)
+//
+template<typename T>
+concept column_expression = requires  {
+    requires T::is_column_expr;
+};
+
+template<typename T>
+concept frame_expression = requires  {
+    requires T::is_frame_expr;
+};
+
 // ----------------------------------------------------------------------------
 
 template<typename F, typename U, typename V>
@@ -229,11 +293,34 @@ concept StringOnly =
 template<typename T>
 concept numeric_or_DateTime =
     std::is_same_v<T, DateTime> ||
+    std::is_same_v<T, Timestamp> ||
     std::integral<T> ||
     std::floating_point<T>;
 
 // ----------------------------------------------------------------------------
 
+// Index types that carry calendar semantics (hour, day, month, ...)
+//
+template<typename T>
+concept DateTime_or_Timestamp =
+    std::is_same_v<T, DateTime> ||
+    std::is_same_v<T, Timestamp>;
+
+// ----------------------------------------------------------------------------
+
+// Types whose order can be mapped onto unsigned 64-bit integer keys, so they
+// can be radix sorted
+//
+template<typename T>
+concept radix_sortable =
+    std::is_same_v<T, DateTime> ||
+    std::is_same_v<T, Timestamp> ||
+    std::is_same_v<T, float> ||
+    std::is_same_v<T, double> ||
+    (std::integral<T> && ! std::is_same_v<T, bool> && sizeof(T) <= 8);
+
+// ----------------------------------------------------------------------------
+
 template<typename T>
 concept binary_array =
     std::is_same_v<T, std::string> ||
@@ -32,10 +32,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/DataFrameExports.h>
 #include <DataFrame/Utils/FixedSizeString.h>
 
+#include <cstddef>
 #include <ctime>
 #include <limits>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 // ----------------------------------------------------------------------------
@@ -252,6 +255,28 @@ public:
                                 DT_DATE_STYLE ds = DT_DATE_STYLE::YYYYMMDD,
                                 DT_TIME_ZONE tz = DT_TIME_ZONE::LOCAL);
 
+    // It remembers the date part of the last parsed string. When the next
+    // string starts with the same date, the date is not parsed again.
+    // This is the common case when reading a time series.
+    //
+    struct  DateCache  {
+        char            str[16] { };
+        unsigned char   len { 0 };
+        DateType        value { 0 };
+    };
+
+    // Same formats as above. These don't allocate memory, so they are
+    // preferred when parsing big columns.
+    // Fraction of seconds could have any number of digits up to 9.
+    //
+    HMDF_API explicit DateTime (std::string_view s,
+                                DT_DATE_STYLE ds,
+                                DT_TIME_ZONE tz = DT_TIME_ZONE::LOCAL);
+    HMDF_API DateTime (std::string_view s,
+                       DT_DATE_STYLE ds,
+                       DT_TIME_ZONE tz,
+                       DateCache &cache);
+
     HMDF_API DateTime (const DateTime &that);
     HMDF_API DateTime (DateTime &&that);
     HMDF_API ~DateTime ();
@@ -265,9 +290,13 @@ public:
     HMDF_API void
     set_time (EpochType the_time, NanosecondType nanosec = 0) noexcept;
 
-    // NOTE: This method is not multithread-safe. This method
-    //       modifies the TZ environment variable which changes the
-    //       time zone for the entire program.
+    // Time zone rules are loaded once per zone from the tzdata files
+    // (under $TZDIR or /usr/share/zoneinfo). LOCAL is the zone in $TZ or
+    // /etc/localtime, at the time it is first used. After that, conversions
+    // don't touch the environment and are multithread-safe.
+    // If the rules cannot be loaded (e.g. on Windows), the TZ environment
+    // variable is changed for the duration of each conversion, under a
+    // lock. That changes the time zone for the entire program.
     //
     HMDF_API void set_timezone (DT_TIME_ZONE tz);
     [[nodiscard]] HMDF_API DT_TIME_ZONE get_timezone () const;
@@ -358,6 +387,39 @@ public:
     void date_to_str (DT_FORMAT format, T &result) const;
     [[nodiscard]] HMDF_API std::string string_format (DT_FORMAT format) const;
 
+    // Formats date/time into buffer and returns the number of characters
+    // written. It doesn't write a null terminator.
+    // buffer must have room for at least FORMAT_BUF_SIZE characters.
+    // The output is identical to date_to_str(). But for the common formats
+    // (all except AMR_DT, EUR_DT and SCT_DT) no memory is allocated and
+    // printf() is not used.
+    //
+    HMDF_API std::size_t format_to (char *buffer, DT_FORMAT format) const;
+
+    inline static constexpr std::size_t FORMAT_BUF_SIZE { 64 };
+
+    // Batch versions of the string constructor and format_to() above.
+    // When consecutive values are on the same day, the date part is
+    // parsed/formatted only once.
+    //
+    // parse_range():
+    //   result must be the same size as strs.
+    // format_range():
+    //   The formatted values are appended to buffer back to back.
+    //   ends must be the same size as dts. ends[i] is the offset in buffer
+    //   just past the i'th value.
+    //
+    HMDF_API static void
+    parse_range (std::span<const std::string_view> strs,
+                 std::span<DateTime> result,
+                 DT_DATE_STYLE ds,
+                 DT_TIME_ZONE tz = DT_TIME_ZONE::LOCAL);
+    HMDF_API static void
+    format_range (std::span<const DateTime> dts,
+                  DT_FORMAT format,
+                  std::string &buffer,
+                  std::span<std::size_t> ends);
+
 private:
 
     template<typename T>
@@ -476,18 +538,24 @@ private:
     [[nodiscard]] static DatePartType
     days_in_month_(DT_MONTH month, DatePartType year) noexcept;
 
-    // NOTE: This method is not multithread-safe. This method
-    //       modifies the TZ environment variable which changes the
-    //       time zone for the entire program.
+    // Like mktime(). It also fills in tm_wday and tm_yday of ltime.
     //
     [[nodiscard]] EpochType maketime_(struct tm &ltime) const noexcept;
 
-    // NOTE: This method is not multithread-safe. This method
-    //       modifies the TZ environment variable which changes the
-    //       time zone for the entire program.
+    // Like localtime_r(). It sets the date/time parts of this.
     //
     void breaktime_(EpochType the_time, NanosecondType nanosec) noexcept;
 
+    // It parses s in style ds into this. See the string constructor.
+    //
+    void parse_(std::string_view s, DT_DATE_STYLE ds, DateCache &cache);
+
+    // They write the date and the time parts of format. format_date_()
+    // returns 0, if format doesn't have a fast path.
+    //
+    std::size_t format_date_(char *buffer, DT_FORMAT format) const noexcept;
+    std::size_t format_time_(char *buffer, DT_FORMAT format) const noexcept;
+
     inline static const char *const MONTH_[]  {
         "January",
         "February",
@@ -130,6 +130,19 @@ struct  SwapBytes<double, 8>  {
     }
 };
 
+template<>
+struct  SwapBytes<Timestamp, 8>  {
+
+    inline Timestamp operator()(Timestamp value) const  {
+
+        const uint64_t  layout =
+            SwapBytes<uint64_t, sizeof(uint64_t)>{ }(
+                static_cast<uint64_t>(value.long_time()));
+
+        return (Timestamp(static_cast<Timestamp::LongTimeType>(layout)));
+    }
+};
+
 /*
 template<typename T>
 struct  SwapBytes<T, 16>  {
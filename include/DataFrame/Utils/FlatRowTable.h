@@ -0,0 +1,253 @@
+// Hossein Moein
+// October 17, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#  include <emmintrin.h>
+#  define HMDF_FLAT_TABLE_SSE2 1
+#endif // __SSE2__ || _M_X64 || _M_AMD64
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// Open-addressing hash table that groups rows with equal keys.
+// It stores row numbers, not keys. The keys stay in the columns, and the
+// caller gives the hash of a row and a predicate that compares the row
+// being inserted with another row. So a key may span several columns
+// without being copied or put in a tuple.
+// Each distinct key is a group. Groups are numbered 0, 1, ... in the order
+// they are first seen. The rows of a group are chained through a
+// next-index array in the order they were inserted. There is no per-group
+// allocation.
+// Slots are probed 16 at a time. Each slot has a control byte that holds 7
+// bits of the hash, so most non-matching slots are rejected without
+// looking at the columns. With SSE2, a group of 16 control bytes is
+// matched with one instruction.
+// There is no erase. The table is sized once for the most rows that will
+// be inserted, so it never rehashes.
+//
+class   FlatRowTable  {
+
+public:
+
+    using size_type = std::size_t;
+
+    static constexpr size_type  npos = std::numeric_limits<size_type>::max();
+
+    // rows is the most rows that will be inserted
+    //
+    explicit
+    FlatRowTable(size_type rows)  {
+
+        // Keep the load factor at or below 7/8
+        //
+        const size_type slots = rows + rows / 7 + 1;
+
+        group_mask_ =
+            std::bit_ceil((slots + GROUP_WIDTH - 1) / GROUP_WIDTH) - 1;
+        ctrl_.resize((group_mask_ + 1) * GROUP_WIDTH, EMPTY_);
+        slots_.resize(ctrl_.size());
+        rows_.reserve(rows);
+        next_.reserve(rows);
+    }
+
+    FlatRowTable() : FlatRowTable(0)  {   }
+    FlatRowTable(const FlatRowTable &) = default;
+    FlatRowTable(FlatRowTable &&) = default;
+    FlatRowTable &operator= (const FlatRowTable &) = default;
+    FlatRowTable &operator= (FlatRowTable &&) = default;
+    ~FlatRowTable() = default;
+
+    // Column hashes are often weak (e.g. std::hash of an integer is the
+    // integer itself). The table expects hashes passed through this.
+    //
+    [[nodiscard]] static inline std::uint64_t
+    mix(std::uint64_t h) noexcept  {
+
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return (h);
+    }
+
+    // It adds row to the group of its key and returns the group number.
+    // same_key(other_row) must tell if row has the same key as other_row.
+    //
+    template<typename EQ>
+    size_type
+    insert(size_type row, std::uint64_t hash, EQ &&same_key)  {
+
+        const size_type slot = probe_(hash, same_key);
+        const size_type ord = rows_.size();
+
+        rows_.push_back(row);
+        next_.push_back(npos);
+        if (ctrl_[slot] != EMPTY_) [[likely]]  {
+            const size_type grp = slots_[slot];
+
+            next_[last_[grp]] = ord;
+            last_[grp] = ord;
+            counts_[grp] += 1;
+            return (grp);
+        }
+
+        const size_type grp = first_.size();
+
+        ctrl_[slot] = tag_(hash);
+        slots_[slot] = grp;
+        first_.push_back(ord);
+        last_.push_back(ord);
+        counts_.push_back(1);
+        return (grp);
+    }
+
+    // It returns the group of the key, or npos if the key is not in the
+    // table. same_key(row) must tell if the key is the key of row.
+    //
+    template<typename EQ>
+    [[nodiscard]] size_type
+    find(std::uint64_t hash, EQ &&same_key) const  {
+
+        const size_type slot = probe_(hash, same_key);
+
+        return (ctrl_[slot] != EMPTY_ ? slots_[slot] : npos);
+    }
+
+    [[nodiscard]] size_type
+    groups() const noexcept  { return (first_.size()); }
+    [[nodiscard]] size_type
+    rows() const noexcept  { return (rows_.size()); }
+
+    [[nodiscard]] size_type
+    group_size(size_type grp) const noexcept  { return (counts_[grp]); }
+    [[nodiscard]] size_type
+    first_row(size_type grp) const noexcept  { return (rows_[first_[grp]]); }
+    [[nodiscard]] size_type
+    last_row(size_type grp) const noexcept  { return (rows_[last_[grp]]); }
+
+    // It calls func(row) for the rows of the group in insertion order
+    //
+    template<typename F>
+    void
+    for_each_row(size_type grp, F &&func) const  {
+
+        for (size_type ord = first_[grp]; ord != npos; ord = next_[ord])
+            func(rows_[ord]);
+    }
+
+private:
+
+    static constexpr size_type      GROUP_WIDTH { 16 };
+    static constexpr std::uint8_t   EMPTY_ { 0x80 };
+
+    [[nodiscard]] static inline std::uint8_t
+    tag_(std::uint64_t hash) noexcept  { return (std::uint8_t(hash & 0x7F)); }
+
+    // Bit i is set, if ctrl[i] == byte
+    //
+    [[nodiscard]] static inline std::uint32_t
+    match_(const std::uint8_t *ctrl, std::uint8_t byte) noexcept  {
+
+#ifdef HMDF_FLAT_TABLE_SSE2
+        const __m128i   grp =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+
+        return (std::uint32_t(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(grp,
+                                             _mm_set1_epi8(char(byte))))));
+#else
+        std::uint32_t   mask { 0 };
+
+        for (size_type i = 0; i < GROUP_WIDTH; ++i)
+            mask |= std::uint32_t(ctrl[i] == byte) << i;
+        return (mask);
+#endif // HMDF_FLAT_TABLE_SSE2
+    }
+
+    // It returns the slot holding the key's group, or the empty slot where
+    // the key's group would go. Groups of slots are probed in triangular
+    // order, which visits all of them since their count is a power of 2.
+    //
+    template<typename EQ>
+    [[nodiscard]] size_type
+    probe_(std::uint64_t hash, EQ &same_key) const  {
+
+        const std::uint8_t  tag = tag_(hash);
+        size_type           pos = size_type(hash >> 7) & group_mask_;
+
+        for (size_type step = 1; ; ++step)  {
+            const size_type     base = pos * GROUP_WIDTH;
+            const std::uint8_t  *ctrl = ctrl_.data() + base;
+
+            for (std::uint32_t m = match_(ctrl, tag); m; m &= m - 1)  {
+                const size_type slot = base + std::countr_zero(m);
+
+                if (same_key(rows_[first_[slots_[slot]]]))  return (slot);
+            }
+
+            const std::uint32_t empties = match_(ctrl, EMPTY_);
+
+            if (empties) [[likely]]
+                return (base + std::countr_zero(empties));
+            pos = (pos + step) & group_mask_;
+        }
+    }
+
+    size_type                   group_mask_ { 0 };
+    std::vector<std::uint8_t>   ctrl_ { };   // Tag or EMPTY_ per slot
+    std::vector<size_type>      slots_ { };  // Group per slot
+
+    std::vector<size_type>      first_ { };  // Per group, its first ordinal
+    std::vector<size_type>      last_ { };   // Per group, its last ordinal
+    std::vector<size_type>      counts_ { }; // Per group, its rows count
+
+    std::vector<size_type>      rows_ { };   // Per ordinal, its row
+    std::vector<size_type>      next_ { };   // Per ordinal, next in group
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -32,6 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <queue>
@@ -296,6 +297,166 @@ private:
     range_search_(const point_t &lower, const point_t &upper) const;
 };
 
+// ----------------------------------------------------------------------------
+// ----------------------------------------------------------------------------
+
+// K-Dimensional (KD) Tree with flat storage
+//
+// Points are copied into one contiguous buffer, dim values per point, in
+// tree order. There are no node objects. A subtree is a range [lo, hi) of
+// that buffer, its splitting point is the middle of the range and its two
+// children are the halves on either side of it. Ranges of LEAF_SIZE points
+// or fewer are scanned linearly.
+// Each split is on the dimension with the widest spread in its range.
+// Large subtrees are built in parallel on the DataFrame thread pool.
+//
+// Query results are (distance, index) pairs, where index is the 0-based
+// position of the point in the data given to build(). Results are sorted by
+// distance. Equal distances are sorted by index.
+//
+// Without a distance function, Euclidean distance is computed in place.
+// A user distance function receives points as std::vector, so it works with
+// KNNDistFunc style functors. Subtrees are pruned using the absolute
+// difference along the splitting dimension. So the distance function must
+// never be smaller than that difference. All Minkowski distances satisfy
+// this.
+//
+template<typename T>
+class   FlatKDTree {
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using point_t = std::vector<value_type>;
+    using points_vec = std::vector<point_t>;
+    using dist_func_t =
+        std::function<value_type(const point_t &, const point_t &)>;
+    using neighbor_t = std::pair<value_type, size_type>;
+    using neighbors_vec = std::vector<neighbor_t>;
+    using index_vec = std::vector<size_type>;
+
+    static constexpr size_type  LEAF_SIZE { 16 };
+
+    explicit
+    FlatKDTree(size_type dim);
+    FlatKDTree(size_type dim, dist_func_t &&dist_func);
+    FlatKDTree() = delete;
+    FlatKDTree(const FlatKDTree &that) = default;
+    FlatKDTree(FlatKDTree &&that) = default;
+    FlatKDTree &operator= (const FlatKDTree &that) = delete;
+    FlatKDTree &operator= (FlatKDTree &&that) = default;
+    ~FlatKDTree() = default;
+
+    // Build tree from n points stored contiguously. Point i is
+    // [data + i * dim, data + (i + 1) * dim)
+    //
+    void
+    build(const value_type *data, size_type n);
+
+    // Build tree from vector of points
+    //
+    void
+    build(const points_vec &points);
+
+    // Find k nearest neighbors
+    //
+    [[nodiscard]] neighbors_vec
+    find_k_nearest(const value_type *target, size_type k) const;
+    [[nodiscard]] neighbors_vec
+    find_k_nearest(const point_t &target, size_type k) const;
+
+    // Find k nearest neighbors of n_targets points stored contiguously.
+    // It returns n_targets * min(k, size()) neighbors. Neighbors of target
+    // i start at i * min(k, size()).
+    // Queries are run in parallel if there are enough of them
+    //
+    [[nodiscard]] neighbors_vec
+    find_k_nearest(const value_type *targets,
+                   size_type n_targets,
+                   size_type k) const;
+
+    // Same as above with every point in the tree as a target, in the order
+    // given to build(). Each point is its own nearest neighbor
+    //
+    [[nodiscard]] neighbors_vec
+    all_k_nearest(size_type k) const;
+
+    // Find all points within radius distance of target
+    //
+    [[nodiscard]] neighbors_vec
+    find_within(const value_type *target, value_type radius) const;
+    [[nodiscard]] neighbors_vec
+    find_within(const point_t &target, value_type radius) const;
+
+    // Range search: indices of all points within [lower, upper] box,
+    // in ascending order
+    //
+    [[nodiscard]] index_vec
+    find_in_range(const point_t &lower, const point_t &upper) const;
+
+    // Check if tree is empty
+    //
+    [[nodiscard]] bool
+    empty() const;
+
+    // Get number of points
+    //
+    [[nodiscard]] size_type
+    size() const;
+
+    [[nodiscard]] size_type
+    dim() const;
+
+private:
+
+    using axis_t = std::uint32_t;
+
+    // Subtrees bigger than this are built by a separate pool task
+    //
+    static constexpr size_type  PAR_BUILD_SIZE { 1UL << 14 };
+
+    // Batches with at least this many queries are run in parallel
+    //
+    static constexpr size_type  PAR_QUERY_SIZE { 4'096 };
+
+    std::vector<value_type> coords_ { };  // n * dim_ in tree order
+    index_vec               ids_ { };     // Tree slot -> build() position
+    std::vector<axis_t>     axes_ { };    // Split axis at each range middle
+    const size_type         dim_;         // Number of dimensions
+    dist_func_t             dist_func_ { };
+
+    struct  SearchState  {
+        size_type   lo;
+        size_type   hi;
+        value_type  bound;  // Lower bound of distance to anything in range
+    };
+
+    void
+    build_range_(const value_type *data,
+                 size_type lo,
+                 size_type hi,
+                 bool parallel);
+
+    // Distance, or squared distance for the in-place Euclidean distance
+    //
+    [[nodiscard]] value_type
+    dist_(const value_type *target,
+          size_type slot,
+          point_t &target_pt,
+          point_t &slot_pt) const;
+
+    [[nodiscard]] value_type
+    axis_bound_(value_type diff) const;
+
+    void
+    k_nearest_(const value_type *target,
+               size_type k,
+               neighbors_vec &heap,
+               point_t &target_pt,
+               point_t &slot_pt) const;
+};
+
 } // namespace hmdf
 
 // ----------------------------------------------------------------------------
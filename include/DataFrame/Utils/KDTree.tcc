@@ -30,12 +30,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <DataFrame/DataFrameTypes.h>
+#include <DataFrame/Utils/Threads/ThreadGranularity.h>
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <functional>
+#include <future>
 #include <limits>
+#include <numeric>
 #include <queue>
 #include <stack>
 #include <vector>
@@ -728,6 +732,511 @@ range_search_(const point_t &lower, const point_t &upper) const  {
     return (result);
 }
 
+// ----------------------------------------------------------------------------
+// ----------------------------------------------------------------------------
+
+template<typename T>
+FlatKDTree<T>::FlatKDTree(size_type dim) : dim_(dim)  {   }
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+FlatKDTree<T>::FlatKDTree(size_type dim, dist_func_t &&dist_func)
+    : dim_(dim), dist_func_(dist_func)  {   }
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+void FlatKDTree<T>::
+build(const value_type *data, size_type n)  {
+
+    const bool  parallel {
+        n >= PAR_BUILD_SIZE && ThreadGranularity::get_thread_level() > 2
+    };
+
+    ids_.resize(n);
+    std::iota(ids_.begin(), ids_.end(), size_type(0));
+    axes_.assign(n, 0);
+    coords_.resize(n * dim_);
+    if (n == 0 || dim_ == 0)  return;
+
+    build_range_(data, 0, n, parallel);
+
+    // Copy the points in tree order, so every subtree is one contiguous
+    // block of memory
+    //
+    auto    lbd =
+        [this, data](size_type begin, size_type end) -> void  {
+            for (size_type slot { begin }; slot < end; ++slot)
+                std::copy_n(data + ids_[slot] * dim_, dim_,
+                            coords_.data() + slot * dim_);
+        };
+
+    if (parallel)  {
+        auto    futures =
+            ThreadGranularity::thr_pool_.parallel_loop<value_type>(
+                size_type(0), n, std::move(lbd));
+
+        for (auto &fut : futures)  fut.get();
+    }
+    else  {
+        lbd(size_type(0), n);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+void FlatKDTree<T>::
+build(const points_vec &points)  {
+
+#ifdef HMDF_SANITY_EXCEPTIONS
+    for (const auto &vec : points)
+        if (vec.size() != dim_)
+            throw DataFrameError("FlatKDTree<T>::build(): "
+                                 "All data vectors must have exactly "
+                                 "K datapoints");
+#endif // HMDF_SANITY_EXCEPTIONS
+
+    std::vector<value_type> data;
+
+    data.reserve(points.size() * dim_);
+    for (const auto &vec : points)
+        data.insert(data.end(), vec.begin(), vec.begin() + dim_);
+    build(data.data(), points.size());
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+void FlatKDTree<T>::
+build_range_(const value_type *data,
+             size_type lo,
+             size_type hi,
+             bool parallel)  {
+
+    using future_t = std::future<void>;
+
+    std::vector<future_t>   futures;
+
+    // Recurse into the left half and loop on the right half
+    //
+    while ((hi - lo) > LEAF_SIZE)  {
+        size_type   axis { 0 };
+        value_type  max_spread { 0 };
+
+        for (size_type d { 0 }; d < dim_; ++d)  {
+            value_type  min_v { data[ids_[lo] * dim_ + d] };
+            value_type  max_v { min_v };
+
+            for (size_type i { lo + 1 }; i < hi; ++i)  {
+                const value_type    v { data[ids_[i] * dim_ + d] };
+
+                if (v < min_v)  min_v = v;
+                else if (v > max_v)  max_v = v;
+            }
+            if ((max_v - min_v) > max_spread)  {
+                max_spread = max_v - min_v;
+                axis = d;
+            }
+        }
+
+        const size_type mid { lo + (hi - lo) / 2 };
+
+        std::nth_element(ids_.begin() + lo,
+                         ids_.begin() + mid,
+                         ids_.begin() + hi,
+                         [data, axis, dim = dim_]
+                         (size_type lhs, size_type rhs) -> bool  {
+                             const value_type   lv { data[lhs * dim + axis] };
+                             const value_type   rv { data[rhs * dim + axis] };
+
+                             return (lv < rv || (lv == rv && lhs < rhs));
+                         });
+        axes_[mid] = axis_t(axis);
+
+        if (parallel && (mid - lo) >= PAR_BUILD_SIZE)
+            futures.push_back(
+                ThreadGranularity::thr_pool_.dispatch(
+                    false,
+                    [this, data, lo, mid]() -> void  {
+                        build_range_(data, lo, mid, true);
+                    }));
+        else
+            build_range_(data, lo, mid, parallel);
+        lo = mid + 1;
+    }
+
+    for (auto &fut : futures)  {
+        while (fut.wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::timeout)
+            ThreadGranularity::thr_pool_.run_task();
+        fut.get();
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::value_type FlatKDTree<T>::
+dist_(const value_type *target,
+      size_type slot,
+      point_t &target_pt,
+      point_t &slot_pt) const  {
+
+    const value_type    *point { coords_.data() + slot * dim_ };
+
+    if (! dist_func_)  {
+        value_type  sum { 0 };
+
+        for (size_type i { 0 }; i < dim_; ++i)  {
+            const value_type    diff { point[i] - target[i] };
+
+            sum += diff * diff;
+        }
+        return (sum);
+    }
+
+    std::copy_n(point, dim_, slot_pt.begin());
+    return (dist_func_(slot_pt, target_pt));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::value_type FlatKDTree<T>::
+axis_bound_(value_type diff) const  {
+
+    return (dist_func_ ? value_type(std::abs(diff)) : diff * diff);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+void FlatKDTree<T>::
+k_nearest_(const value_type *target,
+           size_type k,
+           neighbors_vec &heap,
+           point_t &target_pt,
+           point_t &slot_pt) const  {
+
+    heap.clear();
+    if (k == 0 || ids_.empty())  return;
+    if (dist_func_)  std::copy_n(target, dim_, target_pt.begin());
+
+    // heap is a max-heap on (distance, index), so heap.front() is the
+    // neighbor to be replaced next
+    //
+    auto                        visit =
+        [&](size_type slot) -> void  {
+            const neighbor_t    cand {
+                dist_(target, slot, target_pt, slot_pt), ids_[slot]
+            };
+
+            if (heap.size() < k)  {
+                heap.push_back(cand);
+                std::push_heap(heap.begin(), heap.end());
+            }
+            else if (cand < heap.front())  {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = cand;
+                std::push_heap(heap.begin(), heap.end());
+            }
+        };
+    std::vector<SearchState>    stack;
+
+    stack.reserve(64);
+    stack.push_back({ 0, ids_.size(), 0 });
+    while (! stack.empty())  {
+        const SearchState   state { stack.back() };
+
+        stack.pop_back();
+
+        // A tie with the current worst may still win on index
+        //
+        if (heap.size() == k && state.bound > heap.front().first)  continue;
+
+        if ((state.hi - state.lo) <= LEAF_SIZE)  {
+            for (size_type slot { state.lo }; slot < state.hi; ++slot)
+                visit(slot);
+            continue;
+        }
+
+        const size_type     mid { state.lo + (state.hi - state.lo) / 2 };
+        const size_type     axis { axes_[mid] };
+        const value_type    diff {
+            target[axis] - coords_[mid * dim_ + axis]
+        };
+        const value_type    far_bound {
+            std::max(state.bound, axis_bound_(diff))
+        };
+
+        visit(mid);
+
+        // Push far side first, so near side is explored first
+        //
+        if (diff < 0)  {
+            stack.push_back({ mid + 1, state.hi, far_bound });
+            stack.push_back({ state.lo, mid, state.bound });
+        }
+        else  {
+            stack.push_back({ state.lo, mid, far_bound });
+            stack.push_back({ mid + 1, state.hi, state.bound });
+        }
+    }
+
+    std::sort_heap(heap.begin(), heap.end());
+    if (! dist_func_)
+        for (auto &item : heap)  item.first = std::sqrt(item.first);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::neighbors_vec FlatKDTree<T>::
+find_k_nearest(const value_type *target, size_type k) const  {
+
+    neighbors_vec   result;
+    point_t         target_pt(dim_);
+    point_t         slot_pt(dim_);
+
+    result.reserve(std::min(k, ids_.size()));
+    k_nearest_(target, k, result, target_pt, slot_pt);
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::neighbors_vec FlatKDTree<T>::
+find_k_nearest(const point_t &target, size_type k) const  {
+
+    return (find_k_nearest(target.data(), k));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::neighbors_vec FlatKDTree<T>::
+find_k_nearest(const value_type *targets,
+               size_type n_targets,
+               size_type k) const  {
+
+    const size_type kk { std::min(k, ids_.size()) };
+    neighbors_vec   result(n_targets * kk);
+
+    if (kk == 0)  return (result);
+
+    auto    lbd =
+        [this, targets, kk, &result](size_type begin, size_type end) -> void  {
+            neighbors_vec   heap;
+            point_t         target_pt(dim_);
+            point_t         slot_pt(dim_);
+
+            heap.reserve(kk);
+            for (size_type i { begin }; i < end; ++i)  {
+                k_nearest_(targets + i * dim_, kk, heap, target_pt, slot_pt);
+                std::copy(heap.begin(), heap.end(), result.begin() + i * kk);
+            }
+        };
+
+    if (n_targets >= PAR_QUERY_SIZE &&
+        ThreadGranularity::get_thread_level() > 2)  {
+        auto    futures =
+            ThreadGranularity::thr_pool_.parallel_loop<neighbor_t>(
+                size_type(0), n_targets, std::move(lbd));
+
+        for (auto &fut : futures)  fut.get();
+    }
+    else  {
+        lbd(size_type(0), n_targets);
+    }
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::neighbors_vec FlatKDTree<T>::
+all_k_nearest(size_type k) const  {
+
+    const size_type n { ids_.size() };
+    const size_type kk { std::min(k, n) };
+    neighbors_vec   result(n * kk);
+
+    if (kk == 0)  return (result);
+
+    // Targets are visited in tree order, because neighboring slots have
+    // mostly the same neighbors
+    //
+    auto    lbd =
+        [this, kk, &result](size_type begin, size_type end) -> void  {
+            neighbors_vec   heap;
+            point_t         target_pt(dim_);
+            point_t         slot_pt(dim_);
+
+            heap.reserve(kk);
+            for (size_type slot { begin }; slot < end; ++slot)  {
+                k_nearest_(coords_.data() + slot * dim_, kk, heap,
+                           target_pt, slot_pt);
+                std::copy(heap.begin(), heap.end(),
+                          result.begin() + ids_[slot] * kk);
+            }
+        };
+
+    if (n >= PAR_QUERY_SIZE && ThreadGranularity::get_thread_level() > 2)  {
+        auto    futures =
+            ThreadGranularity::thr_pool_.parallel_loop<neighbor_t>(
+                size_type(0), n, std::move(lbd));
+
+        for (auto &fut : futures)  fut.get();
+    }
+    else  {
+        lbd(size_type(0), n);
+    }
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::neighbors_vec FlatKDTree<T>::
+find_within(const value_type *target, value_type radius) const  {
+
+    neighbors_vec   result;
+
+    if (ids_.empty())  return (result);
+
+    point_t                     target_pt(dim_);
+    point_t                     slot_pt(dim_);
+    const auto                  to_dist =
+        [this](value_type d) -> value_type  {
+            return (dist_func_ ? d : value_type(std::sqrt(d)));
+        };
+    const auto                  visit =
+        [&](size_type slot) -> void  {
+            const value_type    d {
+                to_dist(dist_(target, slot, target_pt, slot_pt))
+            };
+
+            if (d <= radius)  result.push_back({ d, ids_[slot] });
+        };
+    std::vector<SearchState>    stack;
+
+    if (dist_func_)  std::copy_n(target, dim_, target_pt.begin());
+    stack.reserve(64);
+    stack.push_back({ 0, ids_.size(), 0 });
+    while (! stack.empty())  {
+        const SearchState   state { stack.back() };
+
+        stack.pop_back();
+        if (to_dist(state.bound) > radius)  continue;
+
+        if ((state.hi - state.lo) <= LEAF_SIZE)  {
+            for (size_type slot { state.lo }; slot < state.hi; ++slot)
+                visit(slot);
+            continue;
+        }
+
+        const size_type     mid { state.lo + (state.hi - state.lo) / 2 };
+        const size_type     axis { axes_[mid] };
+        const value_type    diff {
+            target[axis] - coords_[mid * dim_ + axis]
+        };
+        const value_type    far_bound {
+            std::max(state.bound, axis_bound_(diff))
+        };
+
+        visit(mid);
+        if (diff < 0)  {
+            stack.push_back({ mid + 1, state.hi, far_bound });
+            stack.push_back({ state.lo, mid, state.bound });
+        }
+        else  {
+            stack.push_back({ state.lo, mid, far_bound });
+            stack.push_back({ mid + 1, state.hi, state.bound });
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::neighbors_vec FlatKDTree<T>::
+find_within(const point_t &target, value_type radius) const  {
+
+    return (find_within(target.data(), radius));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::index_vec FlatKDTree<T>::
+find_in_range(const point_t &lower, const point_t &upper) const  {
+
+    index_vec   result;
+
+    if (ids_.empty())  return (result);
+
+    const auto                  in_range =
+        [this, &lower, &upper](size_type slot) -> bool  {
+            const value_type    *point { coords_.data() + slot * dim_ };
+
+            for (size_type i { 0 }; i < dim_; ++i)
+                if (point[i] < lower[i] || point[i] > upper[i])
+                    return (false);
+            return (true);
+        };
+    std::vector<SearchState>    stack;
+
+    stack.reserve(64);
+    stack.push_back({ 0, ids_.size(), 0 });
+    while (! stack.empty())  {
+        const SearchState   state { stack.back() };
+
+        stack.pop_back();
+        if ((state.hi - state.lo) <= LEAF_SIZE)  {
+            for (size_type slot { state.lo }; slot < state.hi; ++slot)
+                if (in_range(slot))  result.push_back(ids_[slot]);
+            continue;
+        }
+
+        const size_type     mid { state.lo + (state.hi - state.lo) / 2 };
+        const size_type     axis { axes_[mid] };
+        const value_type    split { coords_[mid * dim_ + axis] };
+
+        if (in_range(mid))  result.push_back(ids_[mid]);
+        if (lower[axis] <= split)
+            stack.push_back({ state.lo, mid, 0 });
+        if (upper[axis] >= split)
+            stack.push_back({ mid + 1, state.hi, 0 });
+    }
+
+    std::sort(result.begin(), result.end());
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+bool FlatKDTree<T>::
+empty() const  { return (ids_.empty()); }
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::size_type FlatKDTree<T>::
+size() const  { return (ids_.size()); }
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename FlatKDTree<T>::size_type FlatKDTree<T>::
+dim() const  { return (dim_); }
+
 } // namespace hmdf
 
 // ----------------------------------------------------------------------------
@@ -588,6 +588,16 @@ private:
             size_type self_rows,
             size_type self_cols) noexcept;
 
+    // Runs func(begin, end) over [begin, end) on the thread pool, if work
+    // (roughly the number of scalar operations in the whole range) is large
+    // enough to pay for dispatching it. Otherwise it runs func inline.
+    // It is used for the independent column/row updates of the Householder
+    // reductions below.
+    //
+    template<typename F>
+    static inline void
+    par_loop_(size_type begin, size_type end, size_type work, F &&func);
+
     // Symmetric Householder reduction to tridiagonal form.
     //
     // This is derived from the Algol procedures tred2 by Bowdler, Martin,
@@ -1597,7 +1607,9 @@ operator * (const Matrix<T, MO, IS_SYM> &lhs, const std::vector<T> &rhs);
 // -------------------------------------
 
 // Matrix * Matrix
-// Naïve but cache friendly and multi-threaded O(n^3) algorithm
+// Packed-panel, register-blocked and multi-threaded O(n^3) algorithm.
+// Panels of both operands are copied into contiguous buffers, so the speed
+// doesn't depend on the orientation of either matrix.
 //
 template<typename T, matrix_orient MO1, matrix_orient MO2,
          bool IS_SYM1, bool IS_SYM2>
@@ -531,6 +531,29 @@ ppivot_(size_type pivot_row,
 
 // ----------------------------------------------------------------------------
 
+template<typename T,  matrix_orient MO, bool IS_SYM>
+template<typename F>
+inline void Matrix<T, MO, IS_SYM>::
+par_loop_(size_type begin, size_type end, size_type work, F &&func)  {
+
+    const long  thread_level =
+        (work >= 250'000L && (end - begin) > 1)
+            ? ThreadGranularity::get_thread_level() : 0;
+
+    if (thread_level > 2)  {
+        auto    futures =
+            ThreadGranularity::thr_pool_.parallel_loop<value_type>(
+                begin, end, std::forward<F>(func));
+
+        for (auto &fut : futures)  fut.get();
+    }
+    else  {
+        func(begin, end);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename T,  matrix_orient MO, bool IS_SYM>
 Matrix<T, MO, IS_SYM>
 Matrix<T, MO, IS_SYM>::inverse() const  {
@@ -567,16 +590,48 @@ Matrix<T, MO, IS_SYM>::inverse() const  {
             result.at(r, c) /= diag;
         }
 
-        for (size_type r2 = 0; r2 < self_rows; ++r2)  {
-            if (r2 != r)  {
-                const value_type    off_diag = aux_mat.at(r2, r);
+        // Row r is fixed from here on, so the other rows are independent.
+        // In column-major the row operations are done column by column, so
+        // the inner loop is contiguous.
+        //
+        auto    lbd =
+            [r, self_cols, &aux_mat, &result](auto begin, auto end) -> void  {
+                if constexpr (MO == matrix_orient::column_major)  {
+                    std::vector<value_type> off_diag(end - begin);
+
+                    for (size_type r2 = begin; r2 < end; ++r2)
+                        off_diag[r2 - begin] =
+                            r2 != r ? aux_mat.at(r2, r) : value_type(0);
+
+                    for (size_type c = 0; c < self_cols; ++c)  {
+                        const value_type    aux_val = aux_mat.at(r, c);
+                        const value_type    res_val = result.at(r, c);
+
+                        for (size_type r2 = begin; r2 < end; ++r2)  {
+                            const value_type    val = off_diag[r2 - begin];
 
-                for (size_type c = 0; c < self_cols; ++c)  {
-                    aux_mat.at(r2, c) -= off_diag * aux_mat.at(r, c);
-                    result.at(r2, c) -= off_diag * result.at(r, c);
+                            aux_mat.at(r2, c) -= val * aux_val;
+                            result.at(r2, c) -= val * res_val;
+                        }
+                    }
                 }
-            }
-        }
+                else  {
+                    for (size_type r2 = begin; r2 < end; ++r2)  {
+                        if (r2 != r)  {
+                            const value_type    off_diag = aux_mat.at(r2, r);
+
+                            for (size_type c = 0; c < self_cols; ++c)  {
+                                aux_mat.at(r2, c) -=
+                                    off_diag * aux_mat.at(r, c);
+                                result.at(r2, c) -=
+                                    off_diag * result.at(r, c);
+                            }
+                        }
+                    }
+                }
+            };
+
+        par_loop_(0L, self_rows, self_rows * self_cols * 4L, std::move(lbd));
     }
 
     return (result);
@@ -1550,11 +1605,21 @@ tridiagonalize_(MA1 &e_vecs, MA2 &e_vals, MA3 &imagi) noexcept  {
             for (size_type c = 0; c < r; ++c)
                 imagi(0, c) -= hh * e_vals(0, c);
 
+            // Columns are independent in the rank-2 update, as long as
+            // e_vals is not overwritten until all of them are done
+            //
+            auto    update_lbd =
+                [r, &e_vecs, &e_vals = std::as_const(e_vals),
+                 &imagi = std::as_const(imagi)]
+                (auto begin, auto end) -> void  {
+                    for (size_type c = begin; c < end; ++c)
+                        for (size_type cc = c; cc <= r - 1; ++cc)
+                            e_vecs(cc, c) -= e_vals(0, c) * imagi(0, cc) +
+                                             imagi(0, c) * e_vals(0, cc);
+                };
+
+            par_loop_(0L, r, r * r * 2L, std::move(update_lbd));
             for (size_type c = 0; c < r; ++c)  {
-                for (size_type cc = c; cc <= r - 1; ++cc)
-                    e_vecs(cc, c) -= e_vals(0, c) * imagi(0, cc) +
-                                     imagi(0, c) * e_vals(0, cc);
-
                 e_vals(0, c) = e_vecs(r - 1, c);
                 e_vecs(r, c) = 0;
             }
@@ -1575,15 +1640,21 @@ tridiagonalize_(MA1 &e_vecs, MA2 &e_vals, MA3 &imagi) noexcept  {
             for (size_type c = 0; c <= r; ++c)
                 e_vals(0, c) = e_vecs(c, r + 1) / h;
 
-            for (size_type c = 0; c <= r; ++c)  {
-                value_type  g { 0 };
+            auto    lbd =
+                [r, &e_vecs, &e_vals = std::as_const(e_vals)]
+                (auto begin, auto end) -> void  {
+                    for (size_type c = begin; c < end; ++c)  {
+                        value_type  g { 0 };
 
-                for (size_type rr = 0; rr <= r; ++rr)
-                    g += e_vecs(rr, r + 1) * e_vecs(rr, c);
+                        for (size_type rr = 0; rr <= r; ++rr)
+                            g += e_vecs(rr, r + 1) * e_vecs(rr, c);
 
-                for (size_type rr = 0; rr <= r; ++rr)
-                    e_vecs(rr, c) -= g * e_vals(0, rr);
-            }
+                        for (size_type rr = 0; rr <= r; ++rr)
+                            e_vecs(rr, c) -= g * e_vals(0, rr);
+                    }
+                };
+
+            par_loop_(0L, r + 1, (r + 1) * (r + 1) * 4L, std::move(lbd));
         }
         for (size_type rr = 0; rr <= r; ++rr)
             e_vecs(rr, r + 1) = 0;
@@ -1975,26 +2046,35 @@ svd(MA1 &U, MA2 &S, MA3 &V, bool full_size) const  {
             }
             s_tmp[c] = -s_tmp[c];
         }
-        for (size_type cc = c + 1; cc < cols(); ++cc)  {
-            if (c < min_col_cnt && s_tmp[c] != T(0))  {
-                // Apply the transformation.
-                //
-                value_type  t { 0 };
+        // Columns to the right of c are independent of each other
+        //
+        const bool  apply_col { c < min_col_cnt && s_tmp[c] != T(0) };
+        auto        col_lbd =
+            [this, c, apply_col, &self_tmp, &imagi]
+            (auto begin, auto end) -> void  {
+                for (size_type cc = begin; cc < end; ++cc)  {
+                    if (apply_col)  {
+                        // Apply the transformation.
+                        //
+                        value_type  t { 0 };
 
-                for (size_type r = c; r < rows(); ++r)
-                    t += self_tmp(r, c) * self_tmp(r, cc);
+                        for (size_type r = c; r < rows(); ++r)
+                            t += self_tmp(r, c) * self_tmp(r, cc);
 
-                t /= -self_tmp(c, c);
-                for (size_type r = c; r < rows(); ++r)
-                    self_tmp(r, cc) += t * self_tmp(r, c);
+                        t /= -self_tmp(c, c);
+                        for (size_type r = c; r < rows(); ++r)
+                            self_tmp(r, cc) += t * self_tmp(r, c);
+                    }
 
-            }
+                    // Place the k-th row of A into e for the
+                    // subsequent calculation of the row transformation.
+                    //
+                    imagi(0, cc) = self_tmp(c, cc);
+                }
+            };
 
-            // Place the k-th row of A into e for the
-            // subsequent calculation of the row transformation.
-            //
-            imagi(0, cc) = self_tmp(c, cc);
-        }
+        par_loop_(c + 1, cols(),
+                  (rows() - c) * (cols() - c) * 4L, std::move(col_lbd));
         if (c < min_col_cnt)
             // Place the transformation in U for subsequent back
             // multiplication.
@@ -2027,19 +2107,35 @@ svd(MA1 &U, MA2 &S, MA3 &V, bool full_size) const  {
 
                 // Apply the transformation.
                 //
-                for (size_type r = c + 1; r < rows(); ++r)
-                    sandbox[r] = 0;
-
-                for (size_type cc = c + 1; cc < cols(); ++cc)
-                    for (size_type r = c + 1; r < rows(); ++r)
-                        sandbox[r] += imagi(0, cc) * self_tmp(r, cc);
-
-                for (size_type cc = c + 1; cc < cols(); ++cc)  {
-                    const value_type    t { -imagi(0, cc) / imagi(0, c + 1) };
+                const size_type work { (rows() - c) * (cols() - c) * 2L };
+                auto            sandbox_lbd =
+                    [this, c, &sandbox, &self_tmp = std::as_const(self_tmp),
+                     &imagi = std::as_const(imagi)]
+                    (auto begin, auto end) -> void  {
+                        for (size_type r = begin; r < end; ++r)
+                            sandbox[r] = 0;
+
+                        for (size_type cc = c + 1; cc < cols(); ++cc)
+                            for (size_type r = begin; r < end; ++r)
+                                sandbox[r] += imagi(0, cc) * self_tmp(r, cc);
+                    };
+
+                par_loop_(c + 1, rows(), work, std::move(sandbox_lbd));
+
+                auto    row_lbd =
+                    [this, c, &sandbox = std::as_const(sandbox), &self_tmp,
+                     &imagi = std::as_const(imagi)]
+                    (auto begin, auto end) -> void  {
+                        for (size_type cc = begin; cc < end; ++cc)  {
+                            const value_type    t {
+                                -imagi(0, cc) / imagi(0, c + 1) };
+
+                            for (size_type r = c + 1; r < rows(); ++r)
+                                self_tmp(r, cc) += t * sandbox[r];
+                        }
+                    };
 
-                    for (size_type r = c + 1; r < rows(); ++r)
-                        self_tmp(r, cc) += t * sandbox[r];
-                }
+                par_loop_(c + 1, cols(), work, std::move(row_lbd));
             }
 
             // Place the transformation in V for subsequent
@@ -2073,16 +2169,22 @@ svd(MA1 &U, MA2 &S, MA3 &V, bool full_size) const  {
 
     for (size_type c = min_col_cnt - 1; c >= 0; --c)  {
         if (s_tmp[c] != T(0))  {
-            for (size_type cc = c + 1; cc < min_dem; ++cc)  {
-                value_type  t { 0 };
+            auto    lbd =
+                [this, c, &u_tmp](auto begin, auto end) -> void  {
+                    for (size_type cc = begin; cc < end; ++cc)  {
+                        value_type  t { 0 };
 
-                for (size_type r = c; r < rows(); ++r)
-                    t += u_tmp(r, c) * u_tmp(r, cc);
+                        for (size_type r = c; r < rows(); ++r)
+                            t += u_tmp(r, c) * u_tmp(r, cc);
 
-                t /= -u_tmp(c, c);
-                for (size_type r = c; r < rows(); ++r)
-                    u_tmp(r, cc) += t * u_tmp(r, c);
-            }
+                        t /= -u_tmp(c, c);
+                        for (size_type r = c; r < rows(); ++r)
+                            u_tmp(r, cc) += t * u_tmp(r, c);
+                    }
+                };
+
+            par_loop_(c + 1, min_dem,
+                      (rows() - c) * (min_dem - c) * 4L, std::move(lbd));
             for (size_type r = c; r < rows(); ++r )
                 u_tmp(r, c) = -u_tmp(r, c);
 
@@ -2098,17 +2200,24 @@ svd(MA1 &U, MA2 &S, MA3 &V, bool full_size) const  {
     }
 
     for (size_type c = cols() - 1; c >= 0; --c)  {
-        if ((c < max_row_cnt) && (imagi(0, c) != T(0)))
-            for (size_type cc = c + 1; cc < min_dem; ++cc)  {
-                value_type  t { 0 };
-
-                for (size_type r = c + 1; r < cols(); ++r)
-                    t += v_tmp(r, c) * v_tmp(r, cc);
+        if ((c < max_row_cnt) && (imagi(0, c) != T(0)))  {
+            auto    lbd =
+                [this, c, &v_tmp](auto begin, auto end) -> void  {
+                    for (size_type cc = begin; cc < end; ++cc)  {
+                        value_type  t { 0 };
+
+                        for (size_type r = c + 1; r < cols(); ++r)
+                            t += v_tmp(r, c) * v_tmp(r, cc);
+
+                        t /= -v_tmp(c + 1, c);
+                        for (size_type r = c + 1; r < cols(); ++r)
+                            v_tmp(r, cc) += t * v_tmp(r, c);
+                    }
+                };
 
-                t /= -v_tmp(c + 1, c);
-                for (size_type r = c + 1; r < cols(); ++r)
-                    v_tmp(r, cc) += t * v_tmp(r, c);
-            }
+            par_loop_(c + 1, min_dem,
+                      (cols() - c) * (min_dem - c) * 4L, std::move(lbd));
+        }
 
         for (size_type r = 0; r < cols(); ++r)
             v_tmp(r, c) = 0;
@@ -4166,105 +4275,202 @@ operator * (const Matrix<T, MO, IS_SYM> &lhs,
 
 // ----------------------------------------------------------------------------
 
-// Naïve but cache friendly O(n^3) algorithm
+// Packed-panel GEMM kernel for Matrix * Matrix.
 //
-template<typename T, matrix_orient MO1, matrix_orient MO2,
-         bool IS_SYM1, bool IS_SYM2>
-static Matrix<T, MO1, false>
-operator * (const Matrix<T, MO1, IS_SYM1> &lhs,
-            const Matrix<T, MO2, IS_SYM2> &rhs)  {
+// The product is computed in NC wide column panels of rhs and KC deep slices
+// of the inner dimension. Each slice of rhs is packed once into NR wide
+// micro-panels. Each MC tall block of lhs is packed into MR tall micro-panels
+// by the thread that consumes it. The micro-kernel then keeps an MR x NR tile
+// of the result in registers for the whole KC loop. This way every operand is
+// read with unit stride regardless of the orientation of either matrix.
+//
+// The register tile height is two SIMD vectors of the widest instruction set
+// the translation unit is compiled for, so the fixed size inner loops below
+// are vectorized and fully unrolled by the compiler.
+//
+#if defined(__AVX512F__)
+static constexpr long   HMDF_MAT_SIMD_BYTES = 64;
+#elif defined(__AVX__)
+static constexpr long   HMDF_MAT_SIMD_BYTES = 32;
+#else
+static constexpr long   HMDF_MAT_SIMD_BYTES = 16;
+#endif // __AVX512F__
+
+template<typename T>
+struct  _gemm_tile_  {
+
+    // Micro-tile rows and columns
+    //
+    static constexpr long   MR =
+        std::max(2L * HMDF_MAT_SIMD_BYTES / long(sizeof(T)), 2L);
+    static constexpr long   NR = HMDF_MAT_SIMD_BYTES > 16 ? 6L : 4L;
 
-    const long  lhs_rows { lhs.rows() };
-    const long  lhs_cols { lhs.cols() };
-    const long  rhs_cols { rhs.cols() };
+    // Panel sizes, so a KC x NR slice of rhs stays in L1 and an MC x KC
+    // block of lhs stays in L2
+    //
+    static constexpr long   KC = 256;
+    static constexpr long   MC =
+        std::max((128L * 1024L / (KC * long(sizeof(T)))) / MR, 1L) * MR;
+    static constexpr long   NC = 4096;
+};
 
-#ifdef HMDF_SANITY_EXCEPTIONS
-    if (lhs_cols != rhs.rows())
-        throw NotFeasible("Incompatible matrix * matrix operation");
-#endif // HMDF_SANITY_EXCEPTIONS
+// ----------------------------------------------------------------------------
 
-    Matrix<T, MO1, false>   result { lhs_rows, rhs_cols, 0 };
-    const long              thread_level =
-        (lhs_cols >= 600L || rhs_cols >= 600L)
-            ? ThreadGranularity::get_thread_level() : 0;
+template<typename T>
+static inline void
+_gemm_micro_kernel_(long kc, const T *a, const T *b, T *tile) noexcept  {
 
-    auto    col_lbd =
-        [lhs_rows, lhs_cols, &result,
-         &lhs = std::as_const(lhs), &rhs = std::as_const(rhs)]
-        (auto begin, auto end) -> void  {
-            for (long rc = begin; rc < end; rc += HMDF_MAT_BLOCK) {
-                for (long lc = 0; lc < lhs_cols; lc += HMDF_MAT_BLOCK) {
-                    for (long r = 0; r < lhs_rows; r += HMDF_MAT_BLOCK) {
-                        const long  r_max =
-                            std::min(r + HMDF_MAT_BLOCK, lhs_rows);
-                        const long  rc_max =
-                            std::min(rc + HMDF_MAT_BLOCK, end);
-                        const long  lc_max =
-                            std::min(lc + HMDF_MAT_BLOCK, lhs_cols);
-
-                        for (long rr = rc; rr < rc_max; ++rr) {
-                            for (long cc = lc; cc < lc_max; ++cc) {
-                                const T val = rhs(cc, rr);
+    constexpr long  MR = _gemm_tile_<T>::MR;
+    constexpr long  NR = _gemm_tile_<T>::NR;
+    T               acc[NR][MR] { };
+
+    for (long k = 0; k < kc; ++k, a += MR, b += NR)  {
+        for (long j = 0; j < NR; ++j)  {
+            const T bv = b[j];
 
 #pragma GCC ivdep
 #pragma clang loop vectorize(enable)
 #pragma omp simd
-                                for (long i = r; i < r_max; ++i)
-                                    result(i, rr) += lhs(i, cc) * val;
-                            }
-                        }
-                    }
+            for (long i = 0; i < MR; ++i)
+                acc[j][i] += a[i] * bv;
+        }
+    }
+    for (long j = 0; j < NR; ++j)
+        for (long i = 0; i < MR; ++i)
+            tile[j * MR + i] = acc[j][i];
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T, matrix_orient MO1, matrix_orient MO2,
+         bool IS_SYM1, bool IS_SYM2>
+static void
+_gemm_packed_(const Matrix<T, MO1, IS_SYM1> &lhs,
+              const Matrix<T, MO2, IS_SYM2> &rhs,
+              Matrix<T, MO1, false> &result,
+              long thread_level)  {
+
+    using tile_t = _gemm_tile_<T>;
+
+    static constexpr long   MR = tile_t::MR;
+    static constexpr long   NR = tile_t::NR;
+
+    const long      lhs_rows { lhs.rows() };
+    const long      lhs_cols { lhs.cols() };
+    const long      rhs_cols { rhs.cols() };
+    std::vector<T>  b_pack;
+
+    for (long jc = 0; jc < rhs_cols; jc += tile_t::NC)  {
+        const long  nc { std::min(tile_t::NC, rhs_cols - jc) };
+
+        for (long pc = 0; pc < lhs_cols; pc += tile_t::KC)  {
+            const long  kc { std::min(tile_t::KC, lhs_cols - pc) };
+
+            // Pack the kc x nc slice of rhs into NR wide micro-panels.
+            // The last micro-panel is padded with zeros.
+            //
+            b_pack.resize(((nc + NR - 1) / NR) * NR * kc);
+            for (long jr = 0; jr < nc; jr += NR)  {
+                const long  nr { std::min(NR, nc - jr) };
+                T           *bp { b_pack.data() + jr * kc };
+
+                for (long k = 0; k < kc; ++k, bp += NR)  {
+                    long    j { 0 };
+
+                    for (; j < nr; ++j)
+                        bp[j] = rhs(pc + k, jc + jr + j);
+                    for (; j < NR; ++j)
+                        bp[j] = T { };
                 }
             }
-        };
-    auto    row_lbd =
-        [lhs_cols, rhs_cols, &result,
-         &lhs = std::as_const(lhs), &rhs = std::as_const(rhs)]
-        (auto begin, auto end) -> void  {
-            for (long r = begin; r < end; r += HMDF_MAT_BLOCK) {
-                for (long c = 0; c < rhs_cols; c += HMDF_MAT_BLOCK) {
-                    for (long k = 0; k < lhs_cols; k += HMDF_MAT_BLOCK) {
-                        const long  r_max = std::min(r + HMDF_MAT_BLOCK, end);
-                        const long  c_max =
-                            std::min(c + HMDF_MAT_BLOCK, rhs_cols);
-                        const long  k_max =
-                            std::min(k + HMDF_MAT_BLOCK, lhs_cols);
-
-                        for (long rr = r; rr < r_max; ++rr) {
-                            for (long kk = k; kk < k_max; ++kk) {
-                                const T val = lhs(rr, kk);
 
-#pragma GCC ivdep
-#pragma clang loop vectorize(enable)
-#pragma omp simd
-                                for (long j = c; j < c_max; ++j)
-                                    result(rr, j) += val * rhs(kk, j);
+            // Each task takes a range of lhs rows, in MC tall blocks
+            //
+            auto    lbd =
+                [&lhs = std::as_const(lhs), &result,
+                 &b_pack = std::as_const(b_pack), jc, pc, nc, kc]
+                (auto begin, auto end) -> void  {
+                    std::vector<T>  a_pack(tile_t::MC * kc);
+                    T               tile[MR * NR];
+
+                    for (long ic = begin; ic < end; ic += tile_t::MC)  {
+                        const long  mc { std::min(tile_t::MC, end - ic) };
+
+                        // Pack the mc x kc block of lhs into MR tall
+                        // micro-panels. The last micro-panel is padded with
+                        // zeros.
+                        //
+                        for (long ir = 0; ir < mc; ir += MR)  {
+                            const long  mr { std::min(MR, mc - ir) };
+                            T           *ap { a_pack.data() + ir * kc };
+
+                            for (long k = 0; k < kc; ++k, ap += MR)  {
+                                long    i { 0 };
+
+                                for (; i < mr; ++i)
+                                    ap[i] = lhs(ic + ir + i, pc + k);
+                                for (; i < MR; ++i)
+                                    ap[i] = T { };
+                            }
+                        }
+
+                        for (long jr = 0; jr < nc; jr += NR)  {
+                            const long  nr { std::min(NR, nc - jr) };
+
+                            for (long ir = 0; ir < mc; ir += MR)  {
+                                const long  mr { std::min(MR, mc - ir) };
+
+                                _gemm_micro_kernel_(kc,
+                                                    a_pack.data() + ir * kc,
+                                                    b_pack.data() + jr * kc,
+                                                    tile);
+                                for (long j = 0; j < nr; ++j)
+                                    for (long i = 0; i < mr; ++i)
+                                        result(ic + ir + i, jc + jr + j) +=
+                                            tile[j * MR + i];
                             }
                         }
                     }
-                }
+                };
+
+            if (thread_level > 2)  {
+                auto    futures =
+                    ThreadGranularity::thr_pool_.parallel_loop<T>(
+                        0L, lhs_rows, std::move(lbd));
+
+                for (auto &fut : futures)  fut.get();
             }
-        };
+            else
+                lbd(0L, lhs_rows);
+        }
+    }
+}
 
-    if (thread_level > 2)  {
-        std::vector<std::future<void>>  futures;
+// ----------------------------------------------------------------------------
 
-        if constexpr (MO1 == matrix_orient::column_major)
-            futures = ThreadGranularity::thr_pool_.parallel_loop<T>(
-                          0L, rhs_cols, std::move(col_lbd));
-        else  // matrix_orient::row_major
-            futures = ThreadGranularity::thr_pool_.parallel_loop<T>(
-                          0L, lhs_rows, std::move(row_lbd));
+// Packed-panel, register-blocked and multi-threaded O(n^3) algorithm
+//
+template<typename T, matrix_orient MO1, matrix_orient MO2,
+         bool IS_SYM1, bool IS_SYM2>
+static Matrix<T, MO1, false>
+operator * (const Matrix<T, MO1, IS_SYM1> &lhs,
+            const Matrix<T, MO2, IS_SYM2> &rhs)  {
 
-        for (auto &fut : futures)  fut.get();
-    }
-    else  {
-        if constexpr (MO1 == matrix_orient::column_major)
-            col_lbd(0L, rhs_cols);
-        else  // matrix_orient::row_major
-            row_lbd(0L, lhs_rows);
-    }
+    const long  lhs_rows { lhs.rows() };
+    const long  lhs_cols { lhs.cols() };
+    const long  rhs_cols { rhs.cols() };
+
+#ifdef HMDF_SANITY_EXCEPTIONS
+    if (lhs_cols != rhs.rows())
+        throw NotFeasible("Incompatible matrix * matrix operation");
+#endif // HMDF_SANITY_EXCEPTIONS
+
+    Matrix<T, MO1, false>   result { lhs_rows, rhs_cols, 0 };
+    const long              thread_level =
+        (lhs_rows >= 600L || lhs_cols >= 600L || rhs_cols >= 600L)
+            ? ThreadGranularity::get_thread_level() : 0;
 
+    _gemm_packed_(lhs, rhs, result, thread_level);
     return (result);
 }
 
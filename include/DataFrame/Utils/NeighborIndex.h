@@ -0,0 +1,571 @@
+// Hossein Moein
+// October 17, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <DataFrame/Utils/Threads/ThreadGranularity.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// Neighbor indices used by the clustering and anomaly visitors in place of
+// scanning the whole column for every point.
+//
+// Both indices copy the data they are built from, so the column may be a
+// view or an iterator over temporaries. They return positions (0-based
+// offsets from the beginning of the column), not values.
+// Radius queries return every point whose Euclidean distance to the target
+// is <= radius, computed in double. A caller with a different formula for
+// the same distance (e.g. squared, or in float) should re-check the
+// returned points with it. Positions are returned in ascending order, so
+// results don't depend on the index layout.
+// k-nearest queries return (distance, position) pairs, nearest first, with
+// ties broken by position.
+
+// ----------------------------------------------------------------------------
+
+// Sorted index over a scalar column.
+// Queries are a binary search plus a walk over the answer, O(log(n) + m).
+//
+template<typename T>
+class   SortedNeighborIndex  {
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using dist_pair_t = std::pair<double, size_type>;
+
+    template<typename H>
+    void
+    build(const H &column_begin, size_type col_s)  {
+
+        std::vector<std::pair<value_type, size_type>>   pairs;
+
+        pairs.reserve(col_s);
+        for (size_type i { 0 }; i < col_s; ++i)
+            pairs.emplace_back(*(column_begin + i), i);
+
+        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
+            ThreadGranularity::get_thread_level() > 2)
+            ThreadGranularity::thr_pool_.parallel_sort(pairs.begin(),
+                                                       pairs.end());
+        else
+            std::sort(pairs.begin(), pairs.end());
+
+        values_.resize(col_s);
+        positions_.resize(col_s);
+        for (size_type i { 0 }; i < col_s; ++i)  {
+            values_[i] = pairs[i].first;
+            positions_[i] = pairs[i].second;
+        }
+    }
+
+    void
+    within(const value_type &target,
+           double radius,
+           std::vector<size_type> &result) const  {
+
+        const double    slack {
+            (std::fabs(double(target)) + radius) *
+            (4.0 * std::numeric_limits<double>::epsilon())
+        };
+        const double    low { double(target) - radius - slack };
+        const double    high { double(target) + radius + slack };
+        auto            iter {
+            std::lower_bound(values_.begin(), values_.end(), low,
+                             [](const value_type &val, double key) -> bool  {
+                                 return (double(val) < key);
+                             })
+        };
+
+        result.clear();
+        for (; iter != values_.end() && double(*iter) <= high; ++iter)
+            if (std::fabs(double(*iter) - double(target)) <= radius)
+                result.push_back(positions_[iter - values_.begin()]);
+        std::sort(result.begin(), result.end());
+    }
+
+    void
+    k_nearest(const value_type &target,
+              size_type k,
+              std::vector<dist_pair_t> &result) const  {
+
+        const long  n { long(values_.size()) };
+        long        right {
+            long(std::lower_bound(values_.begin(), values_.end(), target) -
+                 values_.begin())
+        };
+        long        left { right - 1 };
+        auto        dist =
+            [this, &target](long i) -> double  {
+                return (std::fabs(double(values_[i]) - double(target)));
+            };
+
+        k = std::min(k, size_type(n));
+        result.clear();
+        while (result.size() < k)  {
+            if (right >= n || (left >= 0 && dist(left) <= dist(right)))  {
+                result.emplace_back(dist(left), positions_[left]);
+                left -= 1;
+            }
+            else  {
+                result.emplace_back(dist(right), positions_[right]);
+                right += 1;
+            }
+        }
+
+        // Pick up the points tied with the k'th, so the ties can be
+        // broken by position
+        //
+        if (k > 0)  {
+            const double    kth { result.back().first };
+
+            for (; left >= 0 && dist(left) == kth; --left)
+                result.emplace_back(kth, positions_[left]);
+            for (; right < n && dist(right) == kth; ++right)
+                result.emplace_back(kth, positions_[right]);
+        }
+        std::sort(result.begin(), result.end());
+        result.resize(k);
+    }
+
+    [[nodiscard]] size_type size() const  { return (values_.size()); }
+
+private:
+
+    std::vector<value_type> values_ { };     // Sorted
+    std::vector<size_type>  positions_ { };  // Position of values_[i]
+};
+
+// ----------------------------------------------------------------------------
+
+// Uniform grid over a column of fixed width points, std::vector or
+// std::array of arithmetic values.
+// Points are bucketed by the cube of side cell_size they fall in. Buckets
+// are found through an open-addressing table keyed by the cell
+// coordinates, and the points of a bucket are stored next to each other.
+// A radius query only visits the cells that overlap the radius. A k-nearest
+// query visits rings of cells around the target until the k'th distance
+// found is inside the rings already visited.
+// The number of cells around a point grows as 3^dimension, so this is
+// meant for low dimensional data (see MAX_DIM).
+//
+template<typename T>
+class   GridNeighborIndex  {
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using dist_pair_t = std::pair<double, size_type>;
+
+    // Above this many dimensions a grid visits more cells than it saves
+    //
+    static constexpr size_type  MAX_DIM { 4 };
+
+    // If cell_size <= 0, it is chosen so there are about two points in
+    // each occupied cell. For radius queries, radius is a good cell size.
+    //
+    template<typename H>
+    void
+    build(const H &column_begin, size_type col_s, double cell_size = 0)  {
+
+        dim_ = col_s > 0 ? size_type(std::size(*column_begin)) : 0;
+        coords_.resize(col_s * dim_);
+        positions_.resize(col_s);
+        if (col_s == 0 || dim_ == 0)  {
+            bucket_start_.assign(1, 0);
+            table_.clear();
+            return;
+        }
+
+        if (cell_size <= 0)  cell_size = auto_cell_size_(column_begin, col_s);
+        cell_ = cell_size;
+        inv_cell_ = 1.0 / cell_size;
+
+        // Sort the points by their cells, so every bucket is a run
+        //
+        std::vector<long>   cells (col_s * dim_);
+
+        for (size_type i { 0 }; i < col_s; ++i)  {
+            const auto  &point { *(column_begin + i) };
+
+            for (size_type d { 0 }; d < dim_; ++d)
+                cells[i * dim_ + d] = cell_of_(double(point[d]));
+            positions_[i] = i;
+        }
+
+        auto    cell_less =
+            [&cells = std::as_const(cells), this]
+            (size_type lhs, size_type rhs) -> bool  {
+                const long  *l { cells.data() + lhs * dim_ };
+                const long  *r { cells.data() + rhs * dim_ };
+
+                for (size_type d { 0 }; d < dim_; ++d)
+                    if (l[d] != r[d])  return (l[d] < r[d]);
+                return (lhs < rhs);
+            };
+
+        if (col_s >= ThreadPool::MUL_THR_THHOLD &&
+            ThreadGranularity::get_thread_level() > 2)
+            ThreadGranularity::thr_pool_.parallel_sort(positions_.begin(),
+                                                       positions_.end(),
+                                                       cell_less);
+        else
+            std::sort(positions_.begin(), positions_.end(), cell_less);
+
+        bucket_cells_.clear();
+        bucket_start_.clear();
+        min_cell_.assign(dim_, std::numeric_limits<long>::max());
+        max_cell_.assign(dim_, std::numeric_limits<long>::min());
+        for (size_type i { 0 }; i < col_s; ++i)  {
+            const size_type pos { positions_[i] };
+            const long      *cell { cells.data() + pos * dim_ };
+            const auto      &point { *(column_begin + pos) };
+
+            if (i == 0 ||
+                ! std::equal(cell, cell + dim_,
+                             bucket_cells_.end() - long(dim_)))  {
+                bucket_cells_.insert(bucket_cells_.end(), cell, cell + dim_);
+                bucket_start_.push_back(i);
+            }
+            for (size_type d { 0 }; d < dim_; ++d)  {
+                coords_[i * dim_ + d] = double(point[d]);
+                min_cell_[d] = std::min(min_cell_[d], cell[d]);
+                max_cell_[d] = std::max(max_cell_[d], cell[d]);
+            }
+        }
+        bucket_start_.push_back(col_s);
+
+        // Open-addressing table of bucket numbers + 1, load factor <= 1/2
+        //
+        const size_type buckets { bucket_start_.size() - 1 };
+
+        table_.assign(std::bit_ceil(buckets * 2), 0);
+        mask_ = table_.size() - 1;
+        for (size_type b { 0 }; b < buckets; ++b)  {
+            const long  *cell { bucket_cells_.data() + b * dim_ };
+            size_type   slot { hash_(cell) & mask_ };
+
+            while (table_[slot] != 0)  slot = (slot + 1) & mask_;
+            table_[slot] = b + 1;
+        }
+    }
+
+    template<typename P>
+    void
+    within(const P &target,
+           double radius,
+           std::vector<size_type> &result) const  {
+
+        result.clear();
+        visit_box_(target, radius,
+                   [&result, &target, radius, this](size_type i) -> void  {
+                       if (std::sqrt(dist_sq_(target, i)) <= radius)
+                           result.push_back(positions_[i]);
+                   });
+        std::sort(result.begin(), result.end());
+    }
+
+    template<typename P>
+    void
+    k_nearest(const P &target,
+              size_type k,
+              std::vector<dist_pair_t> &result) const  {
+
+        const size_type buckets { bucket_start_.size() - 1 };
+
+        k = std::min(k, positions_.size());
+        result.clear();
+        if (k == 0)  return;
+
+        std::vector<long>   center (dim_);
+        std::vector<long>   offset (dim_);
+        size_type           whole_grid { 0 };
+
+        for (size_type d { 0 }; d < dim_; ++d)
+            center[d] = cell_of_(double(target[d]));
+
+        auto    add_cell =
+            [&result, &target, this](const long *cell) -> void  {
+                const size_type b { find_bucket_(cell) };
+
+                if (b == NOPOS_)  return;
+                for (size_type i { bucket_start_[b] };
+                     i < bucket_start_[b + 1]; ++i)
+                    result.emplace_back(std::sqrt(dist_sq_(target, i)),
+                                        positions_[i]);
+            };
+
+        for (long ring { 0 }; ; ++ring)  {
+            size_type   ring_cells { 1 };
+
+            for (size_type d { 0 }; d < dim_; ++d)
+                ring_cells *= size_type(2 * ring + 1);
+
+            // The rings have more cells than there are buckets. Looking at
+            // every point is cheaper from here on.
+            //
+            if (ring_cells > buckets * 2)  {
+                result.clear();
+                for (size_type i { 0 }; i < positions_.size(); ++i)
+                    result.emplace_back(std::sqrt(dist_sq_(target, i)),
+                                        positions_[i]);
+                break;
+            }
+
+            // Visit the cells whose Chebyshev distance from center is ring
+            //
+            std::vector<long>   cell (dim_);
+
+            std::fill(offset.begin(), offset.end(), -ring);
+            while (true)  {
+                bool    on_ring { false };
+
+                for (size_type d { 0 }; d < dim_; ++d)  {
+                    cell[d] = center[d] + offset[d];
+                    on_ring |= (offset[d] == -ring || offset[d] == ring);
+                }
+                if (on_ring)  add_cell(cell.data());
+
+                size_type   d { 0 };
+
+                for (; d < dim_ && offset[d] == ring; ++d)
+                    offset[d] = -ring;
+                if (d == dim_)  break;
+                offset[d] += 1;
+            }
+
+            // Every point outside the rings visited so far is farther than
+            // ring * cell_ from target
+            //
+            whole_grid = 0;
+            for (size_type d { 0 }; d < dim_; ++d)
+                whole_grid += (center[d] - ring <= min_cell_[d] &&
+                               center[d] + ring >= max_cell_[d]);
+            if (whole_grid == dim_)  break;
+            if (result.size() >= k)  {
+                std::nth_element(result.begin(), result.begin() + (k - 1),
+                                 result.end());
+                if (result[k - 1].first <= double(ring) * cell_)  break;
+            }
+        }
+
+        std::sort(result.begin(), result.end());
+        result.resize(k);
+    }
+
+    [[nodiscard]] size_type size() const  { return (positions_.size()); }
+    [[nodiscard]] size_type dimension() const  { return (dim_); }
+
+private:
+
+    static constexpr size_type  NOPOS_ {
+        std::numeric_limits<size_type>::max()
+    };
+
+    inline static double widen_(double radius)  {
+
+        return (radius * (1.0 + 8.0 * std::numeric_limits<double>::epsilon()));
+    }
+
+    inline long cell_of_(double val) const  {
+
+        return (long(std::floor(val * inv_cell_)));
+    }
+
+    inline size_type hash_(const long *cell) const  {
+
+        std::uint64_t   h { 0x9E3779B97F4A7C15ULL };
+
+        for (size_type d { 0 }; d < dim_; ++d)  {
+            h ^= std::uint64_t(cell[d]) + 0x9E3779B97F4A7C15ULL +
+                 (h << 6) + (h >> 2);
+            h *= 0xBF58476D1CE4E5B9ULL;
+        }
+        return (size_type(h ^ (h >> 31)));
+    }
+
+    inline size_type find_bucket_(const long *cell) const  {
+
+        for (size_type slot { hash_(cell) & mask_ }; table_[slot] != 0;
+             slot = (slot + 1) & mask_)  {
+            const size_type b { table_[slot] - 1 };
+
+            if (std::equal(cell, cell + dim_,
+                           bucket_cells_.data() + b * dim_))
+                return (b);
+        }
+        return (NOPOS_);
+    }
+
+    template<typename P>
+    inline double dist_sq_(const P &target, size_type i) const  {
+
+        const double    *point { coords_.data() + i * dim_ };
+        double          sum { 0 };
+
+        for (size_type d { 0 }; d < dim_; ++d)  {
+            const double    diff { double(target[d]) - point[d] };
+
+            sum += diff * diff;
+        }
+        return (sum);
+    }
+
+    // Calls func(i) for every stored point i in a cell that overlaps the
+    // box of half-width radius around target
+    //
+    template<typename P, typename F>
+    void
+    visit_box_(const P &target, double radius, F &&func) const  {
+
+        const size_type     buckets { bucket_start_.size() - 1 };
+        const double        half { widen_(radius) };
+        std::vector<long>   low (dim_);
+        std::vector<long>   high (dim_);
+        double              box_cells { 1 };
+
+        for (size_type d { 0 }; d < dim_; ++d)  {
+            low[d] = std::max(cell_of_(double(target[d]) - half),
+                              min_cell_[d]);
+            high[d] = std::min(cell_of_(double(target[d]) + half),
+                               max_cell_[d]);
+            if (high[d] < low[d])  return;
+            box_cells *= double(high[d] - low[d] + 1);
+        }
+
+        // The box has more cells than there are buckets, so go over the
+        // buckets instead
+        //
+        if (box_cells > double(buckets))  {
+            for (size_type b { 0 }; b < buckets; ++b)  {
+                const long  *cell { bucket_cells_.data() + b * dim_ };
+                bool        inside { true };
+
+                for (size_type d { 0 }; d < dim_ && inside; ++d)
+                    inside = cell[d] >= low[d] && cell[d] <= high[d];
+                if (inside)
+                    for (size_type i { bucket_start_[b] };
+                         i < bucket_start_[b + 1]; ++i)
+                        func(i);
+            }
+            return;
+        }
+
+        std::vector<long>   cell (low);
+
+        while (true)  {
+            const size_type b { find_bucket_(cell.data()) };
+
+            if (b != NOPOS_)
+                for (size_type i { bucket_start_[b] };
+                     i < bucket_start_[b + 1]; ++i)
+                    func(i);
+
+            size_type   d { 0 };
+
+            for (; d < dim_ && cell[d] == high[d]; ++d)
+                cell[d] = low[d];
+            if (d == dim_)  break;
+            cell[d] += 1;
+        }
+    }
+
+    template<typename H>
+    double
+    auto_cell_size_(const H &column_begin, size_type col_s) const  {
+
+        std::vector<double> low (dim_, std::numeric_limits<double>::max());
+        std::vector<double> high (dim_, std::numeric_limits<double>::lowest());
+
+        for (size_type i { 0 }; i < col_s; ++i)  {
+            const auto  &point { *(column_begin + i) };
+
+            for (size_type d { 0 }; d < dim_; ++d)  {
+                low[d] = std::min(low[d], double(point[d]));
+                high[d] = std::max(high[d], double(point[d]));
+            }
+        }
+
+        double  volume { 1 };
+        double  max_extent { 0 };
+
+        for (size_type d { 0 }; d < dim_; ++d)
+            max_extent = std::max(max_extent, high[d] - low[d]);
+        if (max_extent <= 0)  return (1.0);
+
+        // Flat dimensions don't add cells
+        //
+        size_type   live_dims { 0 };
+
+        for (size_type d { 0 }; d < dim_; ++d)
+            if (high[d] - low[d] > max_extent * 1e-9)  {
+                volume *= high[d] - low[d];
+                live_dims += 1;
+            }
+
+        return (std::pow(volume * 2.0 / double(col_s),
+                         1.0 / double(live_dims)));
+    }
+
+    size_type               dim_ { 0 };
+    double                  cell_ { 1 };
+    double                  inv_cell_ { 1 };
+    std::vector<double>     coords_ { };        // Points in bucket order
+    std::vector<size_type>  positions_ { };     // Position of coords_[i]
+    std::vector<long>       bucket_cells_ { };  // Cell of each bucket
+    std::vector<size_type>  bucket_start_ { };  // First point of bucket
+    std::vector<long>       min_cell_ { };
+    std::vector<long>       max_cell_ { };
+    std::vector<size_type>  table_ { };         // Bucket + 1, 0 is empty
+    size_type               mask_ { 0 };
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,237 @@
+// Hossein Moein
+// October 17, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// Order-statistic index over a known universe of values.
+// The universe (e.g. all the values of a column) is given to the
+// constructor. After that, values from the universe can be inserted and
+// erased. The k-th smallest value, the count and sum of values at or below
+// any value, and the k-th smallest distance from any value can be queried.
+// Updates and queries are O(log(universe size)). The k-th distance is
+// O(log^2).
+// It is a Fenwick (binary indexed) tree of counts and sums over the sorted
+// distinct values of the universe.
+// NaN values are not part of the universe and must not be inserted.
+//
+template<typename T>
+class   OrderStatIndex  {
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using sum_type =
+        std::conditional_t<std::floating_point<T>, T, double>;
+
+    template<typename IT>
+    OrderStatIndex(IT begin, IT end)  {
+
+        values_.reserve(std::distance(begin, end));
+        for (auto citer = begin; citer != end; ++citer)
+            if (! is_nan_(*citer))  values_.push_back(*citer);
+        std::sort(values_.begin(), values_.end());
+        values_.erase(std::unique(values_.begin(), values_.end()),
+                      values_.end());
+
+        counts_.resize(values_.size() + 1, 0);
+        sums_.resize(values_.size() + 1, 0);
+        top_bit_ = values_.empty() ? 0 : std::bit_floor(values_.size());
+    }
+
+    inline void insert(const value_type &val)  { update_(val, 1); }
+    inline void erase(const value_type &val)  { update_(val, -1); }
+    inline void clear()  {
+
+        std::fill(counts_.begin(), counts_.end(), 0);
+        std::fill(sums_.begin(), sums_.end(), 0);
+        size_ = 0;
+        total_ = 0;
+    }
+
+    [[nodiscard]] inline size_type size() const noexcept  { return (size_); }
+    [[nodiscard]] inline bool empty() const noexcept  { return (size_ == 0); }
+    [[nodiscard]] inline sum_type sum() const noexcept  { return (total_); }
+
+    // k is 1-based and must be in [1, size()]
+    //
+    [[nodiscard]] inline const value_type &kth(size_type k) const  {
+
+        size_type   pos { 0 };
+
+        for (size_type step = top_bit_; step > 0; step >>= 1)  {
+            const size_type next = pos + step;
+
+            if (next < counts_.size() && counts_[next] < k)  {
+                pos = next;
+                k -= counts_[next];
+            }
+        }
+        return (values_[pos]);
+    }
+
+    // Number of inserted values <= val
+    //
+    template<typename V>
+    [[nodiscard]] inline size_type count_le(const V &val) const  {
+
+        size_type   cnt { 0 };
+
+        for (size_type i = upper_pos_(val); i > 0; i -= (i & (~i + 1)))
+            cnt += counts_[i];
+        return (cnt);
+    }
+
+    // Sum of inserted values <= val
+    //
+    template<typename V>
+    [[nodiscard]] inline sum_type sum_le(const V &val) const  {
+
+        sum_type    total { 0 };
+
+        for (size_type i = upper_pos_(val); i > 0; i -= (i & (~i + 1)))
+            total += sums_[i];
+        return (total);
+    }
+
+    // Sum of |x - center| over the inserted values
+    //
+    [[nodiscard]] inline sum_type
+    abs_dev_sum(const sum_type &center) const  {
+
+        const size_type low_cnt = count_le(center);
+        const sum_type  low_sum = sum_le(center);
+
+        return ((center * sum_type(low_cnt) - low_sum) +
+                ((total_ - low_sum) - center * sum_type(size_ - low_cnt)));
+    }
+
+    // k-th (1-based) smallest |x - center| over the inserted values
+    //
+    [[nodiscard]] inline sum_type
+    kth_abs_dev(const sum_type &center, size_type k) const  {
+
+        // Distances of values <= center, in ascending order, and distances
+        // of values > center, in ascending order. It is the k-th smallest
+        // of the merge of the two sorted lists.
+        //
+        const size_type low_cnt = count_le(center);
+        const size_type high_cnt = size_ - low_cnt;
+        auto            low_dist =
+            [this, &center, low_cnt](size_type i) -> sum_type  {
+                return (center - sum_type(kth(low_cnt - i + 1)));
+            };
+        auto            high_dist =
+            [this, &center, low_cnt](size_type j) -> sum_type  {
+                return (sum_type(kth(low_cnt + j)) - center);
+            };
+
+        // Binary search for the number of items taken from the low list
+        //
+        size_type   lo = k > high_cnt ? k - high_cnt : 0;
+        size_type   hi = std::min(k, low_cnt);
+
+        while (lo < hi)  {
+            const size_type i = (lo + hi) / 2;
+
+            // Taking i items from low is too few, if the next low item is
+            // smaller than the last high item taken
+            //
+            if (low_dist(i + 1) < high_dist(k - i))  lo = i + 1;
+            else  hi = i;
+        }
+
+        if (lo == 0)  return (high_dist(k));
+        if (lo == k)  return (low_dist(k));
+        return (std::max(low_dist(lo), high_dist(k - lo)));
+    }
+
+private:
+
+    template<typename V>
+    inline static bool is_nan_(const V &val)  {
+
+        if constexpr (std::floating_point<V>)  return (std::isnan(val));
+        else  return (false);
+    }
+
+    // 1-based Fenwick position of the last distinct value <= val
+    //
+    template<typename V>
+    inline size_type upper_pos_(const V &val) const  {
+
+        return (std::upper_bound(values_.begin(), values_.end(), val) -
+                values_.begin());
+    }
+
+    inline void update_(const value_type &val, int delta)  {
+
+        size_type   i =
+            std::lower_bound(values_.begin(), values_.end(), val) -
+            values_.begin() + 1;
+        const sum_type  sval = delta > 0 ? sum_type(val) : -sum_type(val);
+
+        for (; i < counts_.size(); i += (i & (~i + 1)))  {
+            counts_[i] += delta;
+            sums_[i] += sval;
+        }
+        size_ += delta;
+        total_ += sval;
+    }
+
+    std::vector<value_type> values_ { };
+    std::vector<size_type>  counts_ { };
+    std::vector<sum_type>   sums_ { };
+    size_type               top_bit_ { 0 };
+    size_type               size_ { 0 };
+    sum_type                total_ { 0 };
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
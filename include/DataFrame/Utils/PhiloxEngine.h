@@ -0,0 +1,174 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// Philox4x32-10 counter-based random number engine (Salmon, Moraes, Dror,
+// Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3", SC11).
+// Every block of output is a pure function of a 128-bit counter and a
+// 64-bit key. The key is the seed. The high 64 bits of the counter are the
+// stream id and the low 64 bits are the block position within the stream.
+// So any part of any stream can be generated independently, in any order,
+// by any thread, and it is always the same.
+// It is a std::uniform_random_bit_generator, so it can drive the std
+// distributions. Each block gives two 64-bit values.
+//
+class   PhiloxEngine  {
+
+public:
+
+    using result_type = std::uint64_t;
+    using block_type = std::array<result_type, 2>;
+
+    explicit
+    PhiloxEngine(std::uint64_t key = 0, std::uint64_t stream = 0) noexcept
+        : key_(key), stream_(stream)  {   }
+
+    inline void seed(std::uint64_t key, std::uint64_t stream = 0) noexcept  {
+
+        key_ = key;
+        stream_ = stream;
+        pos_ = 0;
+        idx_ = 2;
+    }
+
+    [[nodiscard]] static constexpr result_type min() noexcept  {
+
+        return (std::numeric_limits<result_type>::min());
+    }
+    [[nodiscard]] static constexpr result_type max() noexcept  {
+
+        return (std::numeric_limits<result_type>::max());
+    }
+
+    inline result_type operator() () noexcept  {
+
+        if (idx_ == 2)  {
+            buffer_ = block(pos_++, stream_, key_);
+            idx_ = 0;
+        }
+        return (buffer_[idx_++]);
+    }
+
+    // It skips the next z values
+    //
+    inline void discard(unsigned long long z) noexcept  {
+
+        for ( ; z > 0 && idx_ < 2; --z)  ++idx_;
+        pos_ += z / 2;
+        if (z % 2)  (*this)();
+    }
+
+    // It fills [out, out + n) with the next n values.
+    // Blocks do not depend on each other, so the main loop vectorizes.
+    //
+    inline void generate(result_type *out, std::size_t n) noexcept  {
+
+        std::size_t i { 0 };
+
+        for ( ; i < n && idx_ < 2; ++i)  out[i] = buffer_[idx_++];
+
+        const std::size_t   blocks { (n - i) / 2 };
+
+        for (std::size_t b = 0; b < blocks; ++b)  {
+            const block_type    res = block(pos_ + b, stream_, key_);
+
+            out[i + 2 * b] = res[0];
+            out[i + 2 * b + 1] = res[1];
+        }
+        pos_ += blocks;
+        i += 2 * blocks;
+        if (i < n)  out[i] = (*this)();
+    }
+
+    // The Philox bijection. The counter is (pos, stream) and the key is key.
+    // The four 32-bit output words are returned little-end first, two in
+    // each 64-bit value.
+    //
+    [[nodiscard]] static inline block_type
+    block(std::uint64_t pos,
+          std::uint64_t stream,
+          std::uint64_t key) noexcept  {
+
+        std::uint32_t   c0 = static_cast<std::uint32_t>(pos);
+        std::uint32_t   c1 = static_cast<std::uint32_t>(pos >> 32);
+        std::uint32_t   c2 = static_cast<std::uint32_t>(stream);
+        std::uint32_t   c3 = static_cast<std::uint32_t>(stream >> 32);
+        std::uint32_t   k0 = static_cast<std::uint32_t>(key);
+        std::uint32_t   k1 = static_cast<std::uint32_t>(key >> 32);
+
+        for (int r = 0; r < ROUNDS; ++r)  {
+            const std::uint64_t p0 = std::uint64_t(M0) * c0;
+            const std::uint64_t p1 = std::uint64_t(M1) * c2;
+
+            c0 = static_cast<std::uint32_t>(p1 >> 32) ^ c1 ^ k0;
+            c1 = static_cast<std::uint32_t>(p1);
+            c2 = static_cast<std::uint32_t>(p0 >> 32) ^ c3 ^ k1;
+            c3 = static_cast<std::uint32_t>(p0);
+            k0 += W0;
+            k1 += W1;
+        }
+        return (block_type { (std::uint64_t(c1) << 32) | c0,
+                             (std::uint64_t(c3) << 32) | c2 });
+    }
+
+private:
+
+    static constexpr int            ROUNDS { 10 };
+    static constexpr std::uint32_t  M0 { 0xD2511F53 };
+    static constexpr std::uint32_t  M1 { 0xCD9E8D57 };
+    static constexpr std::uint32_t  W0 { 0x9E3779B9 };
+    static constexpr std::uint32_t  W1 { 0xBB67AE85 };
+
+    std::uint64_t   key_ { 0 };
+    std::uint64_t   stream_ { 0 };
+    std::uint64_t   pos_ { 0 };     // Next block to generate
+    block_type      buffer_ { };
+    std::size_t     idx_ { 2 };     // Next unused value in buffer_
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
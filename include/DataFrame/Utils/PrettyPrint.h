@@ -32,6 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Internals/DataFrame_standalone.tcc>
 #include <DataFrame/Utils/DateTime.h>
 #include <DataFrame/Utils/FixedSizeString.h>
+#include <DataFrame/Utils/Timestamp.h>
 
 #include <algorithm>
 #include <cstdio>
@@ -177,6 +178,12 @@ _stringfy_(const V &vec,
             result.push_back(buffer.c_str());
         }
     }
+    else if constexpr (std::is_same_v<value_type, Timestamp>)  {
+        char    buffer[DateTime::FORMAT_BUF_SIZE];
+
+        for (long i { start_row }; i < end_row; ++i)
+            result.emplace_back(buffer, vec[i].format_to(buffer, dt_format));
+    }
     else if constexpr (std::is_same_v<value_type, std::string>)  {
         for (long i { start_row }; i < end_row; ++i)  {
             result.push_back(vec[i]);
@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <optional>
 #include <queue>
 #include <chrono>
+#include <utility>
 
 // ----------------------------------------------------------------------------
 
@@ -57,6 +58,7 @@ public:
     SharedQueue &operator = (const SharedQueue &) = delete;
 
     inline void push(const value_type &element) noexcept;
+    inline void push(value_type &&element) noexcept;
 
     // NOTE: The following method returns the data by value.
     //       Therefore, it is not as efficient as front().
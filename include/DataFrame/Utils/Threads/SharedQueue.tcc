@@ -49,6 +49,19 @@ SharedQueue<T>::push(const value_type &element) noexcept  {
 
 // ----------------------------------------------------------------------------
 
+template<typename T>
+inline void
+SharedQueue<T>::push(value_type &&element) noexcept  {
+
+    const AutoLockable  lock { mutex_ };
+    const bool          was_empty { queue_.empty() };
+
+    queue_.push (std::move(element));
+    if (was_empty)  cvx_.notify_all();
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename T>
 inline typename SharedQueue<T>::optional_ret
 SharedQueue<T>::pop_front(bool wait_on_front) noexcept  {
@@ -60,7 +73,7 @@ SharedQueue<T>::pop_front(bool wait_on_front) noexcept  {
         cvx_.wait_for(ul, 2s);
 
     if (! queue_.empty())  {
-        ret = queue_.front();
+        ret = std::move(queue_.front());
         queue_.pop();
     }
     return (ret);
@@ -58,6 +58,13 @@ struct  ThreadGranularity  {
         return (thr_pool_.capacity_threads());
     }
 
+    // It must be called before any threads are added
+    //
+    static inline void set_sched_policy(ThreadPool::sched_policy policy)  {
+
+        thr_pool_.set_sched_policy(policy);
+    }
+
     // By defaut, there are no threads
     //
     inline static ThreadPool    thr_pool_ { 0 };
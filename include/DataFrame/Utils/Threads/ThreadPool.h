@@ -30,10 +30,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <DataFrame/Utils/Threads/SharedQueue.h>
+#include <DataFrame/Utils/Threads/WorkStealingDeque.h>
 
 #include <atomic>
 #include <concepts>
 #include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <iterator>
@@ -72,11 +74,28 @@ public:
     inline static constexpr size_type   CLINE_SIZE = size_type(64);
 #endif // __cpp_lib_hardware_interference_size
 
+    // shared_queue:
+    //     Tasks dispatched from outside the pool go to one mutex-guarded
+    //     global queue. Tasks dispatched from a pool thread go to that
+    //     thread's local queue, which is guarded by a pool-wide mutex.
+    // work_stealing:
+    //     Every pool thread owns a lock-free deque. Tasks dispatched from a
+    //     pool thread go to its own deque, and the thread runs them in LIFO
+    //     order. Idle threads (and threads waiting in run_task()) steal from
+    //     the other end of other threads' deques. Tasks dispatched from
+    //     outside the pool still go to the global queue.
+    //
+    enum class sched_policy : unsigned char  {
+        shared_queue = 1,
+        work_stealing = 2,
+    };
+
     ThreadPool(const ThreadPool &) = delete;
     ThreadPool &operator = (const ThreadPool &) = delete;
 
     explicit
-    ThreadPool(size_type thr_num = std::thread::hardware_concurrency());
+    ThreadPool(size_type thr_num = std::thread::hardware_concurrency(),
+               sched_policy policy = sched_policy::shared_queue);
     ~ThreadPool();
 
     template<typename F, typename ... As>
@@ -136,6 +155,12 @@ public:
 
     bool add_thread(size_type thr_num);  // Could be positive or negative
 
+    // The policy can only be changed when the pool has no threads.
+    // Otherwise, it throws.
+    //
+    bool set_sched_policy(sched_policy policy);
+    sched_policy get_sched_policy() const noexcept;
+
     size_type available_threads() const noexcept;
     size_type capacity_threads() const noexcept;
     size_type pending_tasks() const noexcept; // How many tasks in the queue
@@ -154,7 +179,55 @@ private:
                           size_type num_blocks,
                           size_type divisor);
 
-    using routine_type = std::function<void()>;
+    // A move-only, type-erased callable. Callables that fit in the in-place
+    // buffer (e.g. a std::packaged_task) are stored without a heap
+    // allocation. Larger ones are stored on the heap.
+    //
+    class   TaskRoutine  {
+
+    public:
+
+        TaskRoutine() = default;
+        TaskRoutine(const TaskRoutine &) = delete;
+        TaskRoutine &operator = (const TaskRoutine &) = delete;
+        inline TaskRoutine(TaskRoutine &&that) noexcept;
+        inline TaskRoutine &operator = (TaskRoutine &&that) noexcept;
+        inline ~TaskRoutine();
+
+        template<typename F>
+        requires (! std::same_as<std::decay_t<F>, TaskRoutine>)
+        explicit TaskRoutine(F &&func);
+
+        inline void operator () ();
+        inline explicit operator bool () const noexcept;
+
+    private:
+
+        inline static constexpr std::size_t BUF_SIZE { 48 };
+
+        struct  OpTable_  {
+
+            void (*invoke)(void *buf);
+            void (*relocate)(void *to_buf, void *from_buf) noexcept;
+            void (*destroy)(void *buf) noexcept;
+        };
+
+        template<typename F>
+        inline static constexpr bool    is_inline_ =
+            sizeof(F) <= BUF_SIZE &&
+            alignof(F) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible_v<F>;
+
+        template<typename F>
+        static const OpTable_ *op_table_() noexcept;
+
+        inline void reset_() noexcept;
+
+        alignas(std::max_align_t) unsigned char buffer_[BUF_SIZE];
+        const OpTable_                          *ops_ { nullptr };
+    };
+
+    using routine_type = TaskRoutine;
 
     enum class WORK_TYPE : unsigned char {
         _undefined_ = 0,
@@ -165,15 +238,14 @@ private:
     struct  WorkUnit  {
 
         WorkUnit() = default;
-        WorkUnit(const WorkUnit &) = default;
+        WorkUnit(const WorkUnit &) = delete;
         WorkUnit(WorkUnit &&) = default;
-        WorkUnit &operator=(const WorkUnit &) = default;
+        WorkUnit &operator=(const WorkUnit &) = delete;
         WorkUnit &operator=(WorkUnit &&) = default;
 
         explicit WorkUnit(WORK_TYPE work_t) : work_type(work_t)  {   }
         WorkUnit(WORK_TYPE work_t, routine_type &&routine)
-            : func(std::forward<routine_type>(routine)),
-              work_type(work_t)  {   }
+            : func(std::move(routine)), work_type(work_t)  {   }
 
         routine_type    func {  };
         WORK_TYPE       work_type { WORK_TYPE::_undefined_ };
@@ -181,6 +253,8 @@ private:
 
     bool thread_routine_(size_type local_q_idx) noexcept;  // Engine routine
     WorkUnit get_one_local_task_() noexcept;
+    WorkUnit *get_one_stolen_task_() noexcept;
+    void add_steal_queues_(size_type count);
 
     using guard_type = std::lock_guard<std::mutex>;
     using GlobalQueueType = SharedQueue<WorkUnit>;
@@ -189,14 +263,37 @@ private:
     using LocalQueueList = std::list<LocalQueueType>;
     using ThreadVector = std::vector<thread_type>;
 
-    ThreadVector    threads_ { };
-    LocalQueueList  local_queues_ { };
-    GlobalQueueType global_queue_ { };
+    // Work units in the deques are heap allocated, because a thief must be
+    // able to copy the slot before it knows whether it won the race
+    //
+    using StealQueueType = WorkStealingDeque<WorkUnit *>;
+    using StealQueueList = std::list<StealQueueType>;
 
-    inline static thread_local LocalQueueType *local_queue_ { nullptr };
+    // Thieves walk the table without a lock. Adding threads publishes a new
+    // table. Old tables are kept until the pool is destroyed.
+    //
+    struct  StealTable_  {
+
+        std::vector<StealQueueType *>   queues { };
+    };
+    using StealTableList = std::vector<std::unique_ptr<StealTable_>>;
+
+    ThreadVector                        threads_ { };
+    LocalQueueList                      local_queues_ { };
+    GlobalQueueType                     global_queue_ { };
+    StealQueueList                      steal_queues_ { };
+    StealTableList                      steal_tables_ { };
+    std::atomic<const StealTable_ *>    steal_table_ { nullptr };
 
-    std::atomic<size_type>  available_threads_ { 0 };
-    std::atomic<size_type>  capacity_threads_ { 0 };
+    inline static thread_local LocalQueueType *local_queue_ { nullptr };
+    inline static thread_local StealQueueType *steal_queue_ { nullptr };
+    inline static thread_local ThreadPool     *steal_queue_owner_ { nullptr };
+    inline static thread_local std::size_t    steal_seed_ { 0 };
+
+    std::atomic<size_type>      available_threads_ { 0 };
+    std::atomic<size_type>      capacity_threads_ { 0 };
+    std::atomic<size_type>      sleeping_threads_ { 0 };
+    std::atomic<sched_policy>   policy_ { sched_policy::shared_queue };
     std::atomic_bool        shutdown_flag_ { false };
     mutable std::mutex      state_ { };
 };
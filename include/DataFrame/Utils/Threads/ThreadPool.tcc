@@ -30,6 +30,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Utils/Threads/ThreadPool.h>
 
 #include <algorithm>
+#include <new>
 
 // ----------------------------------------------------------------------------
 
@@ -55,9 +56,123 @@ ThreadPool::cline_aligned_blocks_(size_type data_size,
 
 // ----------------------------------------------------------------------------
 
-inline ThreadPool::ThreadPool(size_type thr_num)  {
+template<typename F>
+requires (! std::same_as<std::decay_t<F>, ThreadPool::TaskRoutine>)
+ThreadPool::TaskRoutine::TaskRoutine(F &&func)  {
+
+    using func_t = std::decay_t<F>;
+
+    if constexpr (is_inline_<func_t>)
+        ::new (static_cast<void *>(buffer_)) func_t(std::forward<F>(func));
+    else
+        ::new (static_cast<void *>(buffer_))
+            func_t *(new func_t(std::forward<F>(func)));
+    ops_ = op_table_<func_t>();
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename F>
+const ThreadPool::TaskRoutine::OpTable_ *
+ThreadPool::TaskRoutine::op_table_() noexcept  {
+
+    if constexpr (is_inline_<F>)  {
+        static constexpr OpTable_   table {
+            [](void *buf) -> void  {
+                (*std::launder(reinterpret_cast<F *>(buf)))();
+            },
+            [](void *to_buf, void *from_buf) noexcept -> void  {
+                F   *from = std::launder(reinterpret_cast<F *>(from_buf));
+
+                ::new (to_buf) F(std::move(*from));
+                from->~F();
+            },
+            [](void *buf) noexcept -> void  {
+                std::launder(reinterpret_cast<F *>(buf))->~F();
+            },
+        };
+
+        return (&table);
+    }
+    else  {  // The buffer holds a pointer to the heap allocated callable
+        static constexpr OpTable_   table {
+            [](void *buf) -> void  {
+                (**std::launder(reinterpret_cast<F **>(buf)))();
+            },
+            [](void *to_buf, void *from_buf) noexcept -> void  {
+                ::new (to_buf)
+                    F *(*std::launder(reinterpret_cast<F **>(from_buf)));
+            },
+            [](void *buf) noexcept -> void  {
+                delete *std::launder(reinterpret_cast<F **>(buf));
+            },
+        };
+
+        return (&table);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+inline ThreadPool::TaskRoutine::TaskRoutine(TaskRoutine &&that) noexcept
+    : ops_(that.ops_)  {
+
+    if (ops_)  {
+        ops_->relocate(buffer_, that.buffer_);
+        that.ops_ = nullptr;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+inline ThreadPool::TaskRoutine &
+ThreadPool::TaskRoutine::operator = (TaskRoutine &&that) noexcept  {
+
+    if (this != &that)  {
+        reset_();
+        if (that.ops_)  {
+            that.ops_->relocate(buffer_, that.buffer_);
+            ops_ = that.ops_;
+            that.ops_ = nullptr;
+        }
+    }
+    return (*this);
+}
+
+// ----------------------------------------------------------------------------
+
+inline ThreadPool::TaskRoutine::~TaskRoutine()  { reset_(); }
+
+// ----------------------------------------------------------------------------
+
+inline void
+ThreadPool::TaskRoutine::reset_() noexcept  {
+
+    if (ops_)  {
+        ops_->destroy(buffer_);
+        ops_ = nullptr;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+inline void
+ThreadPool::TaskRoutine::operator () ()  { ops_->invoke(buffer_); }
+
+// ----------------------------------------------------------------------------
+
+inline ThreadPool::TaskRoutine::operator bool () const noexcept  {
+
+    return (ops_ != nullptr);
+}
+
+// ----------------------------------------------------------------------------
+
+inline ThreadPool::ThreadPool(size_type thr_num, sched_policy policy)
+    : policy_(policy)  {
 
     threads_.reserve(thr_num * 2);
+    add_steal_queues_(thr_num);
     for (size_type i = 0; i < thr_num; ++i)  {
         local_queues_.push_back(LocalQueueType { });
         threads_.emplace_back(&ThreadPool::thread_routine_, this, i);
@@ -77,6 +192,57 @@ inline ThreadPool::~ThreadPool()  {
     for (auto &routine : threads_)
         if (routine.joinable())
             routine.join();
+
+    // Tasks left behind are dropped. Their futures get a broken_promise.
+    //
+    for (auto &queue : steal_queues_)  {
+        WorkUnit    *work_unit { nullptr };
+
+        while (queue.take(work_unit))  delete work_unit;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+inline void
+ThreadPool::add_steal_queues_(size_type count)  {
+
+    auto                table { std::make_unique<StealTable_>() };
+    const StealTable_   *current {
+        steal_table_.load(std::memory_order_relaxed)
+    };
+
+    if (current)  table->queues = current->queues;
+    table->queues.reserve(table->queues.size() + count);
+    for (size_type i = 0; i < count; ++i)  {
+        steal_queues_.emplace_back();
+        table->queues.push_back(&(steal_queues_.back()));
+    }
+    steal_table_.store(table.get(), std::memory_order_release);
+    steal_tables_.push_back(std::move(table));
+}
+
+// ----------------------------------------------------------------------------
+
+inline bool
+ThreadPool::set_sched_policy(sched_policy policy)  {
+
+    const guard_type    guard { state_ };
+
+    if (capacity_threads() != 0)
+        throw std::runtime_error("ThreadPool::set_sched_policy(): "
+                                 "The policy cannot be changed while the "
+                                 "pool has threads.");
+    policy_.store(policy, std::memory_order_relaxed);
+    return (true);
+}
+
+// ----------------------------------------------------------------------------
+
+inline ThreadPool::sched_policy
+ThreadPool::get_sched_policy() const noexcept  {
+
+    return (policy_.load(std::memory_order_relaxed));
 }
 
 // ----------------------------------------------------------------------------
@@ -101,16 +267,14 @@ ThreadPool::add_thread(size_type thr_num)  {
             throw std::runtime_error(err);
         }
 
-        for (size_type i = 0; i < shutys; ++i)  {
-            const WorkUnit  work_unit { WORK_TYPE::_terminate_ };
-
-            global_queue_.push(work_unit);
-        }
+        for (size_type i = 0; i < shutys; ++i)
+            global_queue_.push(WorkUnit { WORK_TYPE::_terminate_ });
     }
     else if (thr_num > 0)  {
         const guard_type    guard { state_ };
         const size_type     local_size { size_type(threads_.size()) };
 
+        add_steal_queues_(thr_num);
         for (size_type i = 0; i < thr_num; ++i)  {
             local_queues_.push_back(LocalQueueType { });
             threads_.emplace_back(&ThreadPool::thread_routine_,
@@ -136,26 +300,36 @@ ThreadPool::dispatch(bool immediately, F &&routine, As && ... args)  {
         std::invoke_result_t<std::decay_t<F>, std::decay_t<As> ...>;
     using future_t = dispatch_res_t<F, As ...>;
 
-    auto            callable  {
-        std::make_shared<std::packaged_task<task_return_t()>>
-            (std::bind<task_return_t>(std::forward<F>(routine),
-                                      std::forward<As>(args) ...))
+    std::packaged_task<task_return_t()> callable  {
+        std::bind<task_return_t>(std::forward<F>(routine),
+                                 std::forward<As>(args) ...)
     };
-    future_t        return_fut { callable->get_future() };
-    const WorkUnit  work_unit {
-        WORK_TYPE::_client_service_, [callable]() -> void { (*callable)(); }
+    future_t                            return_fut { callable.get_future() };
+    WorkUnit                            work_unit {
+        WORK_TYPE::_client_service_, routine_type { std::move(callable) }
     };
 
     if (immediately && available_threads() == 0)
         add_thread(1);
 
-    if (local_queue_)  {  // Is this one of the pool threads
+    if (get_sched_policy() == sched_policy::work_stealing)  {
+        // If some threads are asleep, hand the task to them through the
+        // global queue. Otherwise, it stays on this thread's deque until it
+        // is run here or stolen.
+        //
+        if (steal_queue_owner_ == this &&
+            sleeping_threads_.load(std::memory_order_relaxed) == 0)
+            steal_queue_->push(new WorkUnit { std::move(work_unit) });
+        else
+            global_queue_.push(std::move(work_unit));
+    }
+    else if (local_queue_)  {  // Is this one of the pool threads
         const guard_type    guard { state_ };
 
-        local_queue_->push(work_unit);
+        local_queue_->push(std::move(work_unit));
     }
     else
-        global_queue_.push(work_unit);
+        global_queue_.push(std::move(work_unit));
 
     return (return_fut);
 }
@@ -402,7 +576,15 @@ ThreadPool::is_shutdown() const noexcept  {
 inline ThreadPool::size_type
 ThreadPool::pending_tasks() const noexcept  {
 
-    return (global_queue_.size());
+    size_type           ret { size_type(global_queue_.size()) };
+    const StealTable_   *table {
+        steal_table_.load(std::memory_order_acquire)
+    };
+
+    if (table)
+        for (const auto *queue : table->queues)
+            ret += queue->size();
+    return (ret);
 }
 
 // ----------------------------------------------------------------------------
@@ -417,11 +599,8 @@ ThreadPool::shutdown() noexcept  {
                                                std::memory_order_relaxed))  {
         const size_type capacity { capacity_threads() + 10 };
 
-        for (size_type i = 0; i < capacity; ++i)  {
-            const WorkUnit  work_unit { WORK_TYPE::_terminate_ };
-
-            global_queue_.push(work_unit);
-        }
+        for (size_type i = 0; i < capacity; ++i)
+            global_queue_.push(WorkUnit { WORK_TYPE::_terminate_ });
     }
 
     return (true);
@@ -436,13 +615,13 @@ ThreadPool::get_one_local_task_() noexcept  {
     const guard_type    guard { state_ };
 
     if (local_queue_ && (! local_queue_->empty()))  {
-        work_unit = local_queue_->front();
+        work_unit = std::move(local_queue_->front());
         local_queue_->pop();
     }
     else  {  // Try to steal tasks from other queues
         for (auto &q : local_queues_)
             if (! q.empty())  {
-                work_unit = q.front();
+                work_unit = std::move(q.front());
                 q.pop();
                 break;
             }
@@ -452,23 +631,68 @@ ThreadPool::get_one_local_task_() noexcept  {
 
 // ----------------------------------------------------------------------------
 
+inline ThreadPool::WorkUnit *
+ThreadPool::get_one_stolen_task_() noexcept  {
+
+    WorkUnit    *work_unit { nullptr };
+
+    if (steal_queue_owner_ == this && steal_queue_->take(work_unit))
+        return (work_unit);
+
+    const StealTable_   *table {
+        steal_table_.load(std::memory_order_acquire)
+    };
+
+    if (table && ! table->queues.empty())  {
+        const std::size_t   q_size { table->queues.size() };
+
+        // Start from a different victim each time, so thieves spread out
+        //
+        steal_seed_ = steal_seed_ * 6364136223846793005ULL +
+                      1442695040888963407ULL;
+
+        const std::size_t   start { (steal_seed_ >> 33) % q_size };
+
+        for (std::size_t i = 0; i < q_size; ++i)  {
+            StealQueueType  *queue { table->queues[(start + i) % q_size] };
+
+            if (queue != steal_queue_ && queue->steal(work_unit))
+                return (work_unit);
+        }
+    }
+    return (nullptr);
+}
+
+// ----------------------------------------------------------------------------
+
 inline bool
 ThreadPool::run_task() noexcept  {
 
-    WorkUnit    work_unit = get_one_local_task_();
+    WorkUnit    work_unit { };
+
+    if (get_sched_policy() == sched_policy::work_stealing)  {
+        const std::unique_ptr<WorkUnit> stolen { get_one_stolen_task_() };
+
+        if (stolen)  {
+            (stolen->func)();  // Execute the callable
+            return (true);
+        }
+    }
+    else
+        work_unit = get_one_local_task_();
 
     if (work_unit.work_type == WORK_TYPE::_undefined_)  {
-        const auto  opt_ret = global_queue_.pop_front(false); // Don't wait
+        auto    opt_ret = global_queue_.pop_front(false); // Don't wait
 
         if (opt_ret.has_value())
-            work_unit = opt_ret.value();
+            work_unit = std::move(opt_ret.value());
     }
     if (work_unit.work_type == WORK_TYPE::_client_service_) {
         (work_unit.func)();  // Execute the callable
         return (true);
     }
     else if (work_unit.work_type != WORK_TYPE::_undefined_)
-        global_queue_.push(work_unit);  // Put it back
+        global_queue_.push(std::move(work_unit));  // Put it back
     return (false);
 }
 
@@ -484,19 +708,41 @@ ThreadPool::thread_routine_(size_type local_q_idx) noexcept  {
 
     std::advance(iter, local_q_idx);
     local_queue_ = &(*iter);
+    steal_queue_ =
+        steal_table_.load(std::memory_order_acquire)->queues[local_q_idx];
+    steal_queue_owner_ = this;
+    steal_seed_ = std::size_t(local_q_idx) + 1;
     ++capacity_threads_;
     while (true)  {
         ++available_threads_;
 
+        const bool  stealing {
+            get_sched_policy() == sched_policy::work_stealing
+        };
         size_type   counter { 0 };
 
-        while (++counter < 80)  run_task();
+        if (stealing)  {
+            // Keep going while there is work anywhere. Go to sleep only
+            // after a stretch of failed attempts.
+            //
+            while (counter < 64)  {
+                if (run_task())  counter = 0;
+                else  {
+                    ++counter;
+                    std::this_thread::yield();
+                }
+            }
+            ++sleeping_threads_;
+        }
+        else
+            while (++counter < 80)  run_task();
 
         WorkUnit    work_unit { };
-        const auto  opt_ret = global_queue_.pop_front(true); // Wait
+        auto        opt_ret = global_queue_.pop_front(true); // Wait
 
+        if (stealing)  --sleeping_threads_;
         if (opt_ret.has_value())
-            work_unit = opt_ret.value();
+            work_unit = std::move(opt_ret.value());
 
         --available_threads_;
 
@@ -507,6 +753,8 @@ ThreadPool::thread_routine_(size_type local_q_idx) noexcept  {
     }
     --capacity_threads_;
     local_queue_ = nullptr;
+    steal_queue_ = nullptr;
+    steal_queue_owner_ = nullptr;
 
     return (true);
 }
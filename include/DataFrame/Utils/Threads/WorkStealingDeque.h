@@ -0,0 +1,143 @@
+// Hossein Moein
+// October 17, 2026
+/*
+Copyright (c) 2023-2028, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// This is a Chase-Lev work-stealing deque.
+// The owner thread pushes and takes from the bottom without locks. Any other
+// thread may steal from the top. Only the steal and the take of the last
+// element contend on an atomic compare-and-swap.
+// T must be trivially copyable (typically a pointer to the work item), so
+// a losing thief never observes a half-moved object.
+//
+template<typename T>
+class   WorkStealingDeque  {
+
+public:
+
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "WorkStealingDeque: T must be trivially copyable");
+
+    using value_type = T;
+    using size_type = long;
+
+#ifdef __cpp_lib_hardware_interference_size
+    inline static constexpr std::size_t CLINE_SIZE =
+        std::hardware_destructive_interference_size;
+#else
+    inline static constexpr std::size_t CLINE_SIZE = 64;
+#endif // __cpp_lib_hardware_interference_size
+
+    explicit WorkStealingDeque(size_type init_capacity = 256);
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque(const WorkStealingDeque &) = delete;
+    WorkStealingDeque &operator = (const WorkStealingDeque &) = delete;
+
+    // Owner thread only
+    //
+    void push(value_type item);
+
+    // Owner thread only. It returns false, if the deque was empty
+    //
+    bool take(value_type &item) noexcept;
+
+    // Any thread. It returns false, if the deque was empty or it lost the
+    // race to another thief or the owner
+    //
+    bool steal(value_type &item) noexcept;
+
+    // These are only a snapshot, when other threads are active
+    //
+    size_type size() const noexcept;
+    bool empty() const noexcept;
+
+private:
+
+    // The capacity is always a power of two
+    //
+    struct  Ring_  {
+
+        explicit Ring_(size_type cap)
+            : mask(cap - 1),
+              slots(std::make_unique<std::atomic<value_type>[]>(cap))  {   }
+
+        inline size_type capacity() const noexcept  { return (mask + 1); }
+        inline value_type get(size_type i) const noexcept  {
+
+            return (slots[i & mask].load(std::memory_order_relaxed));
+        }
+        inline void put(size_type i, value_type item) noexcept  {
+
+            slots[i & mask].store(item, std::memory_order_relaxed);
+        }
+
+        const size_type                         mask;
+        std::unique_ptr<std::atomic<value_type>[]>  slots;
+    };
+
+    Ring_ *grow_(Ring_ *ring, size_type bottom, size_type top);
+
+    alignas(CLINE_SIZE) std::atomic<size_type>  top_ { 0 };
+    alignas(CLINE_SIZE) std::atomic<size_type>  bottom_ { 0 };
+    alignas(CLINE_SIZE) std::atomic<Ring_ *>    ring_ { nullptr };
+
+    // Thieves may still be reading from a ring that the owner has outgrown.
+    // So retired rings live as long as the deque.
+    //
+    std::vector<std::unique_ptr<Ring_>> rings_ { };
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+#ifndef HMDF_DO_NOT_INCLUDE_TCC_FILES
+#  include <DataFrame/Utils/Threads/WorkStealingDeque.tcc>
+#endif // HMDF_DO_NOT_INCLUDE_TCC_FILES
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
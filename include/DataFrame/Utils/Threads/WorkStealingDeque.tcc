@@ -0,0 +1,166 @@
+// Hossein Moein
+// October 17, 2026
+/*
+Copyright (c) 2023-2028, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <DataFrame/Utils/Threads/WorkStealingDeque.h>
+
+#include <algorithm>
+#include <bit>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+template<typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_type init_capacity)  {
+
+    const size_type cap {
+        size_type(std::bit_ceil(std::size_t(std::max(init_capacity,
+                                                      size_type(2)))))
+    };
+
+    rings_.push_back(std::make_unique<Ring_>(cap));
+    ring_.store(rings_.back().get(), std::memory_order_relaxed);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename WorkStealingDeque<T>::Ring_ *
+WorkStealingDeque<T>::grow_(Ring_ *ring, size_type bottom, size_type top)  {
+
+    auto    new_ring = std::make_unique<Ring_>(ring->capacity() * 2);
+
+    for (size_type i = top; i < bottom; ++i)
+        new_ring->put(i, ring->get(i));
+    rings_.push_back(std::move(new_ring));
+    ring = rings_.back().get();
+    ring_.store(ring, std::memory_order_release);
+    return (ring);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+void
+WorkStealingDeque<T>::push(value_type item)  {
+
+    const size_type bottom { bottom_.load(std::memory_order_relaxed) };
+    const size_type top { top_.load(std::memory_order_acquire) };
+    Ring_           *ring { ring_.load(std::memory_order_relaxed) };
+
+    if ((bottom - top) > (ring->capacity() - 1)) [[unlikely]]
+        ring = grow_(ring, bottom, top);
+    ring->put(bottom, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+bool
+WorkStealingDeque<T>::take(value_type &item) noexcept  {
+
+    const size_type bottom { bottom_.load(std::memory_order_relaxed) - 1 };
+    Ring_           *ring { ring_.load(std::memory_order_relaxed) };
+
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    size_type   top { top_.load(std::memory_order_relaxed) };
+    bool        ret { true };
+
+    if (top <= bottom)  {
+        item = ring->get(bottom);
+        if (top == bottom)  {  // Last one. Race the thieves for it
+            if (! top_.compare_exchange_strong(top, top + 1,
+                                               std::memory_order_seq_cst,
+                                               std::memory_order_relaxed))
+                ret = false;
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+    }
+    else  {
+        ret = false;
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return (ret);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+bool
+WorkStealingDeque<T>::steal(value_type &item) noexcept  {
+
+    size_type   top { top_.load(std::memory_order_acquire) };
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const size_type bottom { bottom_.load(std::memory_order_acquire) };
+
+    if (top < bottom)  {
+        const Ring_ *ring { ring_.load(std::memory_order_acquire) };
+
+        item = ring->get(top);
+        return (top_.compare_exchange_strong(top, top + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed));
+    }
+    return (false);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+typename WorkStealingDeque<T>::size_type
+WorkStealingDeque<T>::size() const noexcept  {
+
+    const size_type bottom { bottom_.load(std::memory_order_relaxed) };
+    const size_type top { top_.load(std::memory_order_relaxed) };
+
+    return (bottom > top ? bottom - top : size_type(0));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T>
+bool
+WorkStealingDeque<T>::empty() const noexcept  { return (size() == 0); }
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,354 @@
+// Hossein Moein
+// October 17, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <DataFrame/Utils/DateTime.h>
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// Timestamp is a compact alternative to DateTime. It is only the number of
+// nanoseconds since epoch in a 64-bit integer. So it is 8 bytes (DateTime
+// is 32 bytes) and comparing, sorting and subtracting them is integer
+// arithmetic.
+// A Timestamp is always in UTC. Its calendar parts (e.g. year(), hour())
+// are computed from the integer when they are asked for. If you need them
+// in another time zone, convert it to a DateTime by to_datetime().
+//
+class   Timestamp  {
+
+public:
+
+    using DateType = DateTime::DateType;
+    using DatePartType = DateTime::DatePartType;
+    using HourType = DateTime::HourType;
+    using MinuteType = DateTime::MinuteType;
+    using SecondType = DateTime::SecondType;
+    using MillisecondType = DateTime::MillisecondType;
+    using MicrosecondType = DateTime::MicrosecondType;
+    using NanosecondType = DateTime::NanosecondType;
+    using EpochType = DateTime::EpochType;
+    using LongTimeType = DateTime::LongTimeType;
+
+    // Initialized to epoch
+    //
+    constexpr Timestamp () noexcept = default;
+
+    constexpr explicit
+    Timestamp (LongTimeType nanos) noexcept : nanos_ (nanos)  {   }
+    constexpr
+    Timestamp (EpochType the_time, NanosecondType nanosec) noexcept
+        : nanos_ (LongTimeType(the_time) * NANOS_IN_SEC_ + nanosec)  {   }
+    explicit
+    Timestamp (const DateTime &dt) noexcept : nanos_ (dt.long_time ())  {   }
+
+    // Same formats as DateTime string constructors. The strings are in
+    // time zone tz, unless they specify their own.
+    //
+    explicit
+    Timestamp (const char *s,
+               DT_DATE_STYLE ds = DT_DATE_STYLE::YYYYMMDD,
+               DT_TIME_ZONE tz = DT_TIME_ZONE::GMT)
+        : Timestamp (DateTime (s, ds, tz))  {   }
+    Timestamp (std::string_view s, DT_DATE_STYLE ds, DT_TIME_ZONE tz)
+        : Timestamp (DateTime (s, ds, tz))  {   }
+
+    // The only conversion that could be expensive. For time zones other
+    // than GMT/UTC it goes through the time zone rules.
+    //
+    [[nodiscard]] inline DateTime
+    to_datetime (DT_TIME_ZONE tz = DT_TIME_ZONE::GMT) const  {
+
+        DateTime    result { DateType(19700101), 0, 0, 0, 0, tz };
+
+        result.set_time (this->time (), nanosec ());
+        return (result);
+    }
+    inline explicit operator DateTime () const  { return (to_datetime ()); }
+
+    // So generic code written for DateTime works for Timestamp too
+    //
+    [[nodiscard]] constexpr DT_TIME_ZONE
+    get_timezone () const noexcept  { return (DT_TIME_ZONE::GMT); }
+
+    [[nodiscard]] constexpr LongTimeType
+    long_time () const noexcept  { return (nanos_); }  // Nanosec since epoch
+    [[nodiscard]] constexpr EpochType
+    time () const noexcept  {                           // Like ::time()
+
+        return (EpochType(floor_div_ (nanos_, NANOS_IN_SEC_)));
+    }
+    [[nodiscard]] constexpr NanosecondType
+    nanosec () const noexcept  {                        // 0 - 999,999,999
+
+        return (NanosecondType(floor_mod_ (nanos_, NANOS_IN_SEC_)));
+    }
+
+    // These are rounded, the same as DateTime
+    //
+    [[nodiscard]] constexpr MicrosecondType
+    microsec () const noexcept  {                       // 0 - 999,999
+
+        const MicrosecondType   us = (nanosec () + 500) / 1000;
+
+        return (us < 1000000 ? us : 999999);
+    }
+    [[nodiscard]] constexpr MillisecondType
+    msec () const noexcept  {                           // 0 - 999
+
+        const NanosecondType    ms = (nanosec () + 500000) / 1000000;
+
+        return (MillisecondType(ms < 1000 ? ms : 999));
+    }
+
+    [[nodiscard]] constexpr EpochType
+    days () const noexcept  {                    // Total days since epoch
+
+        return (EpochType(floor_div_ (nanos_, NANOS_IN_DAY_)));
+    }
+    [[nodiscard]] constexpr HourType
+    hour () const noexcept  {                    // 0 - 23
+
+        return (HourType(sec_of_day_ () / 3600));
+    }
+    [[nodiscard]] constexpr MinuteType
+    minute () const noexcept  {                  // 0 - 59
+
+        return (MinuteType((sec_of_day_ () % 3600) / 60));
+    }
+    [[nodiscard]] constexpr SecondType
+    sec () const noexcept  {                     // 0 - 59
+
+        return (SecondType(sec_of_day_ () % 60));
+    }
+    [[nodiscard]] constexpr DateType
+    date () const noexcept  {                    // eg. 20020303
+
+        const Civil_    c = civil_ ();
+
+        return (DateType(c.year * 10000 + c.month * 100 + c.day));
+    }
+    [[nodiscard]] constexpr DatePartType
+    year () const noexcept  { return (DatePartType(civil_ ().year)); }
+    [[nodiscard]] constexpr DT_MONTH
+    month () const noexcept  { return (DT_MONTH(civil_ ().month)); }
+    [[nodiscard]] constexpr DatePartType
+    dmonth () const noexcept  { return (DatePartType(civil_ ().day)); }
+    [[nodiscard]] constexpr DatePartType
+    dyear () const noexcept  {                   // 1 - 366
+
+        return (DatePartType(days () -
+                             days_from_civil_ (civil_ ().year, 1, 1) + 1));
+    }
+    [[nodiscard]] constexpr DT_WEEKDAY
+    dweek () const noexcept  {                   // SUN - SAT
+
+        // 01/01/1970 was a Thursday
+        //
+        return (DT_WEEKDAY(floor_mod_ (days () + 4, 7) + 1));
+    }
+
+    // Seconds since epoch including the fraction, like DateTime
+    //
+    constexpr operator double () const noexcept  {
+
+        return (double(this->time ()) + double(nanosec ()) / 1e9);
+    }
+
+    // These return the diff including the fraction of the unit.
+    // The diff could be +/- based on "this - that"
+    //
+    [[nodiscard]] constexpr double
+    diff_seconds (const Timestamp &that) const noexcept  {
+
+        return (double(nanos_ - that.nanos_) / 1e9);
+    }
+    [[nodiscard]] constexpr double
+    diff_minutes (const Timestamp &that) const noexcept  {
+
+        return (diff_seconds (that) / 60.0);
+    }
+    [[nodiscard]] constexpr double
+    diff_hours (const Timestamp &that) const noexcept  {
+
+        return (diff_seconds (that) / 3600.0);
+    }
+    [[nodiscard]] constexpr double
+    diff_days (const Timestamp &that) const noexcept  {
+
+        return (diff_seconds (that) / 86400.0);
+    }
+
+    // The parameter to these methods could be +/-.
+    //
+    constexpr void
+    add_nanoseconds (LongTimeType nanosecs) noexcept  { nanos_ += nanosecs; }
+    constexpr void
+    add_seconds (EpochType secs) noexcept  {
+
+        nanos_ += LongTimeType(secs) * NANOS_IN_SEC_;
+    }
+    constexpr void
+    add_days (long days) noexcept  {
+
+        nanos_ += LongTimeType(days) * NANOS_IN_DAY_;
+    }
+
+    // Formats date/time in GMT. See DateTime::string_format()
+    //
+    [[nodiscard]] inline std::string
+    string_format (DT_FORMAT format) const  {
+
+        return (to_datetime ().string_format (format));
+    }
+    inline std::size_t
+    format_to (char *buffer, DT_FORMAT format) const  {
+
+        return (to_datetime ().format_to (buffer, format));
+    }
+
+    friend constexpr bool
+    operator == (const Timestamp &, const Timestamp &) noexcept = default;
+    friend constexpr std::strong_ordering
+    operator <=> (const Timestamp &, const Timestamp &) noexcept = default;
+
+private:
+
+    inline static constexpr LongTimeType    NANOS_IN_SEC_ { 1000000000LL };
+    inline static constexpr LongTimeType    NANOS_IN_DAY_ {
+        NANOS_IN_SEC_ * 24 * 60 * 60
+    };
+
+    struct  Civil_  {
+        long long       year;
+        unsigned int    month;
+        unsigned int    day;
+    };
+
+    [[nodiscard]] static constexpr LongTimeType
+    floor_div_ (LongTimeType a, LongTimeType b) noexcept  {
+
+        return (a / b - (a % b < 0));
+    }
+    [[nodiscard]] static constexpr LongTimeType
+    floor_mod_ (LongTimeType a, LongTimeType b) noexcept  {
+
+        return (a - floor_div_ (a, b) * b);
+    }
+    [[nodiscard]] constexpr LongTimeType
+    sec_of_day_ () const noexcept  {
+
+        return (floor_mod_ (nanos_, NANOS_IN_DAY_) / NANOS_IN_SEC_);
+    }
+
+    // Howard Hinnant's days <-> civil date algorithms
+    //
+    [[nodiscard]] static constexpr LongTimeType
+    days_from_civil_ (long long y, unsigned int m, unsigned int d) noexcept  {
+
+        y -= m <= 2;
+
+        const long long     era = (y >= 0 ? y : y - 399) / 400;
+        const unsigned int  yoe = unsigned(y - era * 400);
+        const unsigned int  doy =
+            (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+        const unsigned int  doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+        return (era * 146097 + LongTimeType(doe) - 719468);
+    }
+    [[nodiscard]] constexpr Civil_ civil_ () const noexcept  {
+
+        const LongTimeType  z = days () + 719468;
+        const LongTimeType  era = (z >= 0 ? z : z - 146096) / 146097;
+        const unsigned int  doe = unsigned(z - era * 146097);
+        const unsigned int  yoe =
+            (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const unsigned int  doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const unsigned int  mp = (5 * doy + 2) / 153;
+        const unsigned int  d = doy - (153 * mp + 2) / 5 + 1;
+        const unsigned int  m = mp < 10 ? mp + 3 : mp - 9;
+
+        return (Civil_ { (LongTimeType(yoe) + era * 400) + (m <= 2), m, d });
+    }
+
+    LongTimeType    nanos_ { 0 };
+};
+
+// ----------------------------------------------------------------------------
+
+template<typename S>
+inline S &operator << (S &o, const Timestamp &rhs)  {
+
+    return (o << rhs.string_format (DT_FORMAT::ISO_DT_NANO));
+}
+
+// ----------------------------------------------------------------------------
+
+// The difference in seconds, like DateTime. It is computed on the integers,
+// so there is no loss of precision before the result.
+//
+[[nodiscard]] constexpr double
+operator - (const Timestamp &lhs, const Timestamp &rhs) noexcept  {
+
+    return (lhs.diff_seconds (rhs));
+}
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+namespace std  {
+template<>
+struct  hash<typename hmdf::Timestamp>  {
+
+    inline size_t
+    operator()(const typename hmdf::Timestamp &key) const noexcept  {
+
+        return (hash<hmdf::Timestamp::LongTimeType>()(key.long_time()));
+    }
+};
+
+} // namespace std
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -36,9 +36,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <streambuf>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif // _WIN32
 
 // ----------------------------------------------------------------------------
 
@@ -451,6 +460,140 @@ private:
     char    buffer_[SIZ];
 };
 
+// ----------------------------------------------------------------------------
+
+// It maps a whole file read-only into memory. On platforms without mmap,
+// the file is read into a buffer instead.
+//
+struct  IOMmapOpti  {
+
+    const char  *data { nullptr };
+    std::size_t size { 0 };
+
+    // If sequential is true, the kernel is advised that the mapping will be
+    // read front to back. Otherwise, it is advised of random access.
+    //
+    explicit
+    IOMmapOpti(const char *file_name, bool sequential = true)  {
+
+#ifdef _WIN32
+        (void) sequential;
+
+        std::FILE   *file = std::fopen(file_name, "rb");
+
+        if (file)  {
+            std::fseek(file, 0, SEEK_END);
+
+            const long  file_size = std::ftell(file);
+
+            std::fseek(file, 0, SEEK_SET);
+            if (file_size > 0)  {
+                buffer_.resize(std::size_t(file_size));
+                size = std::fread(buffer_.data(), 1, buffer_.size(), file);
+                data = buffer_.data();
+            }
+            std::fclose(file);
+        }
+        const bool  opened = file != nullptr;
+#else
+        const int   fd = ::open(file_name, O_RDONLY);
+        const bool  opened = fd >= 0;
+
+        if (opened)  {
+            struct stat st;
+
+            if (::fstat(fd, &st) == 0 && st.st_size > 0)  {
+                void    *addr = ::mmap(nullptr, std::size_t(st.st_size),
+                                       PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (addr != MAP_FAILED)  {
+                    ::madvise(addr, std::size_t(st.st_size),
+                              sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+                    data = static_cast<const char *>(addr);
+                    size = std::size_t(st.st_size);
+                }
+            }
+            ::close(fd);
+        }
+#endif // _WIN32
+
+#ifdef HMDF_SANITY_EXCEPTIONS
+        if (! opened) [[unlikely]]  {
+            String1K    err;
+
+            err.printf("IOMmapOpti: ERROR: Unable to open file '%s'",
+                       file_name);
+            throw DataFrameError(err.c_str());
+        }
+#else
+        (void) opened;
+#endif // HMDF_SANITY_EXCEPTIONS
+    }
+
+    ~IOMmapOpti ()  {
+
+#ifndef _WIN32
+        if (data)  ::munmap(const_cast<char *>(data), size);
+#endif // _WIN32
+    }
+
+    IOMmapOpti () = delete;
+    IOMmapOpti (const IOMmapOpti &) = delete;
+    IOMmapOpti &operator = (const IOMmapOpti &) = delete;
+
+private:
+
+#ifdef _WIN32
+    std::vector<char>   buffer_ { };
+#endif // _WIN32
+};
+
+// ----------------------------------------------------------------------------
+
+// A read-only stream buffer over a block of memory (e.g. a memory-mapped
+// file). It lets the stream based readers parse the block in place.
+//
+class   MemStreamBuf : public std::streambuf  {
+
+public:
+
+    MemStreamBuf(const char *data, std::size_t size)  {
+
+        char    *begin = const_cast<char *>(data);
+
+        setg(begin, begin, begin + size);
+    }
+
+    MemStreamBuf () = delete;
+    MemStreamBuf (const MemStreamBuf &) = delete;
+    MemStreamBuf &operator = (const MemStreamBuf &) = delete;
+
+protected:
+
+    pos_type
+    seekoff(off_type off,
+            std::ios_base::seekdir dir,
+            std::ios_base::openmode which) override  {
+
+        if (! (which & std::ios_base::in))  return (pos_type(off_type(-1)));
+
+        char    *base = dir == std::ios_base::beg
+                            ? eback()
+                            : dir == std::ios_base::cur ? gptr() : egptr();
+
+        if (off < eback() - base || off > egptr() - base)
+            return (pos_type(off_type(-1)));
+        setg(eback(), base + off, egptr());
+        return (pos_type(off_type(gptr() - eback())));
+    }
+
+    pos_type
+    seekpos(pos_type pos, std::ios_base::openmode which) override  {
+
+        return (seekoff(off_type(pos), std::ios_base::beg, which));
+    }
+};
+
 } // namespace hmdf
 
 // ----------------------------------------------------------------------------
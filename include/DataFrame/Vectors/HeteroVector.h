@@ -35,9 +35,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Vectors/HeteroPtrView.h>
 #include <DataFrame/Vectors/HeteroView.h>
 
+#include <cstddef>
 #include <functional>
 #include <new>
 #include <type_traits>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 
@@ -50,6 +52,12 @@ namespace hmdf
 // are partly inspired by Andy G's Blog at:
 // https://gieseanw.wordpress.com/2017/05/03/a-true-heterogeneous-container/
 //
+// The first type stored in a HeteroVector is kept inline inside the object
+// behind a small type-erased header. Accessing it costs a typeid check
+// instead of a hash-map probe. This is the common case for DataFrame
+// columns, which only ever hold one type. Any additional types fall back
+// to the static per-type maps.
+//
 template<std::size_t A = 0>
 struct HeteroVector  {
 
@@ -59,12 +67,12 @@ struct HeteroVector  {
 
     HeteroVector();
     HeteroVector(const HeteroVector &that);
-    HeteroVector(HeteroVector &&that);
+    HeteroVector(HeteroVector &&that) noexcept;
 
     ~HeteroVector() { clear(); }
 
     HeteroVector &operator= (const HeteroVector &rhs);
-    HeteroVector &operator= (HeteroVector &&rhs);
+    HeteroVector &operator= (HeteroVector &&rhs) noexcept;
 
     template<typename T>
     [[nodiscard]] std::vector<T, typename allocator_declare<T, A>::type> &
@@ -236,6 +244,48 @@ private:
     template<typename T>
     using vec_t = std::vector<T, typename allocator_declare<T, A>::type>;
 
+    // Inline storage for the first type. It is sized for a std::vector with
+    // a stateless allocator.
+    //
+    static constexpr size_type  inline_size_ { 4 * sizeof(void *) };
+
+    struct  InlineHeader  {
+
+        const std::type_info    *type { nullptr };
+        void                    (*destroy)(void *) { nullptr };
+        void                    (*copy)(const void *from, void *to)
+                                    { nullptr };
+        void                    (*move)(void *from, void *to) { nullptr };
+    };
+
+    template<typename T>
+    static constexpr bool   fits_inline_ =
+        sizeof(vec_t<T>) <= inline_size_ &&
+        alignof(vec_t<T>) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<vec_t<T>>;
+
+    InlineHeader    inline_header_ { };
+    alignas(std::max_align_t)
+    unsigned char   inline_storage_[inline_size_];
+
+    template<typename T>
+    [[nodiscard]] inline bool is_inline_type_() const noexcept;
+    template<typename T>
+    [[nodiscard]] inline vec_t<T> *inline_vector_() noexcept;
+    template<typename T>
+    [[nodiscard]] inline const vec_t<T> *inline_vector_() const noexcept;
+
+    // It returns nullptr, if there is no vector of type T
+    //
+    template<typename T>
+    [[nodiscard]] vec_t<T> *find_vector_() noexcept;
+    template<typename T>
+    [[nodiscard]] const vec_t<T> *find_vector_() const noexcept;
+
+    template<typename T>
+    void make_inline_();
+    void clear_inline_() noexcept;
+
     template<typename T>
     inline static
     std::unordered_map<
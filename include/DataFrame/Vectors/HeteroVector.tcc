@@ -30,6 +30,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Vectors/HeteroVector.h>
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 
 // ----------------------------------------------------------------------------
@@ -37,15 +38,113 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace hmdf
 {
 
+template<std::size_t A>
+template<typename T>
+bool HeteroVector<A>::is_inline_type_() const noexcept  {
+
+    return (inline_header_.type == &typeid(T) ||
+            (inline_header_.type && *(inline_header_.type) == typeid(T)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+typename HeteroVector<A>::template vec_t<T> *
+HeteroVector<A>::inline_vector_() noexcept  {
+
+    return (std::launder(reinterpret_cast<vec_t<T> *>(inline_storage_)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+const typename HeteroVector<A>::template vec_t<T> *
+HeteroVector<A>::inline_vector_() const noexcept  {
+
+    return (std::launder(
+                reinterpret_cast<const vec_t<T> *>(inline_storage_)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+typename HeteroVector<A>::template vec_t<T> *
+HeteroVector<A>::find_vector_() noexcept  {
+
+    if (is_inline_type_<T>()) [[likely]]
+        return (inline_vector_<T>());
+
+    auto    iter = vectors_<T>.find (this);
+
+    return (iter != vectors_<T>.end() ? &(iter->second) : nullptr);
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+const typename HeteroVector<A>::template vec_t<T> *
+HeteroVector<A>::find_vector_() const noexcept  {
+
+    return (const_cast<HeteroVector *>(this)->find_vector_<T>());
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+template<typename T>
+void HeteroVector<A>::make_inline_()  {
+
+    ::new (static_cast<void *>(inline_storage_)) vec_t<T>();
+    inline_header_.type = &typeid(T);
+    inline_header_.destroy = [](void *vec)  {
+        std::destroy_at(std::launder(reinterpret_cast<vec_t<T> *>(vec)));
+    };
+    inline_header_.copy = [](const void *from, void *to)  {
+        ::new (to) vec_t<T>(
+            *std::launder(reinterpret_cast<const vec_t<T> *>(from)));
+    };
+    inline_header_.move = [](void *from, void *to)  {
+        ::new (to) vec_t<T>(
+            std::move(*std::launder(reinterpret_cast<vec_t<T> *>(from))));
+    };
+}
+
+// ----------------------------------------------------------------------------
+
+template<std::size_t A>
+void HeteroVector<A>::clear_inline_() noexcept  {
+
+    if (inline_header_.type)  {
+        inline_header_.destroy(inline_storage_);
+        inline_header_ = { };
+    }
+}
+
+// ----------------------------------------------------------------------------
+
 template<std::size_t A>
 template<typename T>
 std::vector<T, typename allocator_declare<T, A>::type> &HeteroVector<A>::
 get_vector()  {
 
+    if (is_inline_type_<T>()) [[likely]]
+        return (*inline_vector_<T>());
+
+    if constexpr (fits_inline_<T>)  {
+        if (! inline_header_.type)  {
+            make_inline_<T>();
+            return (*inline_vector_<T>());
+        }
+    }
+
     auto    iter = vectors_<T>.find (this);
 
     // don't have it yet, so create functions for copying and destroying
-    if (iter == vectors_<T>.end()) [[likely]]  {
+    if (iter == vectors_<T>.end())  {
         clear_functions_.emplace_back (
             [](HeteroVector &hv) { vectors_<T>.erase(&hv); });
 
@@ -168,10 +267,10 @@ template<std::size_t A>
 template<typename T, typename U>
 void HeteroVector<A>::visit_impl_help_ (T &visitor)  {
 
-    auto    iter = vectors_<U>.find (this);
+    auto    *vec = find_vector_<U>();
 
-    if (iter != vectors_<U>.end()) [[likely]]
-        for (auto &&element : iter->second)
+    if (vec) [[likely]]
+        for (auto &&element : *vec)
             visitor(element);
 }
 
@@ -181,10 +280,10 @@ template<std::size_t A>
 template<typename T, typename U>
 void HeteroVector<A>::visit_impl_help_ (T &visitor) const  {
 
-    const auto  citer = vectors_<U>.find (this);
+    const auto  *vec = find_vector_<U>();
 
-    if (citer != vectors_<U>.end()) [[likely]]
-        for (auto &&element : citer->second)
+    if (vec) [[likely]]
+        for (auto &&element : *vec)
             visitor(element);
 }
 
@@ -194,10 +293,10 @@ template<std::size_t A>
 template<typename T, typename U>
 void HeteroVector<A>::sort_impl_help_ (T &functor)  {
 
-    auto    iter = vectors_<U>.find (this);
+    auto    *vec = find_vector_<U>();
 
-    if (iter != vectors_<U>.end()) [[likely]]
-        std::sort (iter->second.begin(), iter->second.end(), functor);
+    if (vec) [[likely]]
+        std::sort (vec->begin(), vec->end(), functor);
 }
 
 // ----------------------------------------------------------------------------
@@ -206,10 +305,10 @@ template<std::size_t A>
 template<typename T, typename U>
 void HeteroVector<A>::change_impl_help_ (T &functor)  {
 
-    auto    iter = vectors_<U>.find (this);
+    auto    *vec = find_vector_<U>();
 
-    if (iter != vectors_<U>.end())
-        functor(iter->second);
+    if (vec)
+        functor(*vec);
 }
 
 // ----------------------------------------------------------------------------
@@ -218,10 +317,14 @@ template<std::size_t A>
 template<typename T, typename U>
 void HeteroVector<A>::change_impl_help_ (T &functor) const  {
 
-    const auto  citer = vectors_<U>.find (this);
+    // change() always hands the functor a mutable column, even through a
+    // const HeteroVector. DataFrame relies on it (e.g. make_consistent(),
+    // views of const DataFrames)
+    //
+    auto    *vec = const_cast<vec_t<U> *>(find_vector_<U>());
 
-    if (citer != vectors_<U>.end()) [[likely]]
-        functor(citer->second);
+    if (vec) [[likely]]
+        functor(*vec);
 }
 
 // ----------------------------------------------------------------------------
@@ -366,19 +469,17 @@ const T &HeteroVector<A>::front() const  { return (get_vector<T>().front ()); }
 // ----------------------------------------------------------------------------
 
 template<std::size_t A>
-HeteroVector<A>::HeteroVector ()  {
-
-    clear_functions_.reserve(2);
-    copy_functions_.reserve(2);
-    move_functions_.reserve(2);
-}
+HeteroVector<A>::HeteroVector () = default;
 
 // ----------------------------------------------------------------------------
 
 template<std::size_t A>
 HeteroVector<A>::HeteroVector (const HeteroVector &that)  { *this = that; }
 template<std::size_t A>
-HeteroVector<A>::HeteroVector (HeteroVector &&that)  { *this = that; }
+HeteroVector<A>::HeteroVector (HeteroVector &&that) noexcept  {
+
+    *this = std::move(that);
+}
 
 // ----------------------------------------------------------------------------
 
@@ -387,6 +488,11 @@ HeteroVector<A> &HeteroVector<A>::operator= (const HeteroVector &rhs)  {
 
     if (&rhs != this) [[likely]]  {
         clear();
+        if (rhs.inline_header_.type)  {
+            rhs.inline_header_.copy(rhs.inline_storage_, inline_storage_);
+            inline_header_ = rhs.inline_header_;
+        }
+
         clear_functions_ = rhs.clear_functions_;
         copy_functions_ = rhs.copy_functions_;
         move_functions_ = rhs.move_functions_;
@@ -401,16 +507,27 @@ HeteroVector<A> &HeteroVector<A>::operator= (const HeteroVector &rhs)  {
 // ----------------------------------------------------------------------------
 
 template<std::size_t A>
-HeteroVector<A> &HeteroVector<A>::operator= (HeteroVector &&rhs)  {
+HeteroVector<A> &HeteroVector<A>::operator= (HeteroVector &&rhs) noexcept  {
 
     if (&rhs != this) [[likely]]  {
         clear();
+        if (rhs.inline_header_.type)  {
+            rhs.inline_header_.move(rhs.inline_storage_, inline_storage_);
+            inline_header_ = rhs.inline_header_;
+            rhs.clear_inline_();
+        }
+
+        for (auto &&move_function : rhs.move_functions_)
+            move_function(rhs, *this);
+        for (auto &&clear_func : rhs.clear_functions_)
+            clear_func (rhs);
+
         clear_functions_ = std::move(rhs.clear_functions_);
         copy_functions_ = std::move(rhs.copy_functions_);
         move_functions_ = std::move(rhs.move_functions_);
-
-        for (auto &&move_function : move_functions_)
-            move_function(rhs, *this);
+        rhs.clear_functions_.clear();
+        rhs.copy_functions_.clear();
+        rhs.move_functions_.clear();
     }
 
     return (*this);
@@ -421,8 +538,12 @@ HeteroVector<A> &HeteroVector<A>::operator= (HeteroVector &&rhs)  {
 template<std::size_t A>
 void HeteroVector<A>::clear()  {
 
+    clear_inline_();
     for (auto &&clear_func : clear_functions_)
         clear_func (*this);
+    clear_functions_.clear();
+    copy_functions_.clear();
+    move_functions_.clear();
 }
 
 } // namespace hmdf
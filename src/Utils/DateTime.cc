@@ -29,11 +29,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <DataFrame/Utils/DateTime.h>
 
+#include <algorithm>
 #include <cassert>
+#include <charconv>
 #include <cctype>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #ifdef _WIN32
 #  define WIN32_LEAN_AND_MEAN
@@ -147,188 +157,182 @@ DateTime::DateTime (DateType d,
 //  (22) YYYY-MM-DD HH:MM:SS.NNNNNNNNN [TZN]  // Nanoseconds
 //
 DateTime::DateTime (const char *s, DT_DATE_STYLE ds, DT_TIME_ZONE tz)
+    : DateTime (std::string_view (s), ds, tz)  {   }
+
+// ----------------------------------------------------------------------------
+
+DateTime::DateTime (std::string_view s, DT_DATE_STYLE ds, DT_TIME_ZONE tz)
     : time_zone_ (tz)  {
 
-    const char  *str = s;
+    DateCache   cache;
 
-    while (::isspace (*str)) ++str;
+    parse_ (s, ds, cache);
+}
 
-    std::size_t str_len { std::strlen(str) };
+// ----------------------------------------------------------------------------
+
+DateTime::DateTime (std::string_view s,
+                    DT_DATE_STYLE ds,
+                    DT_TIME_ZONE tz,
+                    DateCache &cache)
+    : time_zone_ (tz)  {
+
+    parse_ (s, ds, cache);
+}
+
+// ----------------------------------------------------------------------------
+
+// It reads up to max_digits decimal digits into value and returns the
+// number of digits read
+//
+static inline std::size_t
+_read_digits_(const char *&c,
+              const char *end,
+              unsigned int &value,
+              std::size_t max_digits) noexcept  {
+
+    std::size_t n { 0 };
+
+    value = 0;
+    while (c < end && n < max_digits && *c >= '0' && *c <= '9')  {
+        value = value * 10 + static_cast<unsigned int>(*c++ - '0');
+        n += 1;
+    }
+    return (n);
+}
+
+// ----------------------------------------------------------------------------
 
-    assert(str_len > 3);
+void DateTime::parse_ (std::string_view s, DT_DATE_STYLE ds, DateCache &cache)  {
 
-    const bool  has_str_tz =
-        std::isalpha(str[str_len - 1]) &&
-        std::isalpha(str[str_len - 2]) &&
-        std::isalpha(str[str_len - 3]) &&
-        std::isspace(str[str_len - 4]);
-    char        str_tz[4];
+    const char  *str = s.data ();
+    const char  *end = str + s.size ();
 
-    if (has_str_tz)  {
-        str_tz[0] = str[str_len - 3];
-        str_tz[1] = str[str_len - 2];
-        str_tz[2] = str[str_len - 1];
-        str_tz[3] = '\0';
+    while (str < end && std::isspace (*str)) ++str;
 
-        const auto  &citer = ZONE_STR_TO_TIME_ZONE.find(str_tz);
+    if (end - str > 3 &&
+        std::isalpha(end[-1]) &&
+        std::isalpha(end[-2]) &&
+        std::isalpha(end[-3]) &&
+        std::isspace(end[-4]))  {
+        const std::string_view  str_tz { end - 3, 3 };
+        const auto              &citer = ZONE_STR_TO_TIME_ZONE.find(str_tz);
 
         if (citer != ZONE_STR_TO_TIME_ZONE.end()) [[likely]]
             time_zone_ = citer->second;
         else  {
             String64    err;
 
-            err.printf ("DateTime::DateTime(const char *): Cannot find  "
-                        "time zone '%s'", str_tz);
+            err.printf ("DateTime::DateTime(): Cannot find  "
+                        "time zone '%.*s'", 3, str_tz.data());
             throw std::runtime_error (err.c_str ());
         }
+        end -= 4;  // 1 space + 3 time zone letters
     }
+    if (ds != DT_DATE_STYLE::YYYYMMDD)
+        end = std::find(str, end, '+');
 
-    if (ds == DT_DATE_STYLE::YYYYMMDD)  {
-        *this = str;
-    }
-    else  {
-        str_len = 0;
-        for (const char *c = str; *c != '\0' && *c != '+'; ++c)
-            str_len += 1;
-        if (has_str_tz)  str_len -= 4;  // 1 space + 3 time zone letters
+    time_ = INVALID_TIME_T_;
+    week_day_ = DT_WEEKDAY::BAD_DAY;
+    hour_ = minute_ = second_ = 0;
+    nanosecond_ = 0;
 
-        int year { 0 }, month { 0 }, day { 0 };
+    const std::size_t   str_len = end - str;
 
-        hour_ = minute_ = second_ = nanosecond_ = 0;
-        if (ds == DT_DATE_STYLE::AME_STYLE)  {
-            if (str_len <= 10)  {
-                ::sscanf (str, "%d/%d/%d", &month, &day, &year);
-            }
-            else if (str_len == 13)  {
-                ::sscanf (str, "%d/%d/%d %hu", &month, &day, &year, &hour_);
-            }
-            else if (str_len == 16)  {
-                ::sscanf (str, "%d/%d/%d %hu:%hu",
-                          &month, &day, &year, &hour_, &minute_);
-            }
-            else if (str_len == 19)  {
-                ::sscanf (str, "%d/%d/%d %hu:%hu:%hu",
-                          &month, &day, &year, &hour_, &minute_, &second_);
-            }
-            else if (str_len > 19 && str_len <= 23)  {
-                MillisecondType ms { 0 };
-
-                ::sscanf(str, "%d/%d/%d %hu:%hu:%hu.%hd",
-                         &month, &day, &year, &hour_, &minute_, &second_, &ms);
-                if (str_len <= 21)  ms *= 100;
-                else if (str_len == 22)  ms *= 10;
-                nanosecond_ = ms * 1000000;
-            }
-            else if (str_len > 23 && str_len <= 26)  {
-                MicrosecondType micros { 0 };
-
-                ::sscanf (str, "%d/%d/%d %hu:%hu:%hu.%d",
-                          &month, &day, &year,
-                          &hour_, &minute_, &second_, &micros);
-                if (str_len <= 24)  micros *= 100;
-                else if (str_len <= 25)  micros *= 10;
-                nanosecond_ = micros * 1000;
-            }
-            else if (str_len > 26)  {
-                ::sscanf (str, "%d/%d/%d %hu:%hu:%hu.%d",
-                          &month, &day, &year,
-                          &hour_, &minute_, &second_, &nanosecond_);
-            }
-        }
-        else if (ds == DT_DATE_STYLE::EUR_STYLE)  {
-            if (str_len <= 10)  {
-                ::sscanf (str, "%d/%d/%d", &year, &month, &day);
-            }
-            else if (str_len == 13)  {
-                ::sscanf (str, "%d/%d/%d %hu", &year, &month, &day, &hour_);
-            }
-            else if (str_len == 16)  {
-                ::sscanf (str, "%d/%d/%d %hu:%hu",
-                          &year, &month, &day, &hour_, &minute_);
-            }
-            else if (str_len == 19)  {
-                ::sscanf (str, "%d/%d/%d %hu:%hu:%hu",
-                          &year, &month, &day, &hour_, &minute_, &second_);
-            }
-            else if (str_len > 19 && str_len <= 23)  {
-                MillisecondType ms { 0 };
-
-                ::sscanf(str, "%d/%d/%d %hu:%hu:%hu.%hd",
-                         &year, &month, &day, &hour_, &minute_, &second_, &ms);
-                if (str_len <= 21)  ms *= 100;
-                else if (str_len == 22)  ms *= 10;
-                nanosecond_ = ms * 1000000;
-            }
-            else if (str_len > 23 && str_len <= 26)  {
-                MicrosecondType micros { 0 };
-
-                ::sscanf (str, "%d/%d/%d %hu:%hu:%hu.%d",
-                          &year, &month, &day,
-                          &hour_, &minute_, &second_, &micros);
-                if (str_len <= 24)  micros *= 100;
-                else if (str_len <= 25)  micros *= 10;
-                nanosecond_ = micros * 1000;
-            }
-            else if (str_len > 26)  {
-                ::sscanf (str, "%d/%d/%d %hu:%hu:%hu.%d",
-                          &year, &month, &day,
-                          &hour_, &minute_, &second_, &nanosecond_);
-            }
+    if (cache.len > 0 &&
+        str_len >= cache.len &&
+        ! std::memcmp (str, cache.str, cache.len) &&
+        (str_len == cache.len || ! std::isdigit (str[cache.len])))  {
+        date_ = cache.value;
+        str += cache.len;
+    }
+    else  {
+        const char      *date_str = str;
+        unsigned int    year { 0 }, month { 0 }, day { 0 };
+        bool            good { false };
+
+        if (ds == DT_DATE_STYLE::YYYYMMDD)  {
+            good = _read_digits_(str, end, year, 9) > 0;
+            month = (year % 10000) / 100;
+            day = year % 100;
+            year /= 10000;
         }
-        else if (ds == DT_DATE_STYLE::ISO_STYLE)  {
-            char    slug;
-
-            if (str_len <= 10)  {
-                ::sscanf (str, "%d-%d-%d", &year, &month, &day);
-            }
-            else if (str_len == 13)  {
-                ::sscanf (str, "%d-%d-%d%c%hu",
-                          &year, &month, &day, &slug, &hour_);
-            }
-            else if (str_len == 16)  {
-                ::sscanf (str, "%d-%d-%d%c%hu:%hu",
-                          &year, &month, &day, &slug, &hour_, &minute_);
-            }
-            else if (str_len == 19)  {
-                ::sscanf (str, "%d-%d-%d%c%hu:%hu:%hu",
-                          &year, &month, &day, &slug,
-                          &hour_, &minute_, &second_);
-            }
-            else if (str_len > 19 && str_len <= 23)  {
-                MillisecondType millis { 0 };
-
-                ::sscanf (str, "%d-%d-%d%c%hu:%hu:%hu.%hd",
-                          &year, &month, &day, &slug,
-                          &hour_, &minute_, &second_, &millis);
-                if (str_len <= 21)  millis *= 100;
-                else if (str_len == 22)  millis *= 10;
-                nanosecond_ = millis * 1000000;
-            }
-            else if (str_len > 23 && str_len <= 26)  {
-                MicrosecondType micros { 0 };
-
-                ::sscanf (str, "%d-%d-%d%c%hu:%hu:%hu.%d",
-                          &year, &month, &day, &slug,
-                          &hour_, &minute_, &second_, &micros);
-                if (str_len <= 24)  micros *= 100;
-                else if (str_len <= 25)  micros *= 10;
-                nanosecond_ = micros * 1000;
-            }
-            else if (str_len > 26)  {
-                ::sscanf (str, "%d-%d-%d%c%hu:%hu:%hu.%d",
-                          &year, &month, &day, &slug,
-                          &hour_, &minute_, &second_, &nanosecond_);
-            }
+        else  {
+            const char  sep = ds == DT_DATE_STYLE::ISO_STYLE ? '-' : '/';
+            unsigned int    &first =
+                ds == DT_DATE_STYLE::AME_STYLE ? month : year;
+            unsigned int    &second =
+                ds == DT_DATE_STYLE::AME_STYLE ? day : month;
+            unsigned int    &third =
+                ds == DT_DATE_STYLE::AME_STYLE ? year : day;
+
+            good = _read_digits_(str, end, first, 4) > 0 &&
+                   str < end && *str++ == sep &&
+                   _read_digits_(str, end, second, 4) > 0 &&
+                   str < end && *str++ == sep &&
+                   _read_digits_(str, end, third, 4) > 0;
         }
-
-        if (year == 0 && month == 0 && day == 0)  {
+        if (! good || (year == 0 && month == 0 && day == 0))  {
             String512   err;
 
-            err.printf ("DateTime::DateTime(const char *): Don't know "
-                        "how to parse '%s'", s);
+            err.printf ("DateTime::DateTime(): Don't know "
+                        "how to parse '%.*s'",
+                        static_cast<int>(s.size()), s.data());
             throw std::runtime_error (err.c_str ());
         }
         date_ = year * 10000 + month * 100 + day;
+
+        const std::size_t   date_len = str - date_str;
+
+        if (date_len <= sizeof(cache.str))  {
+            std::memcpy (cache.str, date_str, date_len);
+            cache.len = static_cast<unsigned char>(date_len);
+            cache.value = date_;
+        }
+    }
+
+    if (str >= end)  return;
+
+    // ISO allows any separator (e.g. 'T') between date and time
+    //
+    if (ds == DT_DATE_STYLE::ISO_STYLE)  ++str;
+    else  while (str < end && std::isspace (*str)) ++str;
+
+    unsigned int    value;
+
+    if (! _read_digits_(str, end, value, 2))  return;
+    hour_ = static_cast<HourType>(value);
+    if (str >= end || *str++ != ':' || ! _read_digits_(str, end, value, 2))
+        return;
+    minute_ = static_cast<MinuteType>(value);
+    if (str >= end || *str++ != ':' || ! _read_digits_(str, end, value, 2))
+        return;
+    second_ = static_cast<SecondType>(value);
+    if (str >= end || *str++ != '.')  return;
+
+    static constexpr NanosecondType scale[] {
+        1000000000, 100000000, 10000000, 1000000, 100000,
+        10000, 1000, 100, 10, 1
+    };
+    const std::size_t   digits = _read_digits_(str, end, value, 9);
+
+    nanosecond_ = static_cast<NanosecondType>(value) * scale[digits];
+}
+
+// ----------------------------------------------------------------------------
+
+void DateTime::parse_range (std::span<const std::string_view> strs,
+                            std::span<DateTime> result,
+                            DT_DATE_STYLE ds,
+                            DT_TIME_ZONE tz)  {
+
+    assert(strs.size() == result.size());
+
+    DateCache   cache;
+
+    for (std::size_t i = 0; i < strs.size(); ++i)  {
+        result[i].time_zone_ = tz;
+        result[i].parse_ (strs[i], ds, cache);
     }
 }
 
@@ -358,74 +362,9 @@ DateTime &DateTime::operator = (DateTime &&rhs) = default;
 //
 DateTime &DateTime::operator = (const char *s)  {
 
-    time_ = INVALID_TIME_T_;
-
-    const char  *str = s;
-
-    while (::isspace (*str)) ++str;
-
-    std::size_t str_len = std::strlen (str);
-
-    assert(str_len > 3);
-
-    const bool  has_str_tz =
-        std::isalpha(str[str_len - 1]) &&
-        std::isalpha(str[str_len - 2]) &&
-        std::isalpha(str[str_len - 3]) &&
-        std::isspace(str[str_len - 4]);
-    char        str_tz[4];
-
-    if (has_str_tz)  {
-        str_tz[0] = str[str_len - 3];
-        str_tz[1] = str[str_len - 2];
-        str_tz[2] = str[str_len - 1];
-        str_tz[3] = '\0';
-
-        const auto  &citer = ZONE_STR_TO_TIME_ZONE.find(str_tz);
-
-        if (citer != ZONE_STR_TO_TIME_ZONE.end()) [[likely]]
-            time_zone_ = citer->second;
-        else  {
-            String64    err;
-
-            err.printf ("DateTime::DateTime(const char *): Cannot find  "
-                        "time zone '%s'", str_tz);
-            throw std::runtime_error (err.c_str ());
-        }
-        str_len -= 4;  // 1 space + 3 time zone letters
-    }
-
-    if (str_len == 8)  {
-        hour_ = minute_ = second_ = nanosecond_ = 0;
-        ::sscanf (str, "%u", &date_);
-    }
-    else if (str_len == 11)  {
-        minute_ = second_ = nanosecond_ = 0;
-        ::sscanf (str, "%u %hu", &date_, &hour_);
-    }
-    else if (str_len == 14)  {
-        second_ = nanosecond_ = 0;
-        ::sscanf (str, "%u %hu:%hu", &date_, &hour_, &minute_);
-    }
-    else if (str_len == 17)  {
-        nanosecond_ = 0;
-        ::sscanf (str, "%u %hu:%hu:%hu", &date_, &hour_, &minute_, &second_);
-    }
-    else if (str_len == 21)  {
-        MillisecondType ms;
-
-        ::sscanf (str, "%u %hu:%hu:%hu.%hd",
-                  &date_, &hour_, &minute_, &second_, &ms);
-        nanosecond_ = ms * 1000000;;
-    }
-    else  {
-        String512   err;
-
-        err.printf ("DateTime::operator=(const char *): Don't know how to "
-                    "parse '%s'", s);
-        throw std::runtime_error (err.c_str ());
-    }
+    DateCache   cache;
 
+    parse_ (s, DT_DATE_STYLE::YYYYMMDD, cache);
     return (*this);
 }
 
@@ -1086,6 +1025,706 @@ std::string DateTime::string_format (DT_FORMAT format) const  {
 
 // ----------------------------------------------------------------------------
 
+// It writes value in at least width digits, zero padded
+//
+static inline char *
+_write_digits_(char *buffer, unsigned int value, int width) noexcept  {
+
+    char    tmp[16];
+    int     len { 0 };
+
+    do  {
+        tmp[len++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (len < width)  tmp[len++] = '0';
+    while (len > 0)  *buffer++ = tmp[--len];
+    return (buffer);
+}
+
+// ----------------------------------------------------------------------------
+
+std::size_t
+DateTime::format_date_ (char *buffer, DT_FORMAT format) const noexcept  {
+
+    // The fast path only handles what printf() would print the same way
+    //
+    if (nanosec () < 0)  return (0);
+
+    const unsigned int  y = year ();
+    const unsigned int  m = static_cast<unsigned int>(month ());
+    const unsigned int  d = dmonth ();
+    char                *ptr = buffer;
+
+    switch (format)  {
+        case DT_FORMAT::ISO_DT_TM:
+        case DT_FORMAT::ISO_DT:
+        case DT_FORMAT::ISO_DT_NANO:
+        {
+            ptr = _write_digits_(ptr, y, 1);
+            *ptr++ = '-';
+            ptr = _write_digits_(ptr, m, 2);
+            *ptr++ = '-';
+            ptr = _write_digits_(ptr, d, 2);
+        } break;
+
+        case DT_FORMAT::AMR_DT_TM:
+        case DT_FORMAT::AMR_DT_CTY:
+        case DT_FORMAT::DT_TM:
+        case DT_FORMAT::DT_TM2:
+        {
+            ptr = _write_digits_(ptr, m, 2);
+            *ptr++ = '/';
+            ptr = _write_digits_(ptr, d, 2);
+            *ptr++ = '/';
+            ptr = _write_digits_(ptr, y, 1);
+        } break;
+
+        case DT_FORMAT::EUR_DT_TM:
+        case DT_FORMAT::EUR_DT_CTY:
+        {
+            ptr = _write_digits_(ptr, d, 2);
+            *ptr++ = '/';
+            ptr = _write_digits_(ptr, m, 2);
+            *ptr++ = '/';
+            ptr = _write_digits_(ptr, y, 1);
+        } break;
+
+        case DT_FORMAT::DT_DATETIME:
+        case DT_FORMAT::DT_YYYYMMDD:
+        {
+            ptr = _write_digits_(ptr, y, 2);
+            ptr = _write_digits_(ptr, m, 2);
+            ptr = _write_digits_(ptr, d, 2);
+        } break;
+
+        case DT_FORMAT::DT_MMDDYYYY:
+        {
+            ptr = _write_digits_(ptr, m, 2);
+            ptr = _write_digits_(ptr, d, 2);
+            ptr = _write_digits_(ptr, y, 1);
+        } break;
+
+        default:
+            break;
+    }
+    return (ptr - buffer);
+}
+
+// ----------------------------------------------------------------------------
+
+std::size_t
+DateTime::format_time_ (char *buffer, DT_FORMAT format) const noexcept  {
+
+    char    *ptr = buffer;
+
+    switch (format)  {
+        case DT_FORMAT::ISO_DT_TM:
+        case DT_FORMAT::ISO_DT_NANO:
+        case DT_FORMAT::AMR_DT_TM:
+        case DT_FORMAT::EUR_DT_TM:
+        case DT_FORMAT::DT_TM:
+        case DT_FORMAT::DT_TM2:
+        case DT_FORMAT::DT_DATETIME:
+        {
+            *ptr++ = ' ';
+            if (format == DT_FORMAT::DT_DATETIME)  *ptr++ = ' ';
+            ptr = _write_digits_(ptr, hour (), 2);
+            *ptr++ = ':';
+            ptr = _write_digits_(ptr, minute (), 2);
+            *ptr++ = ':';
+            ptr = _write_digits_(ptr, sec (), 2);
+            if (format == DT_FORMAT::DT_TM)  break;
+            *ptr++ = '.';
+            if (format == DT_FORMAT::DT_TM2 ||
+                format == DT_FORMAT::DT_DATETIME)
+                ptr = _write_digits_(ptr, msec (), 3);
+            else if (format == DT_FORMAT::ISO_DT_NANO)
+                ptr = _write_digits_(ptr, nanosec (), 9);
+            else
+                ptr = _write_digits_(ptr, microsec (), 6);
+        } break;
+
+        default:
+            break;
+    }
+    return (ptr - buffer);
+}
+
+// ----------------------------------------------------------------------------
+
+std::size_t DateTime::format_to (char *buffer, DT_FORMAT format) const  {
+
+    if (format == DT_FORMAT::DT_PRECISE)  {  // e.g. Epoch.Nanoseconds
+        char    *ptr =
+            std::to_chars(buffer, buffer + FORMAT_BUF_SIZE, this->time()).ptr;
+
+        *ptr++ = '.';
+        ptr = std::to_chars(ptr, buffer + FORMAT_BUF_SIZE, nanosec ()).ptr;
+        return (ptr - buffer);
+    }
+
+    const std::size_t   date_len = format_date_ (buffer, format);
+
+    if (date_len > 0)
+        return (date_len + format_time_ (buffer + date_len, format));
+
+    String128   result;
+
+    date_to_str (format, result);
+    std::memcpy (buffer, result.c_str (), result.size ());
+    return (result.size ());
+}
+
+// ----------------------------------------------------------------------------
+
+void DateTime::format_range (std::span<const DateTime> dts,
+                             DT_FORMAT format,
+                             std::string &buffer,
+                             std::span<std::size_t> ends)  {
+
+    assert(dts.size() == ends.size());
+
+    const std::size_t   start = buffer.size ();
+
+    buffer.resize (start + dts.size () * FORMAT_BUF_SIZE);
+
+    char        *const  base = buffer.data ();
+    char                *ptr = base + start;
+    const char          *prev_date { nullptr };
+    std::size_t         prev_len { 0 };
+    DateType            prev_value { INVALID_DATE_ };
+
+    for (std::size_t i = 0; i < dts.size (); ++i)  {
+        const DateTime  &dt = dts[i];
+        std::size_t     date_len { 0 };
+
+        if (format != DT_FORMAT::DT_PRECISE && dt.nanosec () >= 0)  {
+            if (prev_len > 0 && dt.date () == prev_value)  {
+                std::memcpy (ptr, prev_date, prev_len);
+                date_len = prev_len;
+            }
+            else  {
+                date_len = dt.format_date_ (ptr, format);
+                prev_len = date_len;
+                prev_value = dt.date ();
+            }
+            prev_date = ptr;
+        }
+        if (date_len > 0)
+            ptr += date_len + dt.format_time_ (ptr + date_len, format);
+        else
+            ptr += dt.format_to (ptr, format);
+        ends[i] = ptr - base;
+    }
+    buffer.resize (ptr - base);
+}
+
+// ----------------------------------------------------------------------------
+
+// Time zone engine
+//
+// Conversions between UTC and the local time of a zone are done in process,
+// without touching the TZ environment variable. Each zone's rules are loaded
+// once from the tzdata (TZif) file into an immutable table of transitions.
+// After that, converting is a binary search plus civil date arithmetic, so
+// it is lock-free and safe to do from any number of threads.
+// If a zone cannot be loaded (e.g. on Windows or with no tzdata), the old
+// TZ environment variable switching is used under a mutex.
+//
+
+// Days since 01/01/1970 of a proleptic Gregorian date. Days past the end
+// of the month roll into the next months, like mktime() does.
+// Algorithm by Howard Hinnant.
+//
+static inline std::int64_t
+_days_from_civil_(std::int64_t y, unsigned int m, std::int64_t d) noexcept  {
+
+    y -= m <= 2;
+
+    const std::int64_t  era = (y >= 0 ? y : y - 399) / 400;
+    const std::int64_t  yoe = y - era * 400;
+    const std::int64_t  doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const std::int64_t  doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return (era * 146097 + doe - 719468);
+}
+
+// ----------------------------------------------------------------------------
+
+// The inverse of the above
+//
+static inline void
+_civil_from_days_(std::int64_t days,
+                  std::int64_t &y,
+                  unsigned int &m,
+                  unsigned int &d) noexcept  {
+
+    days += 719468;
+
+    const std::int64_t  era = (days >= 0 ? days : days - 146096) / 146097;
+    const std::int64_t  doe = days - era * 146097;
+    const std::int64_t  yoe =
+        (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const std::int64_t  doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const std::int64_t  mp = (5 * doy + 2) / 153;
+
+    d = static_cast<unsigned int>(doy - (153 * mp + 2) / 5 + 1);
+    m = static_cast<unsigned int>(mp < 10 ? mp + 3 : mp - 9);
+    y = yoe + era * 400 + (m <= 2);
+}
+
+// ----------------------------------------------------------------------------
+
+static inline std::int64_t
+_floor_div_(std::int64_t num, std::int64_t den) noexcept  {
+
+    return (num / den - ((num % den != 0) && ((num < 0) != (den < 0))));
+}
+
+// ----------------------------------------------------------------------------
+
+// 0 (Sunday) - 6 of days since the epoch. 01/01/1970 was a Thursday.
+//
+static inline std::int64_t _weekday_(std::int64_t days) noexcept  {
+
+    return (((days + 4) % 7 + 7) % 7);
+}
+
+// ----------------------------------------------------------------------------
+
+// It fills the date/time parts of ltime for a local time given as seconds
+// since the epoch
+//
+static inline void
+_fill_tm_(std::int64_t local_time, struct tm &ltime) noexcept  {
+
+    const std::int64_t  days = _floor_div_(local_time, 24 * 3600);
+    const std::int64_t  secs = local_time - days * 24 * 3600;
+    std::int64_t        y;
+    unsigned int        m, d;
+
+    _civil_from_days_(days, y, m, d);
+    ltime.tm_year = static_cast<int>(y - 1900);
+    ltime.tm_mon = static_cast<int>(m) - 1;
+    ltime.tm_mday = static_cast<int>(d);
+    ltime.tm_hour = static_cast<int>(secs / 3600);
+    ltime.tm_min = static_cast<int>((secs % 3600) / 60);
+    ltime.tm_sec = static_cast<int>(secs % 60);
+    ltime.tm_wday = static_cast<int>(_weekday_(days));
+    ltime.tm_yday = static_cast<int>(days - _days_from_civil_(y, 1, 1));
+}
+
+// ----------------------------------------------------------------------------
+
+// UTC offsets of one zone over time
+//
+struct  _ZoneRules_  {
+
+    // Transitions are generated from the POSIX rule up to this year
+    //
+    static constexpr std::int64_t   LAST_RULE_YEAR { 2200 };
+
+    std::vector<std::int64_t>   utc_trans { };    // UTC times, ascending
+    std::vector<std::int32_t>   offsets { };      // Offset from utc_trans[i]
+    std::int32_t                first_offset { 0 };  // Before utc_trans[0]
+
+    [[nodiscard]] std::int32_t
+    offset_at(std::int64_t utc_time) const noexcept  {
+
+        const auto  iter =
+            std::upper_bound(utc_trans.begin(), utc_trans.end(), utc_time);
+
+        return (iter == utc_trans.begin()
+                    ? first_offset
+                    : offsets[std::distance(utc_trans.begin(), iter) - 1]);
+    }
+
+    // Same as mktime() with tm_isdst = -1. Ambiguous local times take
+    // the earlier instant. Local times in a gap are read with the offset
+    // before the gap, so they move forward.
+    //
+    [[nodiscard]] std::int64_t
+    to_utc(std::int64_t local_time) const noexcept  {
+
+        const std::int32_t  before = offset_at(local_time - 24 * 3600);
+
+        if (offset_at(local_time - before) == before)
+            return (local_time - before);
+
+        const std::int32_t  after = offset_at(local_time + 24 * 3600);
+
+        if (offset_at(local_time - after) == after)
+            return (local_time - after);
+        return (local_time - before);
+    }
+};
+
+// ----------------------------------------------------------------------------
+
+// The POSIX TZ rule of the form std offset [dst [offset] [,start,end]]
+// e.g. "EST5EDT,M3.2.0,M11.1.0" or "<+0330>-3:30"
+//
+struct  _PosixTZ_  {
+
+    struct  Date  {
+        char            kind { 'M' };  // 'M' = Mm.w.d, 'J' = Jn, 'n' = n
+        int             month { 0 };
+        int             week { 0 };
+        int             wday { 0 };
+        int             day { 0 };
+        std::int32_t    time { 2 * 3600 };  // Local time of the switch
+    };
+
+    std::int32_t    std_offset { 0 };  // Seconds east of UTC
+    std::int32_t    dst_offset { 0 };
+    bool            has_dst { false };
+    Date            start { };
+    Date            end { };
+
+    // Seconds since the epoch of the local midnight starting the date in y
+    //
+    [[nodiscard]] static std::int64_t
+    date_start(const Date &date, std::int64_t y) noexcept  {
+
+        std::int64_t    days;
+
+        if (date.kind == 'M')  {
+            const std::int64_t  first =
+                _days_from_civil_(y, unsigned(date.month), 1);
+            std::int64_t        mday =
+                1 + (date.wday - _weekday_(first) + 7) % 7 +
+                (date.week - 1) * 7;
+            const std::int64_t  last_mday =
+                _days_from_civil_(y + (date.month == 12),
+                                  unsigned(date.month % 12 + 1), 1) - first;
+
+            while (mday > last_mday)  mday -= 7;
+            days = first + mday - 1;
+        }
+        else  {
+            const bool  leap =
+                ((y % 4 == 0) && (y % 100 != 0)) || (y % 400 == 0);
+
+            days = _days_from_civil_(y, 1, 1) + date.day;
+            if (date.kind == 'J' && (date.day < 60 || ! leap))  days -= 1;
+        }
+        return (days * 24 * 3600);
+    }
+
+    // It appends the transitions of years [from_year, LAST_RULE_YEAR] that
+    // are after the last one in rules
+    //
+    void extend(_ZoneRules_ &rules, std::int64_t from_year) const  {
+
+        if (! has_dst)  return;
+
+        for (std::int64_t y = from_year;
+             y <= _ZoneRules_::LAST_RULE_YEAR; ++y)  {
+            const std::int64_t  on =
+                date_start(start, y) + start.time - std_offset;
+            const std::int64_t  off =
+                date_start(end, y) + end.time - dst_offset;
+            const std::int64_t  first = std::min(on, off);
+            const std::int64_t  second = std::max(on, off);
+
+            for (const std::int64_t t : { first, second })  {
+                if (rules.utc_trans.empty() || t > rules.utc_trans.back())  {
+                    rules.utc_trans.push_back(t);
+                    rules.offsets.push_back(t == on ? dst_offset
+                                                    : std_offset);
+                }
+            }
+        }
+    }
+
+    // It returns false, if str is not a rule it understands
+    //
+    bool parse(const char *str) noexcept  {
+
+        const auto  parse_name =
+            [&str]() -> bool  {
+                if (*str == '<')  {
+                    while (*str && *str != '>')  ++str;
+                    if (*str != '>')  return (false);
+                    ++str;
+                    return (true);
+                }
+
+                const char  *begin = str;
+
+                while (std::isalpha(static_cast<unsigned char>(*str)))  ++str;
+                return (str - begin >= 3);
+            };
+        const auto  parse_time =
+            [&str](std::int32_t &secs) -> bool  {
+                int sign = 1;
+
+                if (*str == '+' || *str == '-')  {
+                    if (*str == '-')  sign = -1;
+                    ++str;
+                }
+                if (! std::isdigit(static_cast<unsigned char>(*str)))
+                    return (false);
+
+                std::int32_t    parts[3] { 0, 0, 0 };
+
+                for (int i = 0; i < 3; ++i)  {
+                    while (std::isdigit(static_cast<unsigned char>(*str)))
+                        parts[i] = parts[i] * 10 + (*str++ - '0');
+                    if (i < 2 && *str == ':')  ++str;
+                    else  break;
+                }
+                secs = sign * (parts[0] * 3600 + parts[1] * 60 + parts[2]);
+                return (true);
+            };
+        const auto  parse_int =
+            [&str](int &val) -> bool  {
+                if (! std::isdigit(static_cast<unsigned char>(*str)))
+                    return (false);
+                val = 0;
+                while (std::isdigit(static_cast<unsigned char>(*str)))
+                    val = val * 10 + (*str++ - '0');
+                return (true);
+            };
+        const auto  parse_date =
+            [&str, &parse_int, &parse_time](Date &date) -> bool  {
+                if (*str == 'M')  {
+                    ++str;
+                    date.kind = 'M';
+                    if (! parse_int(date.month) || *str++ != '.' ||
+                        ! parse_int(date.week) || *str++ != '.' ||
+                        ! parse_int(date.wday))
+                        return (false);
+                    if (date.month < 1 || date.month > 12 ||
+                        date.week < 1 || date.week > 5 ||
+                        date.wday > 6)
+                        return (false);
+                }
+                else  {
+                    date.kind = 'n';
+                    if (*str == 'J')  {
+                        date.kind = 'J';
+                        ++str;
+                    }
+                    if (! parse_int(date.day))  return (false);
+                }
+                if (*str == '/')  {
+                    ++str;
+                    return (parse_time(date.time));
+                }
+                return (true);
+            };
+
+        // POSIX offsets are west of UTC
+        //
+        if (! parse_name() || ! parse_time(std_offset))  return (false);
+        std_offset = -std_offset;
+        dst_offset = std_offset;
+        if (*str == '\0')  return (true);
+
+        if (! parse_name())  return (false);
+        has_dst = true;
+        dst_offset = std_offset + 3600;
+        if (*str != ',' && *str != '\0')  {
+            if (! parse_time(dst_offset))  return (false);
+            dst_offset = -dst_offset;
+        }
+        if (*str == '\0')  {  // US rules are the POSIX default
+            start.month = 3;
+            start.week = 2;
+            end.month = 11;
+            end.week = 1;
+            return (true);
+        }
+        if (*str++ != ',' || ! parse_date(start) ||
+            *str++ != ',' || ! parse_date(end))
+            return (false);
+        return (*str == '\0');
+    }
+};
+
+// ----------------------------------------------------------------------------
+
+// It loads a TZif file (see RFC 8536). It returns false, if the file is not
+// there or is not understood.
+//
+static bool _load_tzif_(const std::string &path, _ZoneRules_ &rules)  {
+
+    std::ifstream   file (path, std::ios::binary);
+
+    if (! file)  return (false);
+
+    const std::string   data { std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>() };
+    const auto          *bytes =
+        reinterpret_cast<const unsigned char *>(data.data());
+    const std::size_t   data_s = data.size();
+    const auto          be32 =
+        [bytes](std::size_t pos) -> std::int64_t  {
+            return (static_cast<std::int32_t>(
+                        (std::uint32_t(bytes[pos]) << 24) |
+                        (std::uint32_t(bytes[pos + 1]) << 16) |
+                        (std::uint32_t(bytes[pos + 2]) << 8) |
+                        std::uint32_t(bytes[pos + 3])));
+        };
+    const auto          be64 =
+        [bytes](std::size_t pos) -> std::int64_t  {
+            std::uint64_t   val { 0 };
+
+            for (std::size_t i = 0; i < 8; ++i)
+                val = (val << 8) | bytes[pos + i];
+            return (static_cast<std::int64_t>(val));
+        };
+
+    constexpr std::size_t   HEADER_S { 44 };
+
+    if (data_s < HEADER_S || std::memcmp(bytes, "TZif", 4))  return (false);
+
+    // With version 2+, skip the 32-bit block and read the 64-bit one
+    //
+    std::size_t pos { 0 };
+    std::size_t time_s { 4 };
+
+    if (bytes[4] >= '2')  {
+        const std::size_t   v1_s =
+            be32(pos + 32) * 5 + be32(pos + 36) * 6 + be32(pos + 40) +
+            be32(pos + 28) * 8 + be32(pos + 24) + be32(pos + 20);
+
+        pos = HEADER_S + v1_s;
+        time_s = 8;
+        if (data_s < pos + HEADER_S || std::memcmp(bytes + pos, "TZif", 4))
+            return (false);
+    }
+
+    const std::size_t   isut_cnt = be32(pos + 20);
+    const std::size_t   isstd_cnt = be32(pos + 24);
+    const std::size_t   leap_cnt = be32(pos + 28);
+    const std::size_t   time_cnt = be32(pos + 32);
+    const std::size_t   type_cnt = be32(pos + 36);
+    const std::size_t   char_cnt = be32(pos + 40);
+    const std::size_t   trans_pos = pos + HEADER_S;
+    const std::size_t   idx_pos = trans_pos + time_cnt * time_s;
+    const std::size_t   type_pos = idx_pos + time_cnt;
+    const std::size_t   end_pos =
+        type_pos + type_cnt * 6 + char_cnt + leap_cnt * (time_s + 4) +
+        isstd_cnt + isut_cnt;
+
+    if (type_cnt == 0 || end_pos > data_s)  return (false);
+
+    rules.utc_trans.reserve(time_cnt + 2 * 200);
+    rules.offsets.reserve(time_cnt + 2 * 200);
+    rules.first_offset = std::int32_t(be32(type_pos));
+    for (std::size_t i = 0; i < time_cnt; ++i)  {
+        const std::size_t   type = bytes[idx_pos + i];
+
+        if (type >= type_cnt)  return (false);
+        rules.utc_trans.push_back(time_s == 8 ? be64(trans_pos + i * 8)
+                                              : be32(trans_pos + i * 4));
+        rules.offsets.push_back(std::int32_t(be32(type_pos + type * 6)));
+    }
+
+    // The footer rule covers the times after the last transition
+    //
+    if (time_s == 8 && end_pos < data_s && bytes[end_pos] == '\n')  {
+        const std::size_t   footer_end = data.find('\n', end_pos + 1);
+
+        if (footer_end != std::string::npos)  {
+            const std::string   footer =
+                data.substr(end_pos + 1, footer_end - end_pos - 1);
+            _PosixTZ_           posix;
+
+            if (! footer.empty() && posix.parse(footer.c_str()))  {
+                std::int64_t    from_year { 1970 };
+
+                if (! rules.utc_trans.empty())  {
+                    struct tm   ltime { };
+
+                    _fill_tm_(rules.utc_trans.back(), ltime);
+                    from_year = ltime.tm_year + 1900;
+                }
+                else
+                    rules.first_offset = posix.std_offset;
+                posix.extend(rules, from_year);
+            }
+        }
+    }
+    return (true);
+}
+
+// ----------------------------------------------------------------------------
+
+// It loads the rules of the LOCAL zone from $TZ, or /etc/localtime if TZ
+// is not set.
+//
+static bool _load_local_zone_(const char *zone_dir, _ZoneRules_ &rules)  {
+
+    const char  *tz = std::getenv("TZ");
+
+    if (! tz)  return (_load_tzif_("/etc/localtime", rules));
+    if (*tz == ':')  ++tz;
+    if (*tz == '\0')  return (_load_tzif_(std::string(zone_dir) + "/UTC",
+                                          rules));
+    if (*tz == '/')  return (_load_tzif_(tz, rules));
+    if (_load_tzif_(std::string(zone_dir) + '/' + tz, rules))
+        return (true);
+
+    _PosixTZ_   posix;
+
+    if (! posix.parse(tz))  return (false);
+    rules.first_offset = posix.std_offset;
+    posix.extend(rules, 1970);
+    return (true);
+}
+
+// ----------------------------------------------------------------------------
+
+// It returns the rules of the given zone, or nullptr if they are not
+// available. Each zone is loaded once, on first use.
+//
+static const _ZoneRules_ *
+_zone_rules_(DT_TIME_ZONE time_zone, const char *zone_name)  {
+
+    static const _ZoneRules_    utc_rules { };
+
+    if (time_zone == DT_TIME_ZONE::GMT || time_zone == DT_TIME_ZONE::UTC)
+        return (&utc_rules);
+
+#ifdef _WIN32
+    return (nullptr);
+#else
+    constexpr std::size_t   ZONE_CNT { 32 };  // LOCAL is the last one
+
+    static std::once_flag                                   once[ZONE_CNT];
+    static std::unique_ptr<const _ZoneRules_>               rules[ZONE_CNT];
+    const std::size_t                                       idx =
+        time_zone == DT_TIME_ZONE::LOCAL
+            ? ZONE_CNT - 1 : static_cast<std::size_t>(time_zone);
+
+    std::call_once(once[idx],
+                   [idx, zone_name]() -> void  {
+        const char  *tzdir = std::getenv("TZDIR");
+        const char  *zone_dir = tzdir ? tzdir : "/usr/share/zoneinfo";
+        auto        zone = std::make_unique<_ZoneRules_>();
+        const bool  loaded =
+            zone_name
+                ? _load_tzif_(std::string(zone_dir) + '/' + zone_name, *zone)
+                : _load_local_zone_(zone_dir, *zone);
+
+        if (loaded)  rules[idx] = std::move(zone);
+    });
+    return (rules[idx].get());
+#endif // _WIN32
+}
+
+// ----------------------------------------------------------------------------
+
+// Only for zones that the engine above cannot load
+//
+static std::mutex   _env_timezone_mutex_;
+
+// ----------------------------------------------------------------------------
+
 inline void DateTime::change_env_timezone_(DT_TIME_ZONE time_zone)  {
 
     if (time_zone != DT_TIME_ZONE::LOCAL)  {
@@ -1128,6 +1767,26 @@ DateTime::EpochType DateTime::maketime_ (struct tm &ltime) const noexcept  {
     ltime.tm_mon = static_cast<int>(month()) - 1;
     ltime.tm_year = year () - 1900;
 
+    const _ZoneRules_   *rules =
+        _zone_rules_(time_zone_,
+                     time_zone_ == DT_TIME_ZONE::LOCAL
+                         ? nullptr
+                         : TIMEZONES_[static_cast<int>(time_zone_)]);
+
+    if (rules) [[likely]]  {
+        const std::int64_t  local_time =
+            _days_from_civil_(ltime.tm_year + 1900,
+                              unsigned(ltime.tm_mon + 1),
+                              ltime.tm_mday) * 24 * 3600 +
+            ltime.tm_hour * 3600 + ltime.tm_min * 60 + ltime.tm_sec;
+        const std::int64_t  t = rules->to_utc(local_time);
+
+        _fill_tm_(t + rules->offset_at(t), ltime);
+        return (static_cast<EpochType>(t));
+    }
+
+    const std::lock_guard<std::mutex>   guard (_env_timezone_mutex_);
+
     change_env_timezone_(time_zone_);
 
     const time_t    t  = ::mktime (&ltime);
@@ -1141,17 +1800,26 @@ DateTime::EpochType DateTime::maketime_ (struct tm &ltime) const noexcept  {
 void
 DateTime::breaktime_ (EpochType the_time, NanosecondType nanosec) noexcept  {
 
-    change_env_timezone_(time_zone_);
+    const _ZoneRules_   *rules =
+        _zone_rules_(time_zone_,
+                     time_zone_ == DT_TIME_ZONE::LOCAL
+                         ? nullptr
+                         : TIMEZONES_[static_cast<int>(time_zone_)]);
+    struct tm           ltime{};
 
-    struct tm   ltime{};
+    if (rules) [[likely]]
+        _fill_tm_(std::int64_t(the_time) + rules->offset_at(the_time), ltime);
+    else  {
+        const std::lock_guard<std::mutex>   guard (_env_timezone_mutex_);
 
+        change_env_timezone_(time_zone_);
 #ifdef _WIN32
-    localtime_s (&ltime, &the_time);
+        localtime_s (&ltime, &the_time);
 #else
-    localtime_r (&the_time, &ltime);
+        localtime_r (&the_time, &ltime);
 #endif // _WIN32
-
-    reset_env_timezone_(time_zone_);
+        reset_env_timezone_(time_zone_);
+    }
 
     date_ = (ltime.tm_year + 1900) * 100;
 
@@ -28,9 +28,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/DataFrame.h>
 #include <DataFrame/DataFrameFinancialVisitors.h>
 #include <DataFrame/DataFrameMLVisitors.h>
+#include <DataFrame/DataFrameOperators.h>
 #include <DataFrame/DataFrameStatsVisitors.h>
 #include <DataFrame/DataFrameTransformVisitors.h>
 #include <DataFrame/RandGen.h>
+#include <DataFrame/Utils/PhiloxEngine.h>
 
 #include <array>
 #include <cassert>
@@ -47,6 +49,7 @@ using namespace hmdf;
 using ULDataFrame = StdDataFrame<unsigned long>;
 using StrDataFrame = StdDataFrame<std::string>;
 using DTDataFrame = StdDataFrame256<DateTime>;
+using TSDataFrame = StdDataFrame256<Timestamp>;
 using StrDataFrame2 = StdDataFrame256<std::string>;
 
 template<typename T>
@@ -142,9 +145,9 @@ static void test_get_data_every_n()  {
                  std::make_pair("dbl_col", dblvec),
                  std::make_pair("dbl_col_2", dblvec2));
     df.load_column("int_col", std::move(intvec),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
     df.load_column("str_col", std::move(strvec),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
 
     auto    df2 = df.get_data_every_n<double, std::string, int>(3, 1);
 
@@ -376,7 +379,7 @@ static void test_is_infinity_mask()  {
                  std::make_pair("All Infinity Col", allinfinity),
                  std::make_pair("str_col", strvec));
     df.load_column("Empty Col", std::move(dblempty),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
 
     const auto  res1 = df.is_infinity_mask<double>("dbl_col");
 
@@ -435,7 +438,7 @@ static void test_is_default_mask()  {
                  std::make_pair("All Default Col", alldefault),
                  std::make_pair("str_col", strvec));
     df.load_column("Empty Col", std::move(dblempty),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
 
     const auto  res1 = df.is_default_mask<double>("dbl_col");
 
@@ -545,7 +548,7 @@ static void test_ConfIntervalVisitor()  {
     }
     df.load_column("Extra Col",
                    std::vector<double> { 5.1, 4.9, 5.0, 5.3, 5.2, 4.8 },
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
 
     ConfIntervalVisitor<double, std::string>    ci_v1 { 0.95 };
 
@@ -589,9 +592,9 @@ static void test_ConfIntervalVisitor()  {
     };
 
     df.load_column<ary_col_t>("ARY MD COL", std::move(ary_md_x),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<vec_col_t>("VEC MD COL", std::move(vec_md_x),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     ConfIntervalVisitor<ary_col_t, std::string> ary_ci_v;
     ConfIntervalVisitor<vec_col_t, std::string> vec_ci_v;
@@ -639,7 +642,7 @@ static void test_CoeffVariationVisitor()  {
     }
     df.load_column("Extra Col",
                    std::vector<double> { 5.1, 4.9, 5.0, 5.3, 5.2, 4.8 },
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
 
     CoeffVariationVisitor<double, std::string>    cv_v1;
 
@@ -672,9 +675,9 @@ static void test_CoeffVariationVisitor()  {
     };
 
     df.load_column<ary_col_t>("ARY MD COL", std::move(ary_md_x),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<vec_col_t>("VEC MD COL", std::move(vec_md_x),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     CoeffVariationVisitor<ary_col_t, std::string>   ary_cv_v;
     CoeffVariationVisitor<vec_col_t, std::string>   vec_cv_v;
@@ -1134,13 +1137,13 @@ static void test_ChiSquaredTestVisitor()  {
     };
 
     df.load_column<ary_col_t>("ARY OBSV", std::move(ary_observed),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<vec_col_t>("VEC OBSV", std::move(vec_observed),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY EXPT", std::move(ary_expected),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<vec_col_t>("VEC EXPT", std::move(vec_expected),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     ChiSquaredTestVisitor<ary_col_t>    ary_chi;
     ChiSquaredTestVisitor<vec_col_t>    vec_chi;
@@ -1199,9 +1202,9 @@ static void test_get_matrix()  {
                  std::make_pair("int_col", intvec),
                  std::make_pair("str_col", strvec));
     df.load_column("Empty Col", std::move(dblempty),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
     df.load_column("dbl_col_3", std::move(dblvec3),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
 
     const auto  matrix = df.get_matrix();
 
@@ -1322,9 +1325,9 @@ static void test_get_matrix_2()  {
                  std::make_pair("int_col", intvec),
                  std::make_pair("str_col", strvec));
     df.load_column("Empty Col", std::move(dblempty),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
     df.load_column("dbl_col_3", std::move(dblvec3),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
 
     const auto  matrix =
         df.get_matrix({ "Empty Col", "dbl_col_3", "dbl_col_2"  });
@@ -1657,9 +1660,9 @@ static void test_HWESForecastVisitor()  {
             ary_col1[t][d] = vec_col1[t][d];
 
     df2.load_column<vec_col_t>("VEC OBSV", std::move(vec_col1),
-                               nan_policy::dont_pad_with_nans);
+                                       nan_policy::dont_pad_with_nans);
     df2.load_column<ary_col_t>("ARY OBSV", std::move(ary_col1),
-                               nan_policy::dont_pad_with_nans);
+                                       nan_policy::dont_pad_with_nans);
 
     // No seasons
     //
@@ -1897,9 +1900,9 @@ static void test_LSTMForecastVisitor()  {
     };
 
     df2.load_column<ary_col_t>("ARY COL", std::move(ary_col),
-                               nan_policy::dont_pad_with_nans);
+                                       nan_policy::dont_pad_with_nans);
     df2.load_column<vec_col_t>("VEC COL", std::move(vec_col),
-                               nan_policy::dont_pad_with_nans);
+                                       nan_policy::dont_pad_with_nans);
 
     lstm_v<ary_col_t, std::string>  ary_lstm { 16, 10, 1, 30, 0.001, 4, 42 };
     lstm_v<vec_col_t, std::string>  vec_lstm { 16, 10, 1, 30, 0.001, 4, 42 };
@@ -1954,7 +1957,7 @@ static void test_kshape_groups()  {
 
         df.load_column((col_name + std::to_string(i)).c_str(),
                        std::move(series),
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
     }
 
     // Cluster 2: Exponential growth pattern
@@ -1969,7 +1972,7 @@ static void test_kshape_groups()  {
 
         df.load_column((col_name + std::to_string(i)).c_str(),
                        std::move(series),
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
     }
 
     // Cluster 3: Linear increasing pattern
@@ -1983,7 +1986,7 @@ static void test_kshape_groups()  {
 
         df.load_column((col_name + std::to_string(i)).c_str(),
                        std::move(series),
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
     }
 
     const auto result =
@@ -2063,18 +2066,18 @@ static void test_kshape_groups()  {
     };
 
     df.load_column<ary_col_t>("ARY sin COL 1", std::move(ary_sin_col1),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY sin COL 2", std::move(ary_sin_col2),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY sin COL 3", std::move(ary_sin_col3),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     df.load_column<vec_col_t>("VEC sin COL 1", std::move(vec_sin_col1),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<vec_col_t>("VEC sin COL 2", std::move(vec_sin_col2),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<vec_col_t>("VEC sin COL 3", std::move(vec_sin_col3),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     // Cluster B — linear ramp pattern across all dims
     //
@@ -2111,18 +2114,18 @@ static void test_kshape_groups()  {
     };
 
     df.load_column<ary_col_t>("ARY lin COL 1", std::move(ary_lin_col1),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY lin COL 2", std::move(ary_lin_col2),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY lin COL 3", std::move(ary_lin_col3),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     df.load_column<vec_col_t>("VEC lin COL 1", std::move(vec_lin_col1),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<vec_col_t>("VEC lin COL 2", std::move(vec_lin_col2),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<vec_col_t>("VEC lin COL 3", std::move(vec_lin_col3),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     const auto  ary_res1 =
         df.kshape_groups<ary_col_t>(
@@ -2177,13 +2180,13 @@ static void test_kshape_groups()  {
     };
 
     df.load_column<ary_col_t>("ARY BASE", std::move(ary_base),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY SHIFT 0", std::move(ary_shift_0),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY SHIFT 1", std::move(ary_shift_1),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY SHIFT 2", std::move(ary_shift_2),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     // // Cluster B — flat/constant series, clearly different
     //
@@ -2204,11 +2207,11 @@ static void test_kshape_groups()  {
     };
 
     df.load_column<ary_col_t>("ARY FLAT 0", std::move(ary_flat_0),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY FLAT 1", std::move(ary_flat_1),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY FLAT 2", std::move(ary_flat_2),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     const auto  ary_res2 =
         df.kshape_groups<ary_col_t>(
@@ -2241,9 +2244,9 @@ static void test_kshape_groups()  {
     };
 
     df.load_column<ary_col_t>("ARY DE EXP 1", std::move(ary_de_exp_1),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY DE EXP 2", std::move(ary_de_exp_2),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     // Cluster B — step function shape
     //
@@ -2259,9 +2262,9 @@ static void test_kshape_groups()  {
     };
 
     df.load_column<ary_col_t>("ARY STEP 1", std::move(ary_step_1),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY STEP 2", std::move(ary_step_2),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     // Cluster C — V-shape (decrease then increase)
     //
@@ -2277,9 +2280,9 @@ static void test_kshape_groups()  {
     };
 
     df.load_column<ary_col_t>("ARY VSHAPE 1", std::move(ary_vshape_1),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<ary_col_t>("ARY VSHAPE 2", std::move(ary_vshape_2),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     const auto  ary_res3 =
         df.kshape_groups<ary_col_t>(
@@ -2522,9 +2525,9 @@ static void test_AnomalyDetectByKNNVisitor()  {
     }
 
     df.load_column<ary_col_t>("ARY COL", std::move(ary_col),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
     df.load_column<vec_col_t>("VEC COL", std::move(vec_col),
-                              nan_policy::dont_pad_with_nans);
+                                      nan_policy::dont_pad_with_nans);
 
     and_knn_v<vec_col_t>    vec_knn { 4, 5 };
     and_knn_v<ary_col_t>    ary_knn { 4, 5 };
@@ -2905,7 +2908,7 @@ static void test_KrigingVisitor()  {
     std::vector<double>                 obs { 1.0, 1.2, 4.0, 1.5 };
 
     df.load_column("COORDS 1", std::move(coords),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
     df.load_column("OBSERV 1", std::move(obs), nan_policy::dont_pad_with_nans);
 
     KrigingParams<double>  params;
@@ -2939,9 +2942,9 @@ static void test_KrigingVisitor()  {
     std::vector<double>                 obs2 { 1.0, 2.0, 3.0, qnan, 5.0 };
 
     df.load_column("COORDS 2", std::move(coords2),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
     df.load_column("OBSERV 2", std::move(obs2),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
 
     KrigingParams<double>   params2;
 
@@ -2977,9 +2980,9 @@ static void test_KrigingVisitor()  {
         obs3.push_back(x + 2.0 * y - z);
     }
     df.load_column("COORDS 3", std::move(coords3),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
     df.load_column("OBSERV 3", std::move(obs3),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
 
     KrigingParams<double>   params3;
 
@@ -3010,9 +3013,9 @@ static void test_KrigingVisitor()  {
     std::vector<double>                 obs4 { 0.0, 1.0, 0.5, 1.5, 1.0, 2.0 };
 
     df.load_column("COORDS 4", std::move(coords4),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
     df.load_column("OBSERV 4", std::move(obs4),
-                   nan_policy::dont_pad_with_nans);
+                           nan_policy::dont_pad_with_nans);
     for (double nu : { 0.7, 1.0, 1.8, 3.3 })  {
         KrigingParams<double>  params;
 
@@ -4401,7 +4404,7 @@ static void test_DurbinWatsonVisitor()  {
     //
     {
         df.load_column("x", std::vector<double>{ 1.0, -1.0, 1.0, -1.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         dw_test_v<double>   dw;
 
@@ -4421,7 +4424,7 @@ static void test_DurbinWatsonVisitor()  {
     //
     {
         df.load_column("y", gen_normal_dist<double>(col_s, p),
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         dw_test_v<double>   dw;
 
@@ -4575,9 +4578,9 @@ static void test_SilhouetteScoreVisitor()  {
     //
     {
         df.load_column("x1", std::vector<double>{ 0.0, 1.0, 10.0, 11.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl1", std::vector<long>{ 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         sil_score_v<double> sil;
 
@@ -4599,9 +4602,9 @@ static void test_SilhouetteScoreVisitor()  {
         df.load_column("x2",
                         std::vector<double>{ 0.0, 0.1, 0.2, 10.0, 10.1,
                                              10.2, 20.0, 20.1, 20.2 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl2", std::vector<long>{ 0, 0, 0, 1, 1, 1, 2, 2, 2 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         sil_score_v<double> sil;
 
@@ -4616,9 +4619,9 @@ static void test_SilhouetteScoreVisitor()  {
     //
     {
         df.load_column("x3", std::vector<double>{ 0.0, 5.0, 2.0, 10.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl3", std::vector<long>{ 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         sil_score_v<double> sil;
 
@@ -4635,9 +4638,9 @@ static void test_SilhouetteScoreVisitor()  {
     //
     {
         df.load_column("x4", std::vector<double>{ 0.0,  10.0, 11.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl4", std::vector<long>{ 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         sil_score_v<double> sil;
 
@@ -4658,9 +4661,9 @@ static void test_SilhouetteScoreVisitor()  {
     //
     {
         df.load_column("x5", std::vector<double>{ 5.0, 0.0, 1.0, 10.0, 11.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl5", std::vector<long>{ -1, 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         sil_score_v<double> sil;
 
@@ -4683,9 +4686,9 @@ static void test_SilhouetteScoreVisitor()  {
     //
     {
         df.load_column("x6", std::vector<double>{ 1.0, 2.0, 3.0, 4.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl6", std::vector<long>{ 0, 0, 0, 0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         sil_score_v<double> sil;
 
@@ -4702,9 +4705,9 @@ static void test_SilhouetteScoreVisitor()  {
     //
     {
         df.load_column("x6", std::vector<double>{ 1,2,3,4,5,6,7,8,9,10,11,12 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl6", std::vector<long>{ 0,0,0,0,1,1,1,1,2,2,2,2},
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         sil_score_v<double> sil;
 
@@ -4719,9 +4722,9 @@ static void test_SilhouetteScoreVisitor()  {
     //
     {
         df.load_column("x7", std::vector<double>{ 0.0, 1.0, 10.0, 11.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl7", std::vector<long>{ 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         // Absolute difference: dist(x, y) = |x - y|
         //
@@ -4763,9 +4766,9 @@ static void test_DaviesBouldinIndexVisitor()  {
     //
     {
         df.load_column("x1", std::vector<double>{ 0.0, 2.0, 10.0, 12.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl1", std::vector<long>{ 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         db_index_v<double>  db;
 
@@ -4794,9 +4797,9 @@ static void test_DaviesBouldinIndexVisitor()  {
         df.load_column("x2", std::vector<double>{ 0.0, 0.1, 0.2,
                                                   100.0, 100.1, 100.2,
                                                   200.0, 200.1, 200.2 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl2", std::vector<long>{ 0, 0, 0, 1, 1, 1, 2, 2, 2 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         db_index_v<double>  db;
 
@@ -4825,9 +4828,9 @@ static void test_DaviesBouldinIndexVisitor()  {
     {
         df.load_column("x3",
                        std::vector<double>{ 0, 10, 20, 30, 1, 11, 21, 31 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl3", std::vector<long>{ 0, 0, 0, 0, 1, 1, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         db_index_v<double>  db;
 
@@ -4854,9 +4857,9 @@ static void test_DaviesBouldinIndexVisitor()  {
     //
     {
         df.load_column("x4", std::vector<double>{ 5.0, 10.0, 12.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl4", std::vector<long>{ 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         db_index_v<double>  db;
 
@@ -4882,14 +4885,14 @@ static void test_DaviesBouldinIndexVisitor()  {
     {
         df.load_column("x5_noise",
                        std::vector<double>{ 5.0, 0.0, 2.0, 10.0, 12.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl5_noise", std::vector<long>{ -1, 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("x5_clean",
                        std::vector<double>{ 0.0, 2.0, 10.0, 12.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl5_clean", std::vector<long>{ 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         db_index_v<double>  db_noise;
         db_index_v<double>  db_clean;
@@ -4912,9 +4915,9 @@ static void test_DaviesBouldinIndexVisitor()  {
     //
     {
         df.load_column("x6", std::vector<double>{ 0.0, 2.0, 10.0, 12.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl6", std::vector<long>{ 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         // Absolute difference: dist(x, y) = |x - y|
         //
@@ -4990,9 +4993,9 @@ static void test_CalinskiHarabaszVisitor()  {
     //
     {
         df.load_column("x1", std::vector<double>{ 0.0, 2.0, 10.0, 12.0 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl1", std::vector<long>{ 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         ch_index_v<double>  ch;
 
@@ -5025,10 +5028,10 @@ static void test_CalinskiHarabaszVisitor()  {
                        std::vector<double>{ 0.0, 0.1, 0.2,
                                             100.0, 100.1, 100.2,
                                             200.0, 200.1, 200.2 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl2",
                        std::vector<long>{ 0, 0, 0,  1, 1, 1,  2, 2, 2 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         ch_index_v<double>  ch;
 
@@ -5059,9 +5062,9 @@ static void test_CalinskiHarabaszVisitor()  {
     {
         df.load_column("x3",
                        std::vector<double>{ 0, 10, 20, 30, 1, 11, 21, 31 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lbl3", std::vector<long>{ 0, 0, 0, 0, 1, 1, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         ch_index_v<double>  ch;
 
@@ -5091,19 +5094,19 @@ static void test_CalinskiHarabaszVisitor()  {
         // Same centroid positions, decreasing within-cluster spread
         //
         df.load_column("lose_x", std::vector<double>{ 0, 4, 20, 24 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("lose_lbl", std::vector<long>{ 0, 0,  1,  1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         df.load_column("tight_x", std::vector<double>{ 1, 3, 21, 23 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("tight_lbl", std::vector<long>{ 0, 0,  1,  1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         df.load_column("vtight_x", std::vector<double>{ 1.9, 2.1, 21.9, 22.1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("vtight_lbl", std::vector<long>{ 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         ch_index_v<double>  ch_l, ch_t, ch_v;
 
@@ -5123,19 +5126,19 @@ static void test_CalinskiHarabaszVisitor()  {
         // Same within-cluster spread, increasing inter-centroid gap
         //
         df.load_column("close_x", std::vector<double>{ 0, 1, 3, 4 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("close_lbl", std::vector<long>{ 0, 0,  1,  1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         df.load_column("far_x", std::vector<double>{ 0, 1, 10, 11 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("far_lbl", std::vector<long>{ 0, 0,  1,  1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         df.load_column("vfar_x", std::vector<double>{ 0, 1, 100, 101 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
         df.load_column("vfar_lbl", std::vector<long>{ 0, 0, 1, 1 },
-                       nan_policy::dont_pad_with_nans);
+                               nan_policy::dont_pad_with_nans);
 
         ch_index_v<double>  ch_c, ch_f, ch_v;
 
@@ -5343,7 +5346,7 @@ static void test_AnomalyDetectByIsoForestVisitor()  {
 
             x.push_back(dist);  // outlier at the end
             df.load_column(col_name.c_str(), std::move(x),
-                           nan_policy::dont_pad_with_nans);
+                                   nan_policy::dont_pad_with_nans);
 
             and_isoforest_v<double>  iso { 150, 10, 0.3 };
 
@@ -6381,6 +6384,2077 @@ static void test_remove_data_by_isof()  {
 
 // -----------------------------------------------------------------------------
 
+static void test_read_csv2_chunked()  {
+
+    std::cout << "\nTesting read_csv2_chunked( ) ..." << std::endl;
+
+    StrDataFrame    serial;
+    StrDataFrame    chunked;
+    ReadParams      params;
+
+    params.chunk_size = 16 * 1024;  // Force many chunks
+    try  {
+        serial.read("IBM.csv", io_format::csv2);
+        chunked.read("IBM.csv", io_format::csv2, params);
+    }
+    catch (const DataFrameError &ex)  {
+        std::cout << ex.what() << std::endl;
+        ::exit(-1);
+    }
+
+    assert((chunked.get_index().size() == 5031));
+    assert((chunked.get_index() == serial.get_index()));
+    assert((chunked.get_column<double>("IBM_Close") ==
+            serial.get_column<double>("IBM_Close")));
+    assert((chunked.get_column<long>("IBM_Volume") ==
+            serial.get_column<long>("IBM_Volume")));
+
+    // Reading a slice of rows that spans several chunks
+    //
+    StrDataFrame    serial_slice;
+    StrDataFrame    chunked_slice;
+
+    ReadParams      serial_params;
+
+    serial_params.starting_row = 1000;
+    serial_params.num_rows = 2500;
+    params.starting_row = 1000;
+    params.num_rows = 2500;
+    params.num_threads = 2;
+    serial_slice.read("IBM.csv", io_format::csv2, serial_params);
+    chunked_slice.read("IBM.csv", io_format::csv2, params);
+    assert((chunked_slice.get_index().size() == 2500));
+    assert((chunked_slice.get_index() == serial_slice.get_index()));
+    assert((chunked_slice.get_column<double>("IBM_Open") ==
+            serial_slice.get_column<double>("IBM_Open")));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_read_csv2_typed_fields()  {
+
+    std::cout << "\nTesting read_csv2_typed_fields( ) ..." << std::endl;
+
+    ULDataFrame df;
+    ReadParams  params;
+
+    params.num_rows = 3;
+    try  {
+        df.read("csv2_format_data.csv", io_format::csv2, params);
+    }
+    catch (const DataFrameError &ex)  {
+        std::cout << ex.what() << std::endl;
+        ::exit(-1);
+    }
+
+    assert((df.get_index().size() == 3));
+    assert((df.get_index().capacity() == 3));
+    assert((df.get_column<unsigned long>("ul_col")[2] == 123452));
+    assert((df.get_column<double>("dbl_col_2")[1] == 0.3456));
+    assert((df.get_column<bool>("bool_col")[0] == true));
+    assert((df.get_column<std::string>("str_col")[1] == "Description 4/5"));
+    assert((df.get_column<int>("xint_col")[2] == 3));
+    assert((df.get_column<char>("char_col")[0] == 'C'));
+    assert((df.get_column<char>("char_col")[1] == 23));
+
+    // The last field of each line used to see the trailing newline
+    //
+    assert((df.get_column<unsigned char>("uchar_col")[0] == 'B'));
+    assert((df.get_column<unsigned char>("uchar_col")[2] == '&'));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_mmap_binary()  {
+
+    std::cout << "\nTesting mmap_binary( ) ..." << std::endl;
+
+    StrDataFrame    ibm;
+
+    try  {
+        ibm.read("SHORT_IBM.csv", io_format::csv2);
+        ibm.write<double, long>("./SHORT_IBM_dup.mmb", io_format::mmap_binary);
+    }
+    catch (const DataFrameError &ex)  {
+        std::cout << ex.what() << std::endl;
+        ::exit(-1);
+    }
+
+    StrDataFrame    eager;
+
+    eager.read("./SHORT_IBM_dup.mmb", io_format::mmap_binary);
+    assert((eager.get_index() == ibm.get_index()));
+    assert((eager.get_column<double>("IBM_Close") ==
+            ibm.get_column<double>("IBM_Close")));
+    assert((eager.get_column<long>("IBM_Volume") ==
+            ibm.get_column<long>("IBM_Volume")));
+
+    StrDataFrame    lazy;
+    ReadParams      params;
+
+    params.lazy_load = true;
+    params.starting_row = 100;
+    params.num_rows = 500;
+    lazy.read("./SHORT_IBM_dup.mmb", io_format::mmap_binary, params);
+    assert((lazy.get_index().size() == 500));
+    assert((lazy.get_index()[0] == ibm.get_index()[100]));
+    assert((lazy.has_column("IBM_Open")));
+
+    // Read in place, without loading the column
+    //
+    const auto  open_view = lazy.get_mapped_column<double>("IBM_Open");
+
+    assert((open_view.size() == 500));
+    assert((open_view[0] == ibm.get_column<double>("IBM_Open")[100]));
+    assert((open_view[499] == ibm.get_column<double>("IBM_Open")[599]));
+    try  {
+        const auto  vol_view = lazy.get_mapped_column<double>("IBM_Volume");
+
+        assert(false);
+    }
+    catch (const DataFrameError &)  {   }
+
+    // Loaded on first access
+    //
+    const auto  &vol = lazy.get_column<long>("IBM_Volume");
+
+    assert((vol.size() == 500));
+    assert((vol[10] == ibm.get_column<long>("IBM_Volume")[110]));
+    try  {
+        const auto  vol_view = lazy.get_mapped_column<long>("IBM_Volume");
+
+        assert(false);
+    }
+    catch (const ColNotFound &)  {   }
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_hash_groupby()  {
+
+    std::cout << "\nTesting hash_groupby( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 300000;
+
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<int>             key1(item_cnt);
+    StlVecType<std::string>     key2(item_cnt);
+    StlVecType<double>          dbl(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        key1[i] = int((i * 7919) % 4999);
+        key2[i] = (i % 3) ? "AAA" : "BBB";
+        dbl[i] = double(i % 100);
+    }
+
+    ULDataFrame df;
+
+    df.load_data(std::move(idx),
+                 std::make_pair("key1", key1),
+                 std::make_pair("key2", key2),
+                 std::make_pair("dbl", dbl));
+
+    // Force the partitioned path even on small machines
+    //
+    ULDataFrame::set_thread_level(4);
+
+    const auto  sorted1 =
+        df.groupby1<int>("key1",
+                         MaxVisitor<unsigned long, unsigned long>(),
+                         std::make_tuple("dbl", "sum", SumVisitor<double>()));
+    const auto  hashed1 =
+        df.hash_groupby1<int>(
+            "key1", group_order::sorted,
+            MaxVisitor<unsigned long, unsigned long>(),
+            std::make_tuple("dbl", "sum", SumVisitor<double>()));
+
+    assert(hashed1.get_index().size() == 4999);
+    assert((hashed1.get_index() == sorted1.get_index()));
+    assert((hashed1.get_column<int>("key1") ==
+            sorted1.get_column<int>("key1")));
+    assert((hashed1.get_column<double>("sum") ==
+            sorted1.get_column<double>("sum")));
+
+    auto        fut =
+        df.hash_groupby1_async<int>(
+            "key1", group_order::first_seen,
+            MaxVisitor<unsigned long, unsigned long>(),
+            std::make_tuple("dbl", "sum", SumVisitor<double>()));
+    const auto  seen1 = fut.get();
+    const auto  &seen_keys = seen1.get_column<int>("key1");
+
+    assert(seen_keys.size() == 4999);
+    for (std::size_t i = 0; i < 10; ++i)
+        assert(seen_keys[i] == key1[i]);
+
+    const auto  sorted2 =
+        df.groupby2<std::string, int>(
+            "key2", "key1",
+            MaxVisitor<unsigned long, unsigned long>(),
+            std::make_tuple("dbl", "sum", SumVisitor<double>()));
+    const auto  hashed2 =
+        df.hash_groupby2<std::string, int>(
+            "key2", "key1", group_order::sorted,
+            MaxVisitor<unsigned long, unsigned long>(),
+            std::make_tuple("dbl", "sum", SumVisitor<double>()));
+
+    assert((hashed2.get_index() == sorted2.get_index()));
+    assert((hashed2.get_column<std::string>("key2") ==
+            sorted2.get_column<std::string>("key2")));
+    assert((hashed2.get_column<double>("sum") ==
+            sorted2.get_column<double>("sum")));
+
+    ULDataFrame::set_optimum_thread_level();
+
+    // Serial path, groups over the index and a column
+    //
+    const auto  seen3 =
+        df.hash_groupby3<int, std::string, unsigned long>(
+            "key1", "key2", DF_INDEX_COL_NAME, group_order::first_seen,
+            MaxVisitor<unsigned long, unsigned long>(),
+            std::make_tuple("dbl", "sum", SumVisitor<double>()));
+
+    assert(seen3.get_index().size() == item_cnt);
+    assert(seen3.get_index()[5] == 5);
+    assert(seen3.get_column<double>("sum")[5] == 5.0);
+}
+
+static void test_hash_join()  {
+
+    std::cout << "\nTesting hash_join( ) ..." << std::endl;
+
+    constexpr std::size_t   big_cnt = 300000;
+    constexpr std::size_t   small_cnt = 20000;
+
+    StlVecType<unsigned long>   big_idx(big_cnt);
+    StlVecType<int>             big_key(big_cnt);
+    StlVecType<unsigned long>   big_val(big_cnt);
+    StlVecType<unsigned long>   small_idx(small_cnt);
+    StlVecType<int>             small_key(small_cnt);
+    StlVecType<unsigned long>   small_val(small_cnt);
+
+    for (std::size_t i = 0; i < big_cnt; ++i)  {
+        big_idx[i] = (i * 7919) % 50000;
+        big_key[i] = int((i * 104729) % 70000);
+        big_val[i] = i;
+    }
+    for (std::size_t i = 0; i < small_cnt; ++i)  {
+        small_idx[i] = (i * 31) % 60000;
+        small_key[i] = int((i * 17) % 90000);
+        small_val[i] = i;
+    }
+
+    ULDataFrame big;
+    ULDataFrame small;
+
+    big.load_data(std::move(big_idx),
+                  std::make_pair("key", big_key),
+                  std::make_pair("big_val", big_val));
+    small.load_data(std::move(small_idx),
+                    std::make_pair("key", small_key),
+                    std::make_pair("small_val", small_val));
+
+    using row_t = std::tuple<unsigned long, unsigned long, unsigned long>;
+
+    auto    index_rows =
+        [](const auto &df) -> std::vector<row_t>  {
+            const auto                  &idx = df.get_index();
+            const auto                  &bv =
+                df.template get_column<unsigned long>("big_val");
+            const auto                  &sv =
+                df.template get_column<unsigned long>("small_val");
+            std::vector<row_t>  rows;
+
+            for (std::size_t i = 0; i < idx.size(); ++i)
+                rows.emplace_back(idx[i],
+                                  i < bv.size() ? bv[i] : 0,
+                                  i < sv.size() ? sv[i] : 0);
+            std::ranges::sort(rows);
+            return (rows);
+        };
+    auto    column_rows =
+        [](const auto &df) -> std::vector<row_t>  {
+            const auto                  &lhs_idx =
+                df.template get_column<unsigned long>("lhs.INDEX");
+            const auto                  &rhs_idx =
+                df.template get_column<unsigned long>("rhs.INDEX");
+            std::vector<row_t>  rows;
+
+            for (std::size_t i = 0; i < lhs_idx.size(); ++i)
+                rows.emplace_back(lhs_idx[i], rhs_idx[i], 0);
+            std::ranges::sort(rows);
+            return (rows);
+        };
+
+    // Force the parallel probe even on small machines
+    //
+    ULDataFrame::set_thread_level(4);
+
+    for (const auto jp : { join_policy::inner_join,
+                           join_policy::left_join,
+                           join_policy::right_join,
+                           join_policy::left_right_join })  {
+        const auto  sm_idx =
+            big.join_by_index<decltype(small), int, unsigned long>
+                (small, jp, join_strategy::sort_merge);
+        const auto  hs_idx =
+            big.join_by_index<decltype(small), int, unsigned long>
+                (small, jp, join_strategy::hash);
+        const auto  au_idx =
+            small.join_by_index<decltype(big), int, unsigned long>
+                (big, jp, join_strategy::automatic);
+
+        assert(hs_idx.get_index().size() == sm_idx.get_index().size());
+        assert((index_rows(hs_idx) == index_rows(sm_idx)));
+        if (jp == join_policy::inner_join)
+            assert((index_rows(au_idx) == index_rows(sm_idx)));
+
+        const auto  sm_col =
+            big.join_by_column<decltype(small), int, unsigned long>
+                (small, "key", jp, join_strategy::sort_merge);
+        const auto  hs_col =
+            small.join_by_column<decltype(big), int, unsigned long>
+                (big, "key", jp, join_strategy::hash);
+        const auto  au_col =
+            big.join_by_column<decltype(small), int, unsigned long>
+                (small, "key", jp, join_strategy::automatic);
+
+        assert((column_rows(au_col) == column_rows(sm_col)));
+        if (jp == join_policy::inner_join)  {
+            auto    swapped = column_rows(hs_col);
+
+            for (auto &row : swapped)
+                std::swap(std::get<0>(row), std::get<1>(row));
+            std::ranges::sort(swapped);
+            assert((swapped == column_rows(sm_col)));
+        }
+    }
+
+    ULDataFrame::set_optimum_thread_level();
+
+    // Both sides sorted: automatic merges directly and keeps key order
+    //
+    ULDataFrame lhs;
+    ULDataFrame rhs;
+
+    lhs.load_data(StlVecType<unsigned long> { 1, 2, 2, 4, 6, 8 },
+                  std::make_pair("lhs_val",
+                                 StlVecType<int> { 10, 20, 21, 40, 60, 80 }));
+    rhs.load_data(StlVecType<unsigned long> { 2, 3, 4, 8, 9 },
+                  std::make_pair("rhs_val",
+                                 StlVecType<int> { 200, 300, 400, 800, 900 }));
+
+    const auto  sorted =
+        lhs.join_by_index<decltype(rhs), int>
+            (rhs, join_policy::left_join, join_strategy::sort_merge);
+    const auto  automatic =
+        lhs.join_by_index<decltype(rhs), int>
+            (rhs, join_policy::left_join, join_strategy::automatic);
+
+    assert((automatic.get_index() == sorted.get_index()));
+    assert((automatic.get_column<int>("lhs_val") ==
+            sorted.get_column<int>("lhs_val")));
+    assert((automatic.get_column<int>("rhs_val") ==
+            sorted.get_column<int>("rhs_val")));
+
+    // Hash join keeps the larger (probe) side order
+    //
+    const auto  hashed =
+        lhs.join_by_index<decltype(rhs), int>
+            (rhs, join_policy::inner_join, join_strategy::hash);
+
+    assert((hashed.get_index() ==
+            StlVecType<unsigned long> { 2, 2, 4, 8 }));
+    assert((hashed.get_column<int>("lhs_val") ==
+            StlVecType<int> { 20, 21, 40, 80 }));
+    assert((hashed.get_column<int>("rhs_val") ==
+            StlVecType<int> { 200, 200, 400, 800 }));
+}
+
+static void test_incremental_roll()  {
+
+    std::cout << "\nTesting incremental_roll( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 20000;
+    constexpr std::size_t   roll_cnt = 100;
+
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          col1(item_cnt);
+    StlVecType<double>          col2(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        col1[i] = 1.0e6 + std::sin(double(i)) * 100.0 + double(i % 17);
+        col2[i] = std::cos(double(i) / 3.0) * 50.0 - double(i % 11);
+    }
+    col1[250] = std::numeric_limits<double>::quiet_NaN();
+    col2[7000] = std::numeric_limits<double>::quiet_NaN();
+
+    ULDataFrame df;
+
+    df.load_data(std::move(idx),
+                 std::make_pair("col1", col1),
+                 std::make_pair("col2", col2));
+
+    // Compare against running the visitor over each window from scratch
+    //
+    auto    check =
+        [&df](const char *name, auto visitor, double tol) -> void  {
+            using visitor_t = decltype(visitor);
+
+            SimpleRollAdopter<visitor_t, double> roller(visitor_t(visitor),
+                                                        roll_cnt);
+            const auto  &result =
+                df.single_act_visit<double>(name, roller).get_result();
+            const auto  &col = df.get_column<double>(name);
+            const auto  &index = df.get_index();
+
+            assert(result.size() == item_cnt);
+            for (std::size_t i = 0; i < roll_cnt - 1; ++i)
+                assert(std::isnan(result[i]));
+            for (std::size_t i = roll_cnt - 1; i < item_cnt; ++i)  {
+                visitor_t   v = visitor;
+
+                v.pre();
+                v(index.begin() + (i + 1 - roll_cnt), index.begin() + (i + 1),
+                  col.begin() + (i + 1 - roll_cnt), col.begin() + (i + 1));
+                v.post();
+                if (std::isnan(v.get_result()))
+                    assert(std::isnan(result[i]));
+                else
+                    assert(std::fabs(result[i] - v.get_result()) <=
+                           tol * std::max(1.0, std::fabs(v.get_result())));
+            }
+        };
+
+    check("col1", SumVisitor<double>(), 1e-12);
+    check("col1", SumVisitor<double>(true), 1e-12);
+    check("col2", MeanVisitor<double>(), 1e-12);
+    check("col1", MeanVisitor<double>(true), 1e-12);
+    check("col2", VarVisitor<double>(), 1e-9);
+    check("col2", StdVisitor<double>(true, true), 1e-9);
+
+    // col1 has a large offset, so compare with a two-pass variance
+    //
+    SimpleRollAdopter<VarVisitor<double>, double>   var_roller(
+        VarVisitor<double>(false, true), roll_cnt);
+    const auto                                      &var_result =
+        df.single_act_visit<double>("col1", var_roller).get_result();
+
+    for (std::size_t i = roll_cnt - 1; i < item_cnt; i += 97)  {
+        double      mean { 0 };
+        double      sq_sum { 0 };
+        std::size_t cnt { 0 };
+
+        for (std::size_t j = i + 1 - roll_cnt; j <= i; ++j)
+            if (! std::isnan(col1[j]))  { mean += col1[j]; cnt += 1; }
+        mean /= double(cnt);
+        for (std::size_t j = i + 1 - roll_cnt; j <= i; ++j)
+            if (! std::isnan(col1[j]))
+                sq_sum += (col1[j] - mean) * (col1[j] - mean);
+        assert(std::fabs(var_result[i] - sq_sum / double(cnt - 1)) <
+               1e-8 * var_result[i]);
+    }
+
+    auto    check2 =
+        [&df](auto visitor, double tol) -> void  {
+            using visitor_t = decltype(visitor);
+
+            SimpleRollAdopter<visitor_t, double> roller(visitor_t(visitor),
+                                                        roll_cnt);
+            const auto  &result =
+                df.single_act_visit<double, double>
+                    ("col1", "col2", roller).get_result();
+            const auto  &col1 = df.get_column<double>("col1");
+            const auto  &col2 = df.get_column<double>("col2");
+            const auto  &index = df.get_index();
+
+            assert(result.size() == item_cnt);
+            for (std::size_t i = roll_cnt - 1; i < item_cnt; ++i)  {
+                visitor_t   v = visitor;
+
+                v.pre();
+                v(index.begin() + (i + 1 - roll_cnt), index.begin() + (i + 1),
+                  col1.begin() + (i + 1 - roll_cnt), col1.begin() + (i + 1),
+                  col2.begin() + (i + 1 - roll_cnt), col2.begin() + (i + 1));
+                v.post();
+                if (std::isnan(v.get_result()))
+                    assert(std::isnan(result[i]));
+                else
+                    assert(std::fabs(result[i] - v.get_result()) <=
+                           tol * std::max(1.0, std::fabs(v.get_result())));
+            }
+        };
+
+    check2(CovVisitor<double>(), 1e-6);
+    check2(CovVisitor<double>(false, true), 1e-6);
+    check2(CorrVisitor<double>(correlation_type::pearson, false, true), 1e-6);
+
+    // Visitors without the rolling protocol still work through re-evaluation
+    //
+    check("col2", MaxVisitor<double>(), 0);
+    check2(CorrVisitor<double>(correlation_type::spearman), 1e-12);
+}
+
+static void test_rolling_order_stats()  {
+
+    std::cout << "\nTesting rolling_order_stats( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 3000;
+    constexpr std::size_t   roll_cnt = 50;
+
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          col(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        col[i] = double((i * 7919) % 1009) / 10.0 + std::sin(double(i));
+    }
+    col[100] = col[101];  // Duplicates
+    col[102] = col[101];
+
+    ULDataFrame df;
+
+    df.load_data(std::move(idx), std::make_pair("col", col));
+
+    auto    check =
+        [&df](auto &&rolling, auto &&roller) -> void  {
+            const auto  &result1 =
+                df.single_act_visit<double>("col", rolling).get_result();
+            const auto  &result2 =
+                df.single_act_visit<double>("col", roller).get_result();
+
+            assert(result1.size() == item_cnt);
+            assert(result2.size() == item_cnt);
+            for (std::size_t i = 0; i < item_cnt; ++i)  {
+                if (std::isnan(result2[i]))
+                    assert(std::isnan(result1[i]));
+                else
+                    assert(std::fabs(result1[i] - result2[i]) < 1e-10);
+            }
+        };
+
+    check(RollingMedianVisitor<double>(roll_cnt),
+          SimpleRollAdopter<MedianVisitor<double>, double>
+              (MedianVisitor<double>(), roll_cnt));
+    check(RollingMedianVisitor<double>(roll_cnt - 1),
+          SimpleRollAdopter<MedianVisitor<double>, double>
+              (MedianVisitor<double>(), roll_cnt - 1));
+    for (const auto policy : { quantile_policy::lower_value,
+                               quantile_policy::higher_value,
+                               quantile_policy::mid_point,
+                               quantile_policy::linear })  {
+        check(RollingQuantileVisitor<double>(roll_cnt, 0.25, policy),
+              SimpleRollAdopter<QuantileVisitor<double>, double>
+                  (QuantileVisitor<double>(0.25, policy), roll_cnt));
+        check(RollingQuantileVisitor<double>(roll_cnt, 0.9, policy),
+              SimpleRollAdopter<QuantileVisitor<double>, double>
+                  (QuantileVisitor<double>(0.9, policy), roll_cnt));
+    }
+    for (const auto mt : { mad_type::mean_abs_dev_around_mean,
+                           mad_type::mean_abs_dev_around_median,
+                           mad_type::median_abs_dev_around_mean,
+                           mad_type::median_abs_dev_around_median })  {
+        check(RollingMADVisitor<double>(roll_cnt, mt),
+              SimpleRollAdopter<MADVisitor<double>, double>
+                  (MADVisitor<double>(mt), roll_cnt));
+    }
+
+    // NaN handling
+    //
+    StlVecType<double>  nan_col =
+        { 1, 5, 2, std::numeric_limits<double>::quiet_NaN(), 4, 3, 8 };
+
+    df.load_column<double>("nan_col", std::move(nan_col),
+                           nan_policy::dont_pad_with_nans);
+
+    RollingMedianVisitor<double>    med(3);
+    const auto                      &med_res =
+        df.single_act_visit<double>("nan_col", med).get_result();
+
+    assert(med_res.size() == 7);
+    assert(std::isnan(med_res[1]));
+    assert(med_res[2] == 2.0);
+    assert(std::isnan(med_res[3]));
+    assert(std::isnan(med_res[5]));
+    assert(med_res[6] == 4.0);
+
+    RollingMedianVisitor<double>    med_skip(3, true);
+    const auto                      &med_skip_res =
+        df.single_act_visit<double>("nan_col", med_skip).get_result();
+
+    assert(med_skip_res[2] == 2.0);
+    assert(med_skip_res[3] == 3.5);
+    assert(med_skip_res[4] == 3.0);
+    assert(med_skip_res[5] == 3.5);
+    assert(med_skip_res[6] == 4.0);
+
+    RollingMADVisitor<double>   mad_skip(
+        3, mad_type::median_abs_dev_around_median, true);
+    const auto                  &mad_skip_res =
+        df.single_act_visit<double>("nan_col", mad_skip).get_result();
+
+    assert(mad_skip_res[2] == 1.0);
+    assert(mad_skip_res[3] == 1.5);
+    assert(mad_skip_res[6] == 1.0);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_parallel_sel()  {
+
+    std::cout << "\nTesting parallel get_data_by_sel( ) ..." << std::endl;
+
+    constexpr std::size_t       item_cnt = 300'000;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          dbl(item_cnt);
+    StlVecType<int>             ints(item_cnt);
+    StlVecType<std::string>     strs(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        dbl[i] = (i % 101 == 0) ? std::nan("") : double((i * 7919) % 1000);
+        ints[i] = int(i % 13);
+        strs[i] = (i % 3) ? "AAA" : "BBB";
+    }
+
+    ULDataFrame df;
+
+    df.load_data(std::move(idx),
+                 std::make_pair("dbl", dbl),
+                 std::make_pair("ints", ints),
+                 std::make_pair("strs", strs));
+
+    auto    functor =
+        [](const unsigned long &, const double &val) -> bool  {
+            return (val > 500.0);
+        };
+    auto    functor2 =
+        [](const unsigned long &idx, const double &val, const int &i) -> bool  {
+            return (val <= 250.0 && i != 5 && idx % 2 == 0);
+        };
+
+    ULDataFrame::set_thread_level(0);
+
+    const auto  serial =
+        df.get_data_by_sel<double, decltype(functor),
+                           double, int, std::string>("dbl", functor);
+    const auto  serial2 =
+        df.get_data_by_sel<double, int, decltype(functor2),
+                           double, int, std::string>("dbl", "ints", functor2);
+    const auto  serial_cmp =
+        df.get_data_by_sel<double, double, int, std::string>(
+            "dbl", compare_op::gt, 500.0);
+
+    assert(serial.get_index().size() > 100'000);
+    assert((serial_cmp.get_index() == serial.get_index()));
+    assert((serial_cmp.get_column<double>("dbl") ==
+            serial.get_column<double>("dbl")));
+
+    // 4 threads and 3 columns: each column is gathered by all threads.
+    // 3 threads and 3 columns: each thread gathers whole columns.
+    //
+    for (const std::size_t thr_cnt : { 4, 3 })  {
+        ULDataFrame::set_thread_level(thr_cnt);
+
+        const auto  par =
+            df.get_data_by_sel<double, decltype(functor),
+                               double, int, std::string>("dbl", functor);
+
+        assert((par.get_index() == serial.get_index()));
+        assert((par.get_column<double>("dbl") ==
+                serial.get_column<double>("dbl")));
+        assert((par.get_column<int>("ints") ==
+                serial.get_column<int>("ints")));
+        assert((par.get_column<std::string>("strs") ==
+                serial.get_column<std::string>("strs")));
+
+        const auto  par2 =
+            df.get_data_by_sel<double, int, decltype(functor2),
+                               double, int, std::string>
+                ("dbl", "ints", functor2);
+
+        assert((par2.get_index() == serial2.get_index()));
+        assert((par2.get_column<std::string>("strs") ==
+                serial2.get_column<std::string>("strs")));
+
+        const auto  par_cmp =
+            df.get_data_by_sel<double, double, int, std::string>(
+                "dbl", compare_op::gt, 500.0);
+
+        assert((par_cmp.get_index() == serial.get_index()));
+        assert((par_cmp.get_column<int>("ints") ==
+                serial.get_column<int>("ints")));
+
+        const auto  view =
+            df.get_view_by_sel<double, decltype(functor),
+                               double, int, std::string>("dbl", functor);
+
+        assert(view.get_index().size() == serial.get_index().size());
+        assert(view.get_column<double>("dbl")[100] ==
+               serial.get_column<double>("dbl")[100]);
+    }
+
+    // Check every comparison operator against the equivalent functor
+    //
+    const std::vector<std::pair<compare_op,
+                                std::function<bool(int, int)>>> ops  {
+        { compare_op::eq, [](int a, int b) { return (a == b); } },
+        { compare_op::ne, [](int a, int b) { return (a != b); } },
+        { compare_op::lt, [](int a, int b) { return (a < b); } },
+        { compare_op::le, [](int a, int b) { return (a <= b); } },
+        { compare_op::gt, [](int a, int b) { return (a > b); } },
+        { compare_op::ge, [](int a, int b) { return (a >= b); } },
+    };
+
+    for (const auto &[op, cmp] : ops)  {
+        const auto  res =
+            df.get_view_by_sel<int, double, int, std::string>(
+                "ints", op, 7);
+        const auto  &res_idx = res.get_index();
+        std::size_t expected { 0 };
+
+        for (std::size_t i = 0; i < item_cnt; ++i)
+            if (cmp(ints[i], 7))  {
+                assert(res_idx[expected] == i);
+                expected += 1;
+            }
+        assert(res_idx.size() == expected);
+    }
+
+    // NaN compares false, except for ne
+    //
+    const auto  nan_ne =
+        df.get_data_by_sel<double, double, int, std::string>(
+            "dbl", compare_op::ne, 1000.0);
+    const auto  str_eq =
+        df.get_data_by_sel<std::string, double, int, std::string>(
+            "strs", compare_op::eq, std::string("BBB"));
+
+    assert(nan_ne.get_index().size() == item_cnt);
+    assert(str_eq.get_index().size() == item_cnt / 3);
+    assert(str_eq.get_index()[1] == 3);
+
+    ULDataFrame::set_optimum_thread_level();
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_radix_sort()  {
+
+    std::cout << "\nTesting radix sort( ) ..." << std::endl;
+
+    constexpr std::size_t       item_cnt = 300'000;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          dbl(item_cnt);
+    StlVecType<int>             ints(item_cnt);
+    StlVecType<DateTime>        dts(item_cnt);
+    StlVecType<long>            rows(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = (i * 104729) % item_cnt;
+        dbl[i] = (i % 997 == 0)
+            ? std::nan("") : double(long((i * 7919) % 20011) - 10000) / 7.0;
+        ints[i] = int((i * 31) % 1001) - 500;
+        dts[i] = DateTime(20240101 + (i % 28), 10, 30, 0,
+                          (i * 7) % 1000, DT_TIME_ZONE::GMT);
+        rows[i] = long(i);
+    }
+
+    ULDataFrame df;
+
+    df.load_data(std::move(idx),
+                 std::make_pair("dbl", dbl),
+                 std::make_pair("ints", ints),
+                 std::make_pair("dts", dts),
+                 std::make_pair("rows", rows));
+
+    // Every other column must move with the key column
+    //
+    auto    check_rows =
+        [&df, &dbl, &ints, &dts]() -> void  {
+            const auto  &rows_col = df.get_column<long>("rows");
+            const auto  &dbl_col = df.get_column<double>("dbl");
+            const auto  &ints_col = df.get_column<int>("ints");
+            const auto  &dts_col = df.get_column<DateTime>("dts");
+
+            for (std::size_t i = 0; i < item_cnt; ++i)  {
+                const auto  r = rows_col[i];
+
+                assert(ints_col[i] == ints[r]);
+                assert(dts_col[i] == dts[r]);
+                assert((std::isnan(dbl_col[i]) && std::isnan(dbl[r])) ||
+                       dbl_col[i] == dbl[r]);
+            }
+        };
+
+    for (const std::size_t thr_cnt : { 0, 4 })  {
+        ULDataFrame::set_thread_level(thr_cnt);
+
+        // Stable, so ties keep the order of the previous sort
+        //
+        df.sort<long, unsigned long, double, int, DateTime, long>
+            ("rows", sort_spec::ascen);
+        df.sort<int, unsigned long, double, int, DateTime, long>
+            ("ints", sort_spec::desce);
+        check_rows();
+        {
+            const auto  &ints_col = df.get_column<int>("ints");
+            const auto  &rows_col = df.get_column<long>("rows");
+
+            for (std::size_t i = 1; i < item_cnt; ++i)  {
+                assert(ints_col[i - 1] >= ints_col[i]);
+                if (ints_col[i - 1] == ints_col[i])
+                    assert(rows_col[i - 1] < rows_col[i]);
+            }
+        }
+
+        df.sort<double, unsigned long, double, int, DateTime, long>
+            ("dbl", sort_spec::ascen);
+        check_rows();
+        {
+            const auto  &dbl_col = df.get_column<double>("dbl");
+            const auto  nan_cnt = std::count_if(dbl.begin(), dbl.end(),
+                                                [](double d)  {
+                                                    return (std::isnan(d));
+                                                });
+
+            // NaNs go to the end
+            //
+            for (std::size_t i = item_cnt - nan_cnt; i < item_cnt; ++i)
+                assert(std::isnan(dbl_col[i]));
+            for (std::size_t i = 1; i < item_cnt - nan_cnt; ++i)
+                assert(dbl_col[i - 1] <= dbl_col[i]);
+        }
+
+        df.sort<double, unsigned long, double, int, DateTime, long>
+            ("dbl", sort_spec::abs_desce);
+        check_rows();
+        {
+            const auto  &dbl_col = df.get_column<double>("dbl");
+
+            assert(std::isnan(dbl_col.back()));
+            for (std::size_t i = 1; i < item_cnt; ++i)  {
+                if (std::isnan(dbl_col[i]))  break;
+                assert(std::fabs(dbl_col[i - 1]) >= std::fabs(dbl_col[i]));
+            }
+        }
+
+        df.sort<DateTime, unsigned long, double, int, DateTime, long>
+            ("dts", sort_spec::ascen);
+        check_rows();
+        {
+            const auto  &dts_col = df.get_column<DateTime>("dts");
+
+            for (std::size_t i = 1; i < item_cnt; ++i)
+                assert(dts_col[i - 1] <= dts_col[i]);
+        }
+
+        df.sort<unsigned long, double, int, DateTime, long>
+            (DF_INDEX_COL_NAME, sort_spec::ascen);
+        check_rows();
+        {
+            const auto  &index = df.get_index();
+
+            for (std::size_t i = 0; i < item_cnt; ++i)
+                assert(index[i] == i);
+        }
+
+        const auto  perm = df.permutation_vec<int>("ints", sort_spec::ascen);
+        const auto  &ints_col = df.get_column<int>("ints");
+
+        assert(perm.size() == item_cnt);
+        for (std::size_t i = 1; i < item_cnt; ++i)  {
+            assert(ints_col[perm[i - 1]] <= ints_col[perm[i]]);
+            if (ints_col[perm[i - 1]] == ints_col[perm[i]])
+                assert(perm[i - 1] < perm[i]);
+        }
+    }
+
+    ULDataFrame::set_optimum_thread_level();
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_permute_columns()  {
+
+    std::cout << "\nTesting permute columns ..." << std::endl;
+
+    constexpr std::size_t       item_cnt = 300'000;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          dbl(item_cnt);
+    StlVecType<int>             ints(item_cnt);
+    StlVecType<std::string>     strs(item_cnt);
+    StlVecType<long>            rows(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        dbl[i] = double((i * 7919) % 20011) / 7.0;
+        ints[i] = int((i * 31) % 101);
+        strs[i] = std::to_string(i);
+        rows[i] = long(i);
+    }
+
+    ULDataFrame df;
+
+    df.load_data(std::move(idx),
+                 std::make_pair("dbl", dbl),
+                 std::make_pair("ints", ints),
+                 std::make_pair("strs", strs),
+                 std::make_pair("rows", rows));
+
+    // Every column must move with the sort columns
+    //
+    auto    check_rows =
+        [&dbl, &ints, &strs](const ULDataFrame &res) -> void  {
+            const auto  &index = res.get_index();
+            const auto  &rows_col = res.get_column<long>("rows");
+            const auto  &dbl_col = res.get_column<double>("dbl");
+            const auto  &ints_col = res.get_column<int>("ints");
+            const auto  &strs_col = res.get_column<std::string>("strs");
+
+            for (std::size_t i = 0; i < index.size(); ++i)  {
+                const auto  r = rows_col[i];
+
+                assert(index[i] == static_cast<unsigned long>(r));
+                assert(dbl_col[i] == dbl[r]);
+                assert(ints_col[i] == ints[r]);
+                assert(strs_col[i] == strs[r]);
+            }
+        };
+
+    for (const std::size_t budget :
+             { std::numeric_limits<std::size_t>::max(), std::size_t(0) })  {
+        ULDataFrame::set_permute_mem_budget(budget);
+        assert(ULDataFrame::get_permute_mem_budget() == budget);
+
+        for (const std::size_t thr_cnt : { 0, 4 })  {
+            ULDataFrame::set_thread_level(thr_cnt);
+
+            df.sort<int, double, unsigned long, double, int, std::string, long>
+                ("ints", sort_spec::ascen, "dbl", sort_spec::desce);
+            check_rows(df);
+            {
+                const auto  &ints_col = df.get_column<int>("ints");
+                const auto  &dbl_col = df.get_column<double>("dbl");
+
+                for (std::size_t i = 1; i < item_cnt; ++i)  {
+                    assert(ints_col[i - 1] <= ints_col[i]);
+                    if (ints_col[i - 1] == ints_col[i])
+                        assert(dbl_col[i - 1] >= dbl_col[i]);
+                }
+            }
+
+            df.sort<std::string, unsigned long, double, int, std::string,
+                    long>
+                ("strs", sort_spec::desce);
+            check_rows(df);
+
+            df.sort<unsigned long, double, int, std::string, long>
+                (DF_INDEX_COL_NAME, sort_spec::ascen);
+            check_rows(df);
+            assert((df.get_column<long>("rows")[item_cnt - 1] ==
+                    long(item_cnt - 1)));
+
+            StlVecType<unsigned long>   wanted;
+
+            for (unsigned long i = 0; i < item_cnt; i += 3)
+                wanted.push_back(i);
+
+            const auto  res =
+                df.get_data_by_idx<double, int, std::string, long>(wanted);
+
+            assert(res.get_index().size() == wanted.size());
+            assert(res.get_index()[10] == 30);
+            check_rows(res);
+        }
+    }
+
+    ULDataFrame::set_permute_mem_budget(
+        std::numeric_limits<std::size_t>::max());
+    ULDataFrame::set_optimum_thread_level();
+}
+
+static void test_flat_row_table()  {
+
+    std::cout << "\nTesting flat row table ..." << std::endl;
+
+    constexpr std::size_t       item_cnt = 150'000;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<int>             ints(item_cnt);
+    StlVecType<double>          dbls(item_cnt);
+    StlVecType<long>            rows(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i % 1000;
+        ints[i] = int((i * 31) % 97);
+        dbls[i] = (i % 50 == 0) ? std::numeric_limits<double>::quiet_NaN()
+                                : double(i % 13);
+        rows[i] = long(i);
+    }
+
+    ULDataFrame df;
+
+    df.load_data(std::move(idx),
+                 std::make_pair("ints", ints),
+                 std::make_pair("dbls", dbls),
+                 std::make_pair("rows", rows));
+
+    for (const std::size_t thr_cnt : { 0, 4 })  {
+        ULDataFrame::set_thread_level(thr_cnt);
+
+        // (ints, index) repeats every 97 * 1000 rows. Keys of rows past
+        // 53,000 in the first period are not repeated.
+        //
+        const auto  first =
+            df.remove_duplicates<int, int, double, long>
+                ("ints", true, remove_dup_spec::keep_first);
+        const auto  last =
+            df.remove_duplicates<int, int, double, long>
+                ("ints", true, remove_dup_spec::keep_last);
+        const auto  none =
+            df.remove_duplicates<int, int, double, long>
+                ("ints", true, remove_dup_spec::keep_none);
+
+        assert(first.get_index().size() == 97'000);
+        assert(last.get_index().size() == 97'000);
+        assert(none.get_index().size() == 44'000);
+
+        const auto  &first_rows = first.get_column<long>("rows");
+        const auto  &last_rows = last.get_column<long>("rows");
+
+        for (std::size_t i = 1; i < first_rows.size(); ++i)  {
+            assert(first_rows[i - 1] < first_rows[i]);
+            assert(last_rows[i - 1] < last_rows[i]);
+        }
+        assert(first_rows.back() < 97'000);
+        assert(last_rows.front() == 53'000);
+
+        const auto  two_col =
+            df.remove_duplicates<int, double, int, double, long>
+                ("ints", "dbls", false, remove_dup_spec::keep_first);
+
+        // NaN never equals NaN, so every NaN row is kept
+        //
+        assert(two_col.get_index().size() == 97 * 13 + item_cnt / 50);
+
+        const auto  counts = df.value_counts<double>("dbls");
+        const auto  &cnt_col = counts.get_column<std::size_t>("counts");
+
+        assert(counts.get_index().size() == 14);
+        assert(std::isnan(counts.get_index().back()));
+        assert(cnt_col.back() == item_cnt / 50);
+
+        std::size_t total { 0 };
+
+        for (const auto cnt : cnt_col)  total += cnt;
+        assert(total == item_cnt);
+
+        const auto  mask = df.duplication_mask<int, double, long>(false);
+        const auto  &ints_mask = mask.get_column<int>("ints");
+
+        for (std::size_t i = 0; i < item_cnt; i += 997)
+            assert(std::size_t(ints_mask[i]) ==
+                   item_cnt / 97 + (i % 97 < item_cnt % 97 ? 1 : 0));
+
+        const auto  xtab = df.crosstab<int, double>("ints", "dbls");
+
+        // 0 is the nan of int, so it is left out
+        //
+        assert(xtab.get_index().size() == 96);
+        assert(xtab.get_index()[0] == 1 && xtab.get_index()[95] == 96);
+    }
+
+    ULDataFrame::set_optimum_thread_level();
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_datetime_column_conversions()  {
+
+    std::cout << "\nTesting DateTime column conversions ..." << std::endl;
+
+    constexpr std::size_t       item_cnt = 300'000;
+    StlVecType<DateTime>        dts;
+    StlVecType<std::string>     iso_strs;
+    StlVecType<std::string>     ame_strs;
+
+    dts.reserve(item_cnt);
+    iso_strs.reserve(item_cnt);
+    ame_strs.reserve(item_cnt);
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        DateTime    dt { 20200101, 0, 0, 0, 0, DT_TIME_ZONE::GMT };
+
+        // Many rows per day, so the date caching is exercised
+        //
+        dt.set_time(1577836800 + DateTime::EpochType(i * 7),
+                    DateTime::NanosecondType((i * 1234567) % 1000000000));
+        iso_strs.push_back(dt.string_format(DT_FORMAT::ISO_DT_NANO));
+        ame_strs.push_back(dt.string_format(DT_FORMAT::DT_TM2));
+        dts.push_back(dt);
+    }
+
+    const StlVecType<std::string_view>  iso_views(iso_strs.begin(),
+                                                  iso_strs.end());
+    const StlVecType<std::string_view>  ame_views(ame_strs.begin(),
+                                                  ame_strs.end());
+
+    for (const std::size_t thr_cnt : { 0, 4 })  {
+        DTDataFrame::set_thread_level(thr_cnt);
+
+        const auto  iso_parsed =
+            DTDataFrame::parse_datetime_column(iso_views,
+                                               DT_DATE_STYLE::ISO_STYLE,
+                                               DT_TIME_ZONE::GMT);
+        const auto  ame_parsed =
+            DTDataFrame::parse_datetime_column(ame_views,
+                                               DT_DATE_STYLE::AME_STYLE,
+                                               DT_TIME_ZONE::GMT);
+
+        assert(iso_parsed.size() == item_cnt);
+        assert(ame_parsed.size() == item_cnt);
+        for (std::size_t i = 0; i < item_cnt; ++i)  {
+            assert(iso_parsed[i] == dts[i]);
+            assert(ame_parsed[i].time() == dts[i].time());
+            assert(ame_parsed[i].msec() == dts[i].msec());
+        }
+
+        std::string                                     buffer;
+        DTDataFrame::StlVecType<DTDataFrame::size_type> offsets;
+
+        for (const auto format : { DT_FORMAT::ISO_DT_NANO, DT_FORMAT::DT_TM2,
+                                   DT_FORMAT::AMR_DT_TM, DT_FORMAT::DT_PRECISE,
+                                   DT_FORMAT::SCT_DT })  {
+            DTDataFrame::format_datetime_column(dts, format, buffer, offsets);
+            assert(offsets.size() == item_cnt + 1);
+            assert(offsets.back() == buffer.size());
+            for (std::size_t i = 0; i < item_cnt; i += 997)
+                assert(buffer.substr(offsets[i], offsets[i + 1] - offsets[i])
+                           == dts[i].string_format(format));
+        }
+        assert((std::string_view(buffer.data() + offsets[1],
+                                 offsets[2] - offsets[1]) == "Jan 01, 2020"));
+    }
+    DTDataFrame::set_optimum_thread_level();
+
+    DTDataFrame                         df;
+    DTDataFrame::StlVecType<double>     vals(1000, 1.5);
+
+    df.load_data(DTDataFrame::StlVecType<DateTime>(dts.begin(),
+                                                   dts.begin() + 1000),
+                 std::make_pair("vals", vals));
+
+    std::stringstream   ss;
+
+    df.write<std::ostream, double>(ss, io_format::csv2,
+                                   { .dt_format = DT_FORMAT::ISO_DT_TM });
+
+    std::string line;
+
+    std::getline(ss, line);
+    assert(line == "INDEX:1000:<DateTimeISO>,vals:1000:<double>");
+    std::getline(ss, line);
+    assert(line == dts[0].string_format(DT_FORMAT::ISO_DT_TM) + ",1.5");
+    std::getline(ss, line);
+    assert(line == dts[1].string_format(DT_FORMAT::ISO_DT_TM) + ",1.5");
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_timestamp()  {
+
+    std::cout << "\nTesting Timestamp ..." << std::endl;
+
+    static_assert(sizeof(Timestamp) == 8);
+
+    // The same instants as DateTime, but 8 bytes each
+    //
+    const auto  dt_idx =
+        DTDataFrame::gen_datetime_index("01/02/2020 09:30",
+                                        "01/02/2020 16:00",
+                                        time_frequency::secondly, 1,
+                                        DT_TIME_ZONE::GMT);
+    const auto  ts_idx =
+        TSDataFrame::gen_datetime_index("01/02/2020 09:30",
+                                        "01/02/2020 16:00",
+                                        time_frequency::secondly, 1,
+                                        DT_TIME_ZONE::GMT);
+
+    assert(dt_idx.size() == 23400);
+    assert(ts_idx.size() == dt_idx.size());
+    for (std::size_t i = 0; i < ts_idx.size(); ++i)  {
+        assert(ts_idx[i].long_time() == dt_idx[i].long_time());
+        assert(ts_idx[i].hour() == dt_idx[i].hour());
+        assert(ts_idx[i].minute() == dt_idx[i].minute());
+        assert(ts_idx[i].sec() == dt_idx[i].sec());
+        assert(ts_idx[i].to_datetime() == dt_idx[i]);
+        assert(Timestamp(dt_idx[i]) == ts_idx[i]);
+    }
+
+    const auto  daily_idx =
+        TSDataFrame::gen_datetime_index("01/30/2020", "03/02/2020",
+                                        time_frequency::daily, 1,
+                                        DT_TIME_ZONE::GMT);
+
+    assert(daily_idx.size() == 32);
+    assert(daily_idx[2].date() == 20200201);
+    assert(daily_idx[2].dweek() == DT_WEEKDAY::SAT);
+    assert(daily_idx[31].month() == DT_MONTH::MAR);
+
+    TSDataFrame                         df;
+    TSDataFrame::StlVecType<double>     prices(ts_idx.size());
+    TSDataFrame::StlVecType<Timestamp>  fills(ts_idx.size());
+
+    for (std::size_t i = 0; i < ts_idx.size(); ++i)  {
+        prices[i] = 100.0 + double(i % 97) * 0.25;
+        fills[i] = ts_idx[i];
+        fills[i].add_nanoseconds(Timestamp::LongTimeType(i) * 1000 + 7);
+    }
+    df.load_data(TSDataFrame::StlVecType<Timestamp>(ts_idx),
+                 std::make_pair("price", prices),
+                 std::make_pair("fill", fills));
+
+    // Every io_format that can be read back keeps the exact nanoseconds
+    //
+    for (const auto iof : { io_format::csv, io_format::csv2,
+                            io_format::json, io_format::binary })  {
+        std::stringstream   ss;
+        TSDataFrame         df2;
+
+        df.write<std::ostream, double, Timestamp>(ss, iof,
+                                                  { .precision = 10 });
+        df2.read(ss, iof);
+        assert(df2.get_index() == df.get_index());
+        assert(df2.get_column<Timestamp>("fill") == fills);
+        assert(df2.get_column<double>("price")[100] == prices[100]);
+    }
+
+    df.write<double, Timestamp>("./timestamp_test.mmb",
+                                io_format::mmap_binary);
+
+    TSDataFrame lazy;
+
+    lazy.read("./timestamp_test.mmb", io_format::mmap_binary,
+              { .lazy_load = true });
+    assert(lazy.get_index() == df.get_index());
+
+    const auto  fill_view = lazy.get_mapped_column<Timestamp>("fill");
+
+    assert(fill_view.size() == fills.size());
+    assert(fill_view[1234] == fills[1234]);
+
+    std::stringstream   ss;
+    std::string         line;
+
+    df.write<std::ostream, double, Timestamp>(ss, io_format::csv2,
+                                              { .max_recs = 2 });
+    std::getline(ss, line);
+    assert(line ==
+           "INDEX:2:<Timestamp>,price:2:<double>,fill:2:<Timestamp>");
+    std::getline(ss, line);
+    assert(line == "1577957400000000000,100,1577957400000000007");
+
+    const auto  between =
+        df.get_data_between_times<double, Timestamp>(10, 11);
+
+    assert(between.get_index().size() == 3599);
+    assert(between.get_index().front().hour() == 10);
+    assert(between.get_index().front().sec() == 1);
+    assert(between.get_index().back().minute() == 59);
+
+    const auto  view =
+        df.get_view_at_times<double, Timestamp>(12, 15, 30);
+
+    assert(view.get_index().size() == 1);
+    assert(view.get_index()[0].minute() == 15);
+    assert(view.get_column<double>("price")[0] ==
+           prices[(2 * 60 + 45) * 60 + 30]);
+
+    const auto  bars =
+        df.resample(time_frequency::minutely, 5,
+                    LastVisitor<Timestamp, Timestamp>(),
+                    std::make_tuple("price", "high", MaxVisitor<double,
+                                                                Timestamp>()),
+                    std::make_tuple("price", "close",
+                                    LastVisitor<double, Timestamp>()));
+    const auto  &bar_idx = bars.get_index();
+
+    assert(bar_idx.size() == 77);  // The last partial bar is dropped
+    assert(bar_idx[0].hour() == 9 && bar_idx[0].minute() == 34);
+    assert(bar_idx[0].sec() == 59);
+    assert(bars.get_column<double>("close")[0] == prices[299]);
+
+    TSDataFrame quotes;
+
+    quotes.load_index(TSDataFrame::StlVecType<Timestamp> {
+        Timestamp(1577957400, 500000000), Timestamp(1577957402, 0) });
+    quotes.load_column<double>("quote", { 1.0, 2.0 });
+
+    const auto  joined =
+        df.asof_join<TSDataFrame, double, Timestamp>(
+            quotes, asof_policy::backward,
+            Timestamp(Timestamp::LongTimeType(1'500'000'000)));
+    const auto  &quote = joined.get_column<double>("quote");
+
+    assert(std::isnan(quote[0]));
+    assert(quote[1] == 1.0);
+    assert(quote[2] == 2.0);
+    assert(quote[3] == 2.0);
+    assert(std::isnan(quote[4]));  // More than 1.5 seconds away
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_neighbor_index()  {
+
+    std::cout << "\nTesting neighbor index ..." << std::endl;
+
+    using point_t = std::array<double, 2>;
+
+    constexpr std::size_t   item_cnt = 3000;
+    RandGenParams<double>   p;
+
+    p.seed = 17;
+    p.min_value = -50.0;
+    p.max_value = 50.0;
+
+    const auto  rand_vec = gen_uniform_real_dist<double>(item_cnt * 3, p);
+    std::vector<double>     scalars(item_cnt);
+    std::vector<point_t>    points(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        // Repeated values make ties
+        //
+        scalars[i] = std::round(rand_vec[i] * 10.0) / 10.0;
+        points[i] = { rand_vec[item_cnt + i], rand_vec[item_cnt * 2 + i] };
+    }
+
+    // Two outliers for LOF
+    //
+    points[100] = { 400.0, 20.0 };
+    points[2000] = { -10.0, -300.0 };
+
+    auto    euclid =
+        [](const point_t &x, const point_t &y) -> double  {
+            const double    d0 { x[0] - y[0] };
+            const double    d1 { x[1] - y[1] };
+
+            return (std::sqrt(d0 * d0 + d1 * d1));
+        };
+
+    // Too many dimensions for the grid, so LOF goes through a KD-tree
+    //
+    using point6_t = std::array<double, 6>;
+
+    std::vector<point6_t>   points6(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        const auto  &[x, y] = points[i];
+
+        points6[i] = { x, y, y - x, 0.5 * x, scalars[i] / 10.0, 1.0 };
+    }
+
+    auto    euclid6 =
+        [](const point6_t &x, const point6_t &y) -> double  {
+            double  sum { 0 };
+
+            for (std::size_t i = 0; i < 6; ++i)
+                sum += (x[i] - y[i]) * (x[i] - y[i]);
+            return (std::sqrt(sum));
+        };
+
+    // The indices against brute force
+    //
+    {
+        SortedNeighborIndex<double>     sidx;
+        GridNeighborIndex<point_t>      gidx;
+        std::vector<std::size_t>        hits;
+        std::vector<std::pair<double, std::size_t>> knn;
+
+        sidx.build(scalars.begin(), item_cnt);
+        gidx.build(points.begin(), item_cnt, 3.0);
+        for (std::size_t q = 0; q < item_cnt; q += 7)  {
+            std::vector<std::size_t>                    bf_hits;
+            std::vector<std::pair<double, std::size_t>> bf_knn;
+
+            for (std::size_t i = 0; i < item_cnt; ++i)  {
+                if (std::fabs(scalars[i] - scalars[q]) <= 0.5)
+                    bf_hits.push_back(i);
+                bf_knn.emplace_back(std::fabs(scalars[i] - scalars[q]), i);
+            }
+            std::sort(bf_knn.begin(), bf_knn.end());
+            bf_knn.resize(12);
+            sidx.within(scalars[q], 0.5, hits);
+            assert(hits == bf_hits);
+            sidx.k_nearest(scalars[q], 12, knn);
+            assert(knn == bf_knn);
+
+            bf_hits.clear();
+            bf_knn.clear();
+            for (std::size_t i = 0; i < item_cnt; ++i)  {
+                const double    dist { euclid(points[i], points[q]) };
+
+                if (dist <= 3.0)  bf_hits.push_back(i);
+                bf_knn.emplace_back(dist, i);
+            }
+            std::sort(bf_knn.begin(), bf_knn.end());
+            bf_knn.resize(12);
+            gidx.within(points[q], 3.0, hits);
+            assert(hits == bf_hits);
+            gidx.k_nearest(points[q], 12, knn);
+            assert(knn.size() == 12);
+            for (std::size_t i = 0; i < 12; ++i)  {
+                assert(knn[i].second == bf_knn[i].second);
+                assert(std::fabs(knn[i].first - bf_knn[i].first) < 1e-12);
+            }
+        }
+    }
+
+    // With the default distance the visitors use an index. Setting the
+    // same distance explicitly makes them scan the column. Both must agree.
+    //
+    ULDataFrame df;
+
+    df.load_index(ULDataFrame::gen_sequence_index(0, item_cnt, 1));
+    df.load_column("scalars", std::move(scalars));
+    df.load_column("points", std::move(points));
+    df.load_column("points6", std::move(points6));
+
+    for (const std::size_t thr_cnt : { 0, 4 })  {
+        ULDataFrame::set_thread_level(thr_cnt);
+
+        DBSCANVisitor<double>   dbscan(5, 0.01);
+        DBSCANVisitor<double>   dbscan_bf(5, 0.01);
+        DBSCANVisitor<point_t>  md_dbscan(5, 2.0);
+        DBSCANVisitor<point_t>  md_dbscan_bf(5, 2.0);
+
+        dbscan_bf.set_dist_func([](const double &x, const double &y)  {
+                                    return ((x - y) * (x - y));
+                                });
+        md_dbscan_bf.set_dist_func(euclid);
+        df.single_act_visit<double>("scalars", dbscan);
+        df.single_act_visit<double>("scalars", dbscan_bf);
+        df.single_act_visit<point_t>("points", md_dbscan);
+        df.single_act_visit<point_t>("points", md_dbscan_bf);
+        assert(dbscan.get_clusters_idxs() == dbscan_bf.get_clusters_idxs());
+        assert(dbscan.get_noisey_idxs() == dbscan_bf.get_noisey_idxs());
+        assert(md_dbscan.get_clusters_idxs().size() > 10);
+        assert(md_dbscan.get_clusters_idxs() ==
+                   md_dbscan_bf.get_clusters_idxs());
+        assert(md_dbscan.get_noisey_idxs() == md_dbscan_bf.get_noisey_idxs());
+
+        MeanShiftVisitor<point_t>   mshift(1.0, 2.0);
+        MeanShiftVisitor<point_t>   mshift_bf(1.0, 2.0);
+
+        mshift_bf.set_dist_func(euclid);
+        df.single_act_visit<point_t>("points", mshift);
+        df.single_act_visit<point_t>("points", mshift_bf);
+        assert(mshift.get_clusters_idxs().size() > 10);
+        assert(mshift.get_clusters_idxs() == mshift_bf.get_clusters_idxs());
+
+        and_lof_v<point_t>  lof { 10, 3.0 };
+        and_lof_v<point_t>  lof_bf { 10, 3.0, normalization_type::none,
+                                     euclid };
+
+        df.single_act_visit<point_t>("points", lof);
+        df.single_act_visit<point_t>("points", lof_bf);
+        assert(lof.get_result().size() == 2);
+        assert(lof.get_result()[0] == 100);
+        assert(lof.get_result()[1] == 2000);
+        assert(lof.get_result() == lof_bf.get_result());
+
+        and_lof_v<point6_t> lof6 { 10, 3.0 };
+        and_lof_v<point6_t> lof6_bf { 10, 3.0, normalization_type::none,
+                                      euclid6 };
+
+        df.single_act_visit<point6_t>("points6", lof6);
+        df.single_act_visit<point6_t>("points6", lof6_bf);
+        assert(lof6.get_result().size() >= 2);
+        assert(lof6.get_result() == lof6_bf.get_result());
+    }
+    ULDataFrame::set_thread_level(0);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_obo_port_visit()  {
+
+    std::cout << "\nTesting visit() with buffering visitors ..." << std::endl;
+
+    static_assert(obo_port_visitor<MedianVisitor<double>>);
+    static_assert(obo_port_visitor<ModeVisitor<3, double>>);
+    static_assert(! obo_port_visitor<MeanVisitor<double>>);
+
+    constexpr std::size_t   item_cnt = 1001;
+    RandGenParams<double>   p;
+
+    p.seed = 23;
+    p.min_value = -10.0;
+    p.max_value = 10.0;
+
+    ULDataFrame df;
+    auto        rand_vec = gen_uniform_real_dist<double>(item_cnt, p);
+
+    for (auto &val : rand_vec)  val = std::round(val);
+    df.load_index(ULDataFrame::gen_sequence_index(0, item_cnt, 1));
+    df.load_column("col", rand_vec);
+
+    // The column is given to the visitors directly. Results must be the
+    // same as feeding them one by one.
+    //
+    for (const bool in_reverse : { false, true })  {
+        MedianVisitor<double>       med;
+        MedianVisitor<double>       med_obo;
+        QuantileVisitor<double>     qt { 0.75 };
+        QuantileVisitor<double>     qt_obo { 0.75 };
+        ModeVisitor<3, double>      mode;
+        ModeVisitor<3, double>      mode_obo;
+        ZScoreVisitor<double>       zs;
+        ZScoreVisitor<double>       zs_obo;
+        const auto                  &idx = df.get_index();
+
+        df.visit<double>("col", med, in_reverse);
+        df.visit_async<double>("col", qt, in_reverse).get();
+        df.visit<double>("col", mode, in_reverse);
+        df.visit<double>("col", zs, in_reverse);
+
+        med_obo.pre();
+        qt_obo.pre();
+        mode_obo.pre();
+        zs_obo.pre();
+        for (std::size_t i = 0; i < item_cnt; ++i)  {
+            const std::size_t   j = in_reverse ? item_cnt - 1 - i : i;
+
+            med_obo(idx[j], rand_vec[j]);
+            qt_obo(idx[j], rand_vec[j]);
+            mode_obo(idx[j], rand_vec[j]);
+            zs_obo(idx[j], rand_vec[j]);
+        }
+        med_obo.post();
+        qt_obo.post();
+        mode_obo.post();
+        zs_obo.post();
+
+        assert(med.get_result() == med_obo.get_result());
+        assert(qt.get_result() == qt_obo.get_result());
+        assert(zs.get_result() == zs_obo.get_result());
+        for (std::size_t i = 0; i < 3; ++i)  {
+            assert(mode.get_result()[i].get_value() ==
+                       mode_obo.get_result()[i].get_value());
+            assert(mode.get_result()[i].value_indices_in_col ==
+                       mode_obo.get_result()[i].value_indices_in_col);
+        }
+    }
+
+    // A short column is still padded with NaN's
+    //
+    df.load_column("short col", std::vector<double> { 3, 1, 2 },
+                   nan_policy::dont_pad_with_nans);
+
+    MedianVisitor<double>   med { true };
+
+    df.visit<double>("short col", med);
+    assert(med.get_result() == 2.0);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_fused_multi_visit()  {
+
+    std::cout << "\nTesting fused multi_visit() ..." << std::endl;
+
+    // Long enough for several blocks and for running columns in parallel
+    //
+    constexpr std::size_t   item_cnt = 300001;
+    RandGenParams<double>   p;
+
+    p.seed = 29;
+    p.mean = 1.0;
+    p.std = 0.5;
+
+    ULDataFrame df;
+
+    df.load_index(ULDataFrame::gen_sequence_index(0, item_cnt, 1));
+    df.load_column("col1", gen_normal_dist<double>(item_cnt, p));
+    p.seed = 31;
+    df.load_column("col2", gen_lognormal_dist<double>(item_cnt, p));
+    p.seed = 37;
+    df.load_column("short col", gen_normal_dist<double>(10000, p),
+                   nan_policy::dont_pad_with_nans);
+
+    for (const std::size_t thr_cnt : { 0, 4 })  {
+        ULDataFrame::set_thread_level(thr_cnt);
+
+        MeanVisitor<double>     mean1, mean2, mean_s { true };
+        VarVisitor<double>      var1, var2;
+        MinVisitor<double>      min1;
+        MaxVisitor<double>      max2;
+        SkewVisitor<double>     skew1;
+        KurtosisVisitor<double> kurt2;
+        MedianVisitor<double>   med1;
+        MeanVisitor<double>     mean1_s, mean2_s, mean_s_s { true };
+        VarVisitor<double>      var1_s, var2_s;
+        MinVisitor<double>      min1_s;
+        MaxVisitor<double>      max2_s;
+        SkewVisitor<double>     skew1_s;
+        KurtosisVisitor<double> kurt2_s;
+        MedianVisitor<double>   med1_s;
+
+        df.multi_visit(std::make_pair("col1", &mean1),
+                       std::make_pair("col2", &mean2),
+                       std::make_pair("col1", &var1),
+                       std::make_pair("col2", &var2),
+                       std::make_pair("col1", &min1),
+                       std::make_pair("col2", &max2),
+                       std::make_pair("short col", &mean_s),
+                       std::make_pair("col1", &skew1),
+                       std::make_pair("col2", &kurt2),
+                       std::make_pair("col1", &med1));
+
+        df.visit<double>("col1", mean1_s);
+        df.visit<double>("col2", mean2_s);
+        df.visit<double>("col1", var1_s);
+        df.visit<double>("col2", var2_s);
+        df.visit<double>("col1", min1_s);
+        df.visit<double>("col2", max2_s);
+        df.visit<double>("short col", mean_s_s);
+        df.visit<double>("col1", skew1_s);
+        df.visit<double>("col2", kurt2_s);
+        df.visit<double>("col1", med1_s);
+
+        // Every visitor sees the same values in the same order as visit()
+        //
+        assert(mean1.get_result() == mean1_s.get_result());
+        assert(mean2.get_result() == mean2_s.get_result());
+        assert(var1.get_result() == var1_s.get_result());
+        assert(var2.get_result() == var2_s.get_result());
+        assert(min1.get_result() == min1_s.get_result());
+        assert(max2.get_result() == max2_s.get_result());
+        assert(mean_s.get_result() == mean_s_s.get_result());
+        assert(mean_s.get_count() == 10000);
+        assert(skew1.get_result() == skew1_s.get_result());
+        assert(kurt2.get_result() == kurt2_s.get_result());
+        assert(med1.get_result() == med1_s.get_result());
+        assert(std::fabs(mean1.get_result() - 1.0) < 0.01);
+    }
+    ULDataFrame::set_thread_level(0);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_reduce_visit()  {
+
+    std::cout << "\nTesting visit() with reduce visitors ..." << std::endl;
+
+    // Long enough for several chunks, the last one partial
+    //
+    constexpr std::size_t   item_cnt = 1000003;
+    RandGenParams<double>   p;
+
+    p.seed = 41;
+    p.mean = 2.0;
+    p.std = 1.5;
+
+    ULDataFrame         df;
+    auto                col1 = gen_normal_dist<double>(item_cnt, p);
+    std::vector<double> col3 = col1;
+
+    for (std::size_t i = 0; i < item_cnt; i += 1000)
+        col3[i] = std::numeric_limits<double>::quiet_NaN();
+    p.seed = 43;
+    df.load_index(ULDataFrame::gen_sequence_index(0, item_cnt, 1));
+    df.load_column("col1", std::move(col1));
+    df.load_column("col2", gen_lognormal_dist<double>(item_cnt, p));
+    df.load_column("col3", std::move(col3));
+
+    struct  Results  {
+        double      sum, mean, nan_mean, var, cov, corr;
+        double      max, min, s_max, mean_s, var_s, skew, kurt;
+        std::size_t count, max_pos, min_idx, s_max_pos, stats_cnt;
+    };
+
+    const auto  run = [&df]() -> Results  {
+        SumVisitor<double>      sum;
+        MeanVisitor<double>     mean, nan_mean { true };
+        VarVisitor<double>      var;
+        CovVisitor<double>      cov;
+        CorrVisitor<double>     corr;
+        MaxVisitor<double>      max, s_max;
+        MinVisitor<double>      min;
+        CountVisitor<double>    count;
+        StatsVisitor<double>    stats;
+
+        df.visit<double>("col1", sum);
+        df.visit<double>("col1", mean);
+        df.visit<double>("col3", nan_mean);
+        df.visit<double>("col2", var);
+        df.visit<double, double>("col1", "col2", cov);
+        df.single_act_visit<double, double>("col1", "col2", corr);
+        df.visit<double>("col2", max);
+        df.visit<double>("col1", min);
+        df.single_act_visit<double>("col2", s_max);
+        df.single_act_visit<double>("col3", count);
+        df.visit<double>("col2", stats);
+
+        return (Results { sum.get_result(), mean.get_result(),
+                          nan_mean.get_result(), var.get_result(),
+                          cov.get_result(), corr.get_result(),
+                          max.get_result(), min.get_result(),
+                          s_max.get_result(), stats.get_mean(),
+                          stats.get_variance(), stats.get_skew(),
+                          stats.get_kurtosis(), count.get_result(),
+                          max.get_position(), min.get_index(),
+                          s_max.get_position(), stats.get_count() });
+    };
+    const auto  close = [](double x, double y) -> bool  {
+        return (std::fabs(x - y) <= 1e-9 * std::max(1.0, std::fabs(y)));
+    };
+
+    ULDataFrame::set_thread_level(0);
+
+    const Results   serial = run();
+
+    ULDataFrame::set_thread_level(4);
+
+    const Results   par4 = run();
+
+    ULDataFrame::set_thread_level(3);
+
+    const Results   par3 = run();
+
+    ULDataFrame::set_thread_level(0);
+
+    // Chunked results agree with one pass
+    //
+    assert(close(par4.sum, serial.sum));
+    assert(close(par4.mean, serial.mean));
+    assert(close(par4.nan_mean, serial.nan_mean));
+    assert(close(par4.var, serial.var));
+    assert(close(par4.cov, serial.cov));
+    assert(close(par4.corr, serial.corr));
+    assert(close(par4.mean_s, serial.mean_s));
+    assert(close(par4.var_s, serial.var_s));
+    assert(close(par4.skew, serial.skew));
+    assert(close(par4.kurt, serial.kurt));
+    assert(close(par4.var_s, par4.var));
+    assert(par4.max == serial.max);
+    assert(par4.min == serial.min);
+    assert(par4.s_max == serial.max);
+    assert(par4.max_pos == serial.max_pos);
+    assert(par4.min_idx == serial.min_idx);
+    assert(par4.s_max_pos == serial.s_max_pos);
+    assert(par4.count == item_cnt);
+    assert(par4.stats_cnt == item_cnt);
+
+    // The chunks don't depend on the number of threads
+    //
+    assert(par3.sum == par4.sum);
+    assert(par3.mean == par4.mean);
+    assert(par3.nan_mean == par4.nan_mean);
+    assert(par3.var == par4.var);
+    assert(par3.cov == par4.cov);
+    assert(par3.corr == par4.corr);
+    assert(par3.skew == par4.skew);
+    assert(par3.kurt == par4.kurt);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_lazy_expressions()  {
+
+    std::cout << "\nTesting lazy expressions ..." << std::endl;
+
+    ULDataFrame df1;
+    ULDataFrame df2;
+
+    df1.load_data(ULDataFrame::gen_sequence_index(0, 10, 1),
+                  std::make_pair("x", StlVecType<double> {
+                      0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }),
+                  std::make_pair("y", StlVecType<double> {
+                      1, 1, 1, 1, 1, 1, 1, 1, 1, 1 }),
+                  std::make_pair("i", StlVecType<long> {
+                      1, 2, 3, 4, 5, 6, 7, 8, 9, 10 }));
+    df1.load_column("short", StlVecType<double> { 5, 5, 5 },
+                    nan_policy::dont_pad_with_nans);
+
+    // Index is 3, 5, 7, ..., 17
+    //
+    df2.load_data(ULDataFrame::gen_sequence_index(3, 19, 2),
+                  std::make_pair("x", StlVecType<double> {
+                      10, 20, 30, 40, 50, 60, 70, 80 }),
+                  std::make_pair("i", StlVecType<long> {
+                      1, 1, 1, 1, 1, 1, 1, 1 }));
+
+    const auto  x = col_expr<double>(df1, "x");
+
+    df1.load_column("z", (x + col_expr<double>(df1, "y")) * 2.0 - 1.0);
+    df1.load_column("w", expr_where((x > 4.0) & ! (x == 7.0), x, -x));
+    df1.load_column("flag", x >= 5.0);
+    df1.load_column("s", x + col_expr<double>(df1, "short"),
+                    nan_policy::dont_pad_with_nans);
+
+    const auto  &z = df1.get_column<double>("z");
+    const auto  &w = df1.get_column<double>("w");
+    const auto  &flag = df1.get_column<bool>("flag");
+
+    for (std::size_t i = 0; i < 10; ++i)  {
+        const double    val = double(i);
+
+        assert(z[i] == (val + 1.0) * 2.0 - 1.0);
+        assert(w[i] == ((val > 4.0 && val != 7.0) ? val : -val));
+        assert(flag[i] == (val >= 5.0));
+    }
+    assert((df1.get_column<double>("s") == StlVecType<double> { 5, 6, 7 }));
+
+    // Columns of different DataFrames are aligned by index
+    //
+    df1.load_column("xx", x + col_expr<double>(df2, "x"));
+
+    const auto  &xx = df1.get_column<double>("xx");
+
+    assert(xx.size() == 10);
+    assert(std::isnan(xx[0]) && std::isnan(xx[4]) && std::isnan(xx[8]));
+    assert(xx[3] == 13.0 && xx[5] == 25.0 && xx[7] == 37.0 && xx[9] == 49.0);
+
+    const auto  prod = eval_expr(x * col_expr<double>(df2, "x"), "prod");
+
+    assert((prod.get_index() == StlVecType<unsigned long> { 3, 5, 7, 9 }));
+    assert((prod.get_column<double>("prod") ==
+            StlVecType<double> { 30, 100, 210, 360 }));
+
+    // Frame expressions agree with the eager operators
+    //
+    const auto  lazy =
+        eval_df_expr<ULDataFrame, double, long>(
+            (df_expr(df1) + df_expr(df2)) * 2 - df_expr(df2));
+    const auto  eager =
+        df_minus<ULDataFrame, double, long>(
+            scaler_df_multiplies<ULDataFrame, int, double, long>(
+                df_plus<ULDataFrame, double, long>(df1, df2), 2),
+            df2);
+
+    assert(lazy.get_index() == eager.get_index());
+    assert(lazy.get_column<double>("x") == eager.get_column<double>("x"));
+    assert(lazy.get_column<long>("i") == eager.get_column<long>("i"));
+    assert(! lazy.has_column("y"));
+
+    // Long expressions run in parallel
+    //
+    constexpr std::size_t   item_cnt = 300001;
+    RandGenParams<double>   p;
+    ULDataFrame             df3;
+
+    p.seed = 47;
+    df3.load_index(ULDataFrame::gen_sequence_index(0, item_cnt, 1));
+    df3.load_column("a", gen_normal_dist<double>(item_cnt, p));
+    p.seed = 53;
+    df3.load_column("b", gen_normal_dist<double>(item_cnt, p));
+
+    const auto  &a = df3.get_column<double>("a");
+    const auto  &b = df3.get_column<double>("b");
+
+    for (const std::size_t thr_cnt : { 0, 4 })  {
+        ULDataFrame::set_thread_level(thr_cnt);
+        const auto  a_expr = col_expr<double>(df3, "a");
+
+        df3.load_column("c",
+                        a_expr * col_expr<double>(df3, "b") - a_expr / 2.0);
+
+        const auto  &c = df3.get_column<double>("c");
+
+        for (std::size_t i = 0; i < item_cnt; ++i)
+            assert(c[i] == a[i] * b[i] - a[i] / 2.0);
+    }
+    ULDataFrame::set_thread_level(0);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_chunked_text_write()  {
+
+    std::cout << "\nTesting chunked text write ..." << std::endl;
+
+    ULDataFrame df;
+
+    df.load_data(ULDataFrame::gen_sequence_index(1, 4, 1),
+                 std::make_pair("dbl", StlVecType<double> {
+                     1.5, 2.0 / 3.0, std::numeric_limits<double>::quiet_NaN()
+                 }),
+                 std::make_pair("str", StlVecType<std::string> {
+                     "a", "bb", "ccc" }),
+                 std::make_pair("chr", StlVecType<char> { 'x', '\1', 'z' }));
+    df.load_column("int", StlVecType<int> { -7, 8 },
+                   nan_policy::dont_pad_with_nans);
+
+    std::stringstream   csv2;
+    std::stringstream   json;
+
+    df.write<std::ostream, double, int, char, std::string>(
+        csv2, io_format::csv2, { .precision = 4, .chunk_rows = 2 });
+    assert(csv2.str() ==
+           "INDEX:3:<ulong>,dbl:3:<double>,str:3:<string>,chr:3:<char>,"
+           "int:2:<int>\n"
+           "1,1.5,a,x,-7\n"
+           "2,0.6667,bb,1,8\n"
+           "3,nan,ccc,z,\n");
+    df.write<std::ostream, double, int, char, std::string>(
+        json, io_format::json, { .precision = 4, .chunk_rows = 1 });
+    assert(json.str() ==
+           "{\n"
+           "\"INDEX\":{\"N\":3,\"T\":\"ulong\",\"D\":[1,2,3]},\n"
+           "\"dbl\":{\"N\":3,\"T\":\"double\",\"D\":[1.5,0.6667,nan]},\n"
+           "\"str\":{\"N\":3,\"T\":\"string\","
+           "\"D\":[\"a\",\"bb\",\"ccc\"]},\n"
+           "\"chr\":{\"N\":3,\"T\":\"char\",\"D\":[x,1,z]},\n"
+           "\"int\":{\"N\":2,\"T\":\"int\",\"D\":[-7,8]}\n"
+           "}");
+
+    // Stream formatting flags are still honored
+    //
+    std::stringstream   fixed;
+
+    fixed << std::fixed;
+    df.write<std::ostream, double, int, char, std::string>(
+        fixed, io_format::csv2,
+        { .precision = 2, .columns_only = true, .max_recs = 2 });
+    assert(fixed.str() ==
+           "dbl:2:<double>,str:2:<string>,chr:2:<char>,int:2:<int>\n"
+           "1.50,a,x,-7\n"
+           "0.67,bb,1,8\n");
+
+    // Output is the same regardless of chunk size and number of threads
+    //
+    constexpr std::size_t   item_cnt = 300007;
+    ULDataFrame             df2;
+    RandGenParams<double>   p;
+
+    p.seed = 17;
+    df2.load_data(ULDataFrame::gen_sequence_index(0, item_cnt, 1),
+                  std::make_pair("a", gen_normal_dist<double>(item_cnt, p)));
+    df2.load_column("dt",
+                    ULDataFrame::gen_datetime_index(
+                        "01/01/2020", "06/01/2020",
+                        time_frequency::hourly, 1, DT_TIME_ZONE::GMT),
+                    nan_policy::dont_pad_with_nans);
+
+    std::string csv2_ref;
+    std::string json_ref;
+
+    ULDataFrame::set_thread_level(4);
+    for (const long thr_cnt : { 1, 0, 3 })  {
+        for (const long chunk_rows : { 0L, 1000L, 1L << 14 })  {
+            std::stringstream   ss1;
+            std::stringstream   ss2;
+
+            df2.write<std::ostream, double, DateTime>(
+                ss1, io_format::csv2,
+                { .dt_format = DT_FORMAT::ISO_DT_TM,
+                  .chunk_rows = chunk_rows, .threads = thr_cnt });
+            df2.write<std::ostream, double, DateTime>(
+                ss2, io_format::json,
+                { .chunk_rows = chunk_rows, .threads = thr_cnt });
+            if (csv2_ref.empty())  {
+                csv2_ref = ss1.str();
+                json_ref = ss2.str();
+            }
+            else  {
+                assert(ss1.str() == csv2_ref);
+                assert(ss2.str() == json_ref);
+            }
+        }
+    }
+    ULDataFrame::set_thread_level(0);
+
+    ULDataFrame         df3;
+    std::stringstream   in (csv2_ref);
+
+    df3.read(in, io_format::csv2);
+    assert(df3.get_index().size() == item_cnt);
+    assert(std::fabs(df3.get_column<double>("a")[1000] -
+                     df2.get_column<double>("a")[1000]) < 1e-9);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_philox_rand_gen()  {
+
+    std::cout << "\nTesting Philox random generation ..." << std::endl;
+
+    // Known answers from the Philox reference implementation
+    //
+    const auto  zeros = PhiloxEngine::block(0, 0, 0);
+    const auto  pi = PhiloxEngine::block(0x85a308d3243f6a88ULL,
+                                         0x0370734413198a2eULL,
+                                         0x299f31d0a4093822ULL);
+
+    assert(zeros[0] == 0xe169c58d6627e8d5ULL);
+    assert(zeros[1] == 0x9b00dbd8bc57ac4cULL);
+    assert(pi[0] == 0x94fdccebd16cfe09ULL);
+    assert(pi[1] == 0x24126ea15001e420ULL);
+
+    PhiloxEngine    gen1 (11, 2);
+    PhiloxEngine    gen2 (11, 2);
+    std::uint64_t   buf[9];
+
+    gen1.discard(3);
+    gen2();
+    gen2.discard(2);
+    gen2.generate(buf, 9);
+    for (const auto val : buf)
+        assert(gen1() == val);
+
+    // Same numbers regardless of thread level
+    //
+    constexpr std::size_t   item_cnt = 1000003;
+    RandGenParams<double>   p { .seed = 23, .engine = rand_engine::philox };
+    RandGenParams<int>      ip { .seed = 23, .engine = rand_engine::philox,
+                                 .mean = 4 };
+
+    ULDataFrame::set_thread_level(0);
+
+    const auto  normal0 = gen_normal_dist<double>(item_cnt, p);
+    const auto  expo0 = gen_exponential_dist<double>(item_cnt, p);
+    const auto  poisson0 = gen_poisson_dist<int>(item_cnt, ip);
+
+    ULDataFrame::set_thread_level(4);
+    assert((gen_normal_dist<double>(item_cnt, p) == normal0));
+    assert((gen_exponential_dist<double>(item_cnt, p) == expo0));
+    assert((gen_poisson_dist<int>(item_cnt, ip) == poisson0));
+    ULDataFrame::set_thread_level(0);
+
+    double  mean { 0 };
+    double  var { 0 };
+
+    for (const auto val : normal0)  mean += val;
+    mean /= double(item_cnt);
+    for (const auto val : normal0)  var += (val - mean) * (val - mean);
+    var /= double(item_cnt - 1);
+    assert(std::fabs(mean) < 0.005);
+    assert(std::fabs(var - 1.0) < 0.005);
+
+    mean = 0;
+    for (const auto val : expo0)  {
+        assert(val >= 0 && std::isfinite(val));
+        mean += val;
+    }
+    assert(std::fabs(mean / double(item_cnt) - 1.0) < 0.005);
+
+    const auto  uni = gen_uniform_real_dist<float>(
+        100000, { .min_value = -2, .max_value = 3, .seed = 5,
+                  .engine = rand_engine::philox });
+
+    for (const auto val : uni)
+        assert(val >= -2.0f && val < 3.0f);
+
+    // A different seed gives different numbers
+    //
+    p.seed = 24;
+    assert(gen_normal_dist<double>(16, p)[0] != normal0[0]);
+}
+
+// -----------------------------------------------------------------------------
+
 int main(int, char *[])  {
 
     ULDataFrame::set_optimum_thread_level();
@@ -6427,6 +8501,26 @@ int main(int, char *[])  {
     test_JacobianVisitor();
     test_LaplacianVisitor();
     test_remove_data_by_isof();
+    test_read_csv2_chunked();
+    test_read_csv2_typed_fields();
+    test_mmap_binary();
+    test_hash_groupby();
+    test_hash_join();
+    test_incremental_roll();
+    test_rolling_order_stats();
+    test_parallel_sel();
+    test_radix_sort();
+    test_permute_columns();
+    test_flat_row_table();
+    test_datetime_column_conversions();
+    test_timestamp();
+    test_neighbor_index();
+    test_obo_port_visit();
+    test_fused_multi_visit();
+    test_reduce_visit();
+    test_lazy_expressions();
+    test_chunked_text_write();
+    test_philox_rand_gen();
 
     return (0);
 }
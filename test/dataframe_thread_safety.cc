@@ -1,7 +1,11 @@
 #include <DataFrame/DataFrame.h>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <iostream>
+#include <numeric>
+#include <random>
 #include <string>
 
 using namespace hmdf;
@@ -45,9 +49,186 @@ static void test_thread_safety()  {
 
 // ----------------------------------------------------------------------------
 
+static long nested_sum(ThreadPool &pool, long begin, long end)  {
+
+    if (end - begin < 1000)  {
+        long    sum = 0;
+
+        for (long i = begin; i < end; ++i)  sum += i;
+        return (sum);
+    }
+
+    const long  mid = begin + (end - begin) / 2;
+    auto        fut =
+        pool.dispatch(false, nested_sum, std::ref(pool), begin, mid);
+    const long  right = nested_sum(pool, mid, end);
+
+    while (fut.wait_for(std::chrono::seconds(0)) ==
+               std::future_status::timeout)
+        pool.run_task();
+    return (fut.get() + right);
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_work_stealing_pool()  {
+
+    std::cout << "Testing work stealing ThreadPool ..." << std::endl;
+
+    ThreadPool  pool (4, ThreadPool::sched_policy::work_stealing);
+
+    assert(pool.get_sched_policy() == ThreadPool::sched_policy::work_stealing);
+
+    std::vector<double>                 data (1000000);
+    std::mt19937                        gen { 7 };
+    std::uniform_real_distribution<>    dist { };
+
+    for (auto &val : data)  val = dist(gen);
+    pool.parallel_sort(data.begin(), data.end());
+    assert(std::is_sorted(data.begin(), data.end()));
+
+    auto    futs =
+        pool.parallel_loop<long>(0L, 1000000L,
+                                 [](long begin, long end) -> long  {
+                                     long   sum = 0;
+
+                                     for (long i = begin; i < end; ++i)
+                                         sum += i;
+                                     return (sum);
+                                 });
+    long    sum = 0;
+
+    for (auto &fut : futs)  sum += fut.get();
+    assert(sum == 499999500000L);
+
+    assert(nested_sum(pool, 0, 1000000) == 499999500000L);
+
+    // Shrink and grow the pool while it is work stealing
+    //
+    pool.add_thread(-2);
+    pool.add_thread(3);
+    assert(nested_sum(pool, 0, 500000) == 124999750000L);
+
+    try  {
+        pool.set_sched_policy(ThreadPool::sched_policy::shared_queue);
+        assert(false);
+    }
+    catch (const std::runtime_error &)  {   }
+
+    // Large callables don't fit in the task's in-place buffer
+    //
+    std::array<long, 32>    big { };
+
+    big[31] = 42;
+    assert((pool.dispatch(false, [big]() -> long { return (big[31]); })
+                .get() == 42));
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_timezone_conversions()  {
+
+    std::cout << "Testing time zone conversions in threads ..." << std::endl;
+
+    constexpr std::size_t       item_cnt = 20000;
+    constexpr std::array        zones {
+        DT_TIME_ZONE::AM_NEW_YORK, DT_TIME_ZONE::EU_LONDON,
+        DT_TIME_ZONE::AS_TEHRAN, DT_TIME_ZONE::AU_SYDNEY,
+        DT_TIME_ZONE::UTC, DT_TIME_ZONE::LOCAL
+    };
+    std::vector<DateTime::EpochType>    times (item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)
+        times[i] = DateTime::EpochType(i) * 86413 - 400000000;
+
+    // Break each time down and make it back, in one thread and then in many
+    //
+    using result_t = std::vector<std::pair<DateTime::DateType,
+                                           DateTime::EpochType>>;
+
+    auto    convert =
+        [&times](DT_TIME_ZONE tz) -> result_t  {
+            result_t    result;
+
+            result.reserve(times.size());
+            for (const auto t : times)  {
+                DateTime    dt (tz);
+
+                dt.set_time(t);
+
+                const DateTime  back (dt.date(), dt.hour(), dt.minute(),
+                                      dt.sec(), 0, tz);
+
+                result.emplace_back(dt.date(), back.time());
+            }
+            return (result);
+        };
+
+    std::vector<result_t>   expected;
+
+    for (const auto tz : zones)  expected.push_back(convert(tz));
+
+    std::vector<std::thread>    thr_vec;
+
+    for (std::size_t z = 0; z < zones.size(); ++z)
+        thr_vec.emplace_back([&convert, &expected, &zones, z]() -> void  {
+            assert(convert(zones[z]) == expected[z]);
+        });
+    for (auto &thr : thr_vec)  thr.join();
+
+    // New York is 5 hours behind London in January
+    //
+    const DateTime  nyc (20240115, 12, 0, 0, 0, DT_TIME_ZONE::AM_NEW_YORK);
+    const DateTime  lon (20240115, 17, 0, 0, 0, DT_TIME_ZONE::EU_LONDON);
+
+    assert(nyc.time() == lon.time());
+
+    // Fixed length steps are generated in parallel for big indices
+    //
+    struct  IndexSpec  {
+        time_frequency  freq;
+        const char      *end;
+        long            increment;
+    };
+
+    for (const auto &[freq, end, incr] :
+             { IndexSpec { time_frequency::secondly, "01/04/2024 08:00", 1 },
+               IndexSpec { time_frequency::millisecondly, "01/01/2024 01:00",
+                           7 } })  {
+        MyDataFrame::set_thread_level(0);
+
+        const auto  serial =
+            StdDataFrame<DateTime>::gen_datetime_index(
+                "01/01/2024", end, freq, incr, DT_TIME_ZONE::AM_NEW_YORK);
+        const auto  serial_ul =
+            MyDataFrame::gen_datetime_index(
+                "01/01/2024", end, freq, incr, DT_TIME_ZONE::AM_NEW_YORK);
+
+        MyDataFrame::set_thread_level(4);
+
+        const auto  para =
+            StdDataFrame<DateTime>::gen_datetime_index(
+                "01/01/2024", end, freq, incr, DT_TIME_ZONE::AM_NEW_YORK);
+        const auto  para_ul =
+            MyDataFrame::gen_datetime_index(
+                "01/01/2024", end, freq, incr, DT_TIME_ZONE::AM_NEW_YORK);
+
+        assert(serial.size() > ThreadPool::MUL_THR_THHOLD);
+        assert(serial.size() == para.size());
+        assert(serial_ul == para_ul);
+        for (std::size_t i = 0; i < serial.size(); ++i)
+            assert(serial[i] == para[i]);
+    }
+    MyDataFrame::set_optimum_thread_level();
+}
+
+// ----------------------------------------------------------------------------
+
 int main(int, char *[]) {
 
     test_thread_safety();
+    test_work_stealing_pool();
+    test_timezone_conversions();
     return (0);
 }
 
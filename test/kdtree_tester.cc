@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cassert>
 #include <cmath>
+#include <random>
 #include <iostream>
 
 using namespace hmdf;
@@ -132,6 +133,145 @@ int main(int, char *[]) {
         assert(in_range2[4] == 2.0);
     }
 
+    {
+        // Compare FlatKDTree against brute force, single and multi threaded
+        //
+        using tree_t = FlatKDTree<double>;
+
+        std::mt19937                            gen { 17 };
+        std::uniform_real_distribution<double>  unif { -100.0, 100.0 };
+
+        for (const std::size_t threads : { 0, 4 })  {
+            ThreadGranularity::set_thread_level(threads);
+            for (const std::size_t dim : { 1, 3, 8 })  {
+                // Big enough for a parallel build in low dimensions
+                //
+                const std::size_t   n { dim < 8 ? 40000UL : 5000UL };
+                std::vector<double> data(n * dim);
+
+                // Coarse values, so there are many equal distances
+                //
+                for (auto &v : data)  v = std::round(unif(gen)) / 4.0;
+
+                const auto  manhattan =
+                    [](const std::vector<double> &x,
+                       const std::vector<double> &y) -> double  {
+                        double  sum { 0 };
+
+                        for (std::size_t i { 0 }; i < x.size(); ++i)
+                            sum += std::fabs(x[i] - y[i]);
+                        return (sum);
+                    };
+
+                tree_t  euc_tree { dim };
+                tree_t  man_tree { dim, manhattan };
+
+                euc_tree.build(data.data(), n);
+                man_tree.build(data.data(), n);
+                assert(euc_tree.size() == n);
+                assert(euc_tree.dim() == dim);
+
+                std::vector<double> queries(8 * dim);
+
+                for (auto &v : queries)  v = unif(gen) / 4.0;
+
+                const auto  batch { euc_tree.find_k_nearest(queries.data(),
+                                                            8, 7) };
+
+                assert(batch.size() == 56);
+                for (std::size_t q { 0 }; q < 8; ++q)  {
+                    const double                target_data[8] { };
+                    const double                *target {
+                        q < 7 ? queries.data() + q * dim : target_data
+                    };
+                    const std::vector<double>   target_vec(target,
+                                                           target + dim);
+                    tree_t::neighbors_vec       euc_brute;
+                    tree_t::neighbors_vec       man_brute;
+
+                    std::vector<double>         pt(dim);
+
+                    for (std::size_t i { 0 }; i < n; ++i)  {
+                        double  sum { 0 };
+
+                        pt.assign(data.data() + i * dim,
+                                  data.data() + (i + 1) * dim);
+
+                        for (std::size_t j { 0 }; j < dim; ++j)
+                            sum += (pt[j] - target[j]) * (pt[j] - target[j]);
+                        euc_brute.push_back({ std::sqrt(sum), i });
+                        man_brute.push_back({ manhattan(pt, target_vec), i });
+                    }
+                    std::sort(euc_brute.begin(), euc_brute.end());
+                    std::sort(man_brute.begin(), man_brute.end());
+
+                    const auto  euc_knn { euc_tree.find_k_nearest(target,
+                                                                  25) };
+                    const auto  man_knn { man_tree.find_k_nearest(target_vec,
+                                                                  25) };
+
+                    assert(euc_knn.size() == 25 && man_knn.size() == 25);
+                    for (std::size_t i { 0 }; i < 25; ++i)  {
+                        assert(euc_knn[i].second == euc_brute[i].second);
+                        assert(euc_knn[i].first == euc_brute[i].first);
+                        assert(man_knn[i].second == man_brute[i].second);
+                        assert(man_knn[i].first == man_brute[i].first);
+                    }
+                    if (q < 7)
+                        for (std::size_t i { 0 }; i < 7; ++i)
+                            assert(batch[q * 7 + i] == euc_brute[i]);
+
+                    const double    radius { euc_brute[60].first };
+                    const auto      within { euc_tree.find_within(target,
+                                                                  radius) };
+                    std::size_t     in_cnt { 0 };
+
+                    while (in_cnt < n && euc_brute[in_cnt].first <= radius)
+                        in_cnt += 1;
+                    std::sort(euc_brute.begin(), euc_brute.begin() + in_cnt);
+                    assert(within.size() == in_cnt);
+                    for (std::size_t i { 0 }; i < in_cnt; ++i)
+                        assert(within[i] == euc_brute[i]);
+                }
+
+                const auto  all_knn { euc_tree.all_k_nearest(4) };
+
+                assert(all_knn.size() == n * 4);
+                for (std::size_t i { 0 }; i < n; i += 997)  {
+                    const auto  knn { euc_tree.find_k_nearest(
+                                          data.data() + i * dim, 4) };
+
+                    assert(knn[0].first == 0);
+                    for (std::size_t j { 0 }; j < 4; ++j)
+                        assert(all_knn[i * 4 + j] == knn[j]);
+                }
+
+                const std::vector<double>   lower(dim, -10.0);
+                const std::vector<double>   upper(dim, 5.0);
+                std::vector<std::size_t>    box_brute;
+
+                for (std::size_t i { 0 }; i < n; ++i)  {
+                    bool    in_box { true };
+
+                    for (std::size_t j { 0 }; j < dim; ++j)
+                        in_box = in_box &&
+                                 data[i * dim + j] >= lower[j] &&
+                                 data[i * dim + j] <= upper[j];
+                    if (in_box)  box_brute.push_back(i);
+                }
+                assert(euc_tree.find_in_range(lower, upper) == box_brute);
+            }
+        }
+        ThreadGranularity::set_thread_level(0);
+
+        tree_t  tiny { 2 };
+
+        tiny.build({ { 2, 3 }, { 5, 4 }, { 9, 6 } });
+        assert(tiny.find_k_nearest({ 9, 2 }, 10).size() == 3);
+        assert(tiny.find_k_nearest({ 9, 2 }, 10)[0].second == 2);
+        assert(tiny.find_k_nearest({ 9, 2 }, 10)[0].first == 4.0);
+    }
+
     return (0);
 }
 
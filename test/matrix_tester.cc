@@ -28,6 +28,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/Utils/Matrix.h>
 
 #include <cassert>
+#include <cmath>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
@@ -1092,6 +1093,103 @@ int main(int, char *[]) {
         assert(col_row_wise(8, 3) == 36);
     }
 
+    // Test the packed-panel multiplication and the multi-threaded
+    // Householder paths against plain loops. The shapes are deliberately
+    // not multiples of the panel and micro-tile sizes.
+    //
+    {
+        using col_dmat_t = Matrix<double, matrix_orient::column_major>;
+        using row_dmat_t = Matrix<double, matrix_orient::row_major>;
+
+        ThreadGranularity::set_thread_level(4);
+
+        col_dmat_t  col_lhs { 301, 613 };
+        row_dmat_t  row_lhs { 301, 613 };
+        row_dmat_t  rhs { 613, 77 };
+
+        for (long r = 0; r < col_lhs.rows(); ++r)
+            for (long c = 0; c < col_lhs.cols(); ++c)
+                row_lhs(r, c) = col_lhs(r, c) = std::sin(double(r * 7 + c));
+        for (long r = 0; r < rhs.rows(); ++r)
+            for (long c = 0; c < rhs.cols(); ++c)
+                rhs(r, c) = std::cos(double(r + c * 3));
+
+        const auto  col_prod = col_lhs * rhs;
+        const auto  row_prod = row_lhs * rhs;
+
+        assert(col_prod.rows() == 301);
+        assert(col_prod.cols() == 77);
+        assert(row_prod.rows() == 301);
+        assert(row_prod.cols() == 77);
+        for (long r = 0; r < col_prod.rows(); ++r)
+            for (long c = 0; c < col_prod.cols(); ++c)  {
+                double  val { 0 };
+
+                for (long k = 0; k < col_lhs.cols(); ++k)
+                    val += col_lhs(r, k) * rhs(k, c);
+                assert((std::fabs(col_prod(r, c) - val) < 0.000000001));
+                assert((std::fabs(row_prod(r, c) - val) < 0.000000001));
+            }
+
+        col_dmat_t  tall { 700, 320 };
+
+        for (long r = 0; r < tall.rows(); ++r)
+            for (long c = 0; c < tall.cols(); ++c)
+                tall(r, c) = std::sin(double(r * 3 + c * c));
+
+        col_dmat_t  U;
+        col_dmat_t  S;
+        col_dmat_t  V;
+
+        tall.svd(U, S, V, true);
+
+        const auto  tall2 = U * S * V.transpose();
+
+        for (long r = 0; r < tall.rows(); ++r)
+            for (long c = 0; c < tall.cols(); ++c)
+                assert((std::fabs(tall(r, c) - tall2(r, c)) < 0.0000001));
+
+        row_dmat_t  row_sq { 300, 300 };
+        col_dmat_t  col_sq { 300, 300 };
+
+        for (long r = 0; r < row_sq.rows(); ++r)
+            for (long c = 0; c < row_sq.cols(); ++c)
+                row_sq(r, c) = col_sq(r, c) =
+                    std::sin(double(r * 5 + c)) + (r == c ? 10.0 : 0.0);
+
+        const auto  row_ident = row_sq * row_sq.inverse();
+        const auto  col_ident = col_sq * col_sq.inverse();
+
+        for (long r = 0; r < row_ident.rows(); ++r)
+            for (long c = 0; c < row_ident.cols(); ++c)  {
+                const double    val { r == c ? 1.0 : 0.0 };
+
+                assert((std::fabs(row_ident(r, c) - val) < 0.0000001));
+                assert((std::fabs(col_ident(r, c) - val) < 0.0000001));
+            }
+
+        col_dmat_t  sym { 300, 300 };
+        col_dmat_t  eigenvals;
+        col_dmat_t  eigenvecs;
+
+        for (long r = 0; r < sym.rows(); ++r)
+            for (long c = 0; c <= r; ++c)
+                sym(r, c) = sym(c, r) = std::cos(double(r * c + r + c));
+        sym.eigen_space(eigenvals, eigenvecs, true);
+
+        // sym * v == lambda * v for every eigen pair
+        //
+        const auto  sym_vecs = sym * eigenvecs;
+
+        for (long c = 0; c < eigenvecs.cols(); ++c)
+            for (long r = 0; r < eigenvecs.rows(); ++r)
+                assert((std::fabs(sym_vecs(r, c) -
+                                  eigenvals(0, c) * eigenvecs(r, c)) <
+                        0.0000001));
+
+        ThreadGranularity::set_thread_level(0);
+    }
+
     test_thread_pool();
     return (0);
 }
@@ -141,7 +141,27 @@ int main(int, char *[]) {
     assert(hv.size<std::string>() == 4);
 
     hv2 = hv;
+    assert(hv2.size<int>() == 6);
+    assert(hv2.size<double>() == 6);
+    assert(hv2.at<std::string>(3) == "fas");
     hv3 = std::move(hv2);
+    assert(hv3.size<int>() == 6);
+    assert(hv3.at<int>(0) == 10);
+    assert(hv3.size<std::string>() == 4);
+    assert(hv2.size<int>() == 0);
+    assert(hv2.size<double>() == 0);
+
+    {
+        // The first type lives inline. Make sure the others survive a
+        // copy/move chain too.
+
+        HeteroVector<512>   hv4 { hv3 };
+        HeteroVector<512>   hv5 { std::move(hv4) };
+
+        assert(hv5.at<double>(3) == 1.05);
+        assert(hv5.back<std::string>() == "fas");
+        assert(hv4.empty<double>());
+    }
 
     const auto  &dbl_vec = hv3.get_vector<double>();
 